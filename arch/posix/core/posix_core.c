@@ -19,6 +19,9 @@
  * The Zephyr OS only sees one of this thread executing at a time.
  * Which is running is controlled using {cond|mtx}_threads and
  * currently_allowed_thread.
+ * With CONFIG_ARCH_POSIX_SWAP_PER_THREAD, each thread waits on its own
+ * condition variable instead of cond_threads, so that a swap only wakes
+ * the thread allowed to run rather than every thread.
  *
  * The main part of the execution of each thread will occur in a fully
  * synchronous and deterministic manner, and only when commanded by the Zephyr
@@ -72,6 +75,12 @@ struct threads_table_el {
 	bool running;     /* Is this the currently running thread */
 	pthread_t thread; /* Actual pthread_t as returned by native kernel */
 	int thead_cnt; /* For debugging: Unique, consecutive, thread number */
+#ifdef CONFIG_ARCH_POSIX_SWAP_PER_THREAD
+	/* Condition variable only this thread waits on. Allocated apart,
+	 * as the table may be moved by realloc() while threads wait
+	 */
+	pthread_cond_t *cond;
+#endif
 };
 
 static struct threads_table_el *threads_table;
@@ -90,6 +99,18 @@ static int currently_allowed_thread;
 
 static bool terminate; /* Are we terminating the program == cleaning up */
 
+/**
+ * Condition variable thread <th_nbr> waits on to be allowed to run
+ */
+static pthread_cond_t *thread_cond(int th_nbr)
+{
+#ifdef CONFIG_ARCH_POSIX_SWAP_PER_THREAD
+	return threads_table[th_nbr].cond;
+#else
+	return &cond_threads;
+#endif
+}
+
 static void posix_wait_until_allowed(int this_th_nbr);
 static void *posix_thread_starter(void *arg);
 static void posix_preexit_cleanup(void);
@@ -128,8 +149,15 @@ static void posix_wait_until_allowed(int this_th_nbr)
 		this_th_nbr,
 		__func__);
 
+	/*
+	 * A thread aborted before it ever waited may not be woken up again
+	 */
+	if (threads_table[this_th_nbr].state == ABORTING) {
+		abort_tail(this_th_nbr);
+	}
+
 	while (this_th_nbr != currently_allowed_thread) {
-		pthread_cond_wait(&cond_threads, &mtx_threads);
+		pthread_cond_wait(thread_cond(this_th_nbr), &mtx_threads);
 
 		if (threads_table &&
 		    (threads_table[this_th_nbr].state == ABORTING)) {
@@ -162,11 +190,16 @@ static void posix_let_run(int next_allowed_th)
 
 	/*
 	 * We let all threads know one is able to run now (it may even be us
-	 * again if fancied)
+	 * again if fancied), or only that one with per thread condition
+	 * variables.
 	 * Note that as we hold the mutex, they are going to be blocked until
 	 * we reach our own posix_wait_until_allowed() while loop
 	 */
+#ifdef CONFIG_ARCH_POSIX_SWAP_PER_THREAD
+	_SAFE_CALL(pthread_cond_signal(thread_cond(next_allowed_th)));
+#else
 	_SAFE_CALL(pthread_cond_broadcast(&cond_threads));
+#endif
 }
 
 
@@ -372,6 +405,18 @@ void posix_new_thread(posix_thread_status_t *ptr)
 	threads_table[t_slot].thead_cnt = thread_create_count++;
 	ptr->thread_idx = t_slot;
 
+#ifdef CONFIG_ARCH_POSIX_SWAP_PER_THREAD
+	/*
+	 * Like the lingering native threads, the condition variables are
+	 * only reclaimed when the process exits
+	 */
+	threads_table[t_slot].cond = malloc(sizeof(pthread_cond_t));
+	if (threads_table[t_slot].cond == NULL) { /* LCOV_EXCL_BR_LINE */
+		posix_print_error_and_exit(NO_MEM_ERR); /* LCOV_EXCL_LINE */
+	}
+	_SAFE_CALL(pthread_cond_init(threads_table[t_slot].cond, NULL));
+#endif
+
 	_SAFE_CALL(pthread_create(&threads_table[t_slot].thread,
 				  NULL,
 				  posix_thread_starter,
@@ -460,6 +505,10 @@ void posix_abort_thread(int thread_idx)
 		thread_idx);
 
 	threads_table[thread_idx].state = ABORTING;
+#ifdef CONFIG_ARCH_POSIX_SWAP_PER_THREAD
+	/* Nobody else would wake it up */
+	_SAFE_CALL(pthread_cond_signal(thread_cond(thread_idx)));
+#endif
 	/*
 	 * Note: the native thread will linger in RAM until it catches the
 	 * mutex or awakes on the condition.
@@ -23,6 +23,31 @@ LOG_MODULE_REGISTER(LOG_MODULE_NAME);
 #include <net/net_if.h>
 
 #include <net/dummy.h>
+#include <net/loopback.h>
+
+#if defined(CONFIG_NET_LOOPBACK_SIMULATE_PACKET_DROP)
+static unsigned int drop_interval;
+static unsigned int drop_count;
+
+void loopback_set_packet_drop_interval(unsigned int interval)
+{
+	drop_interval = interval;
+	drop_count = 0U;
+}
+
+static bool loopback_drop(void)
+{
+	if (drop_interval == 0U || ++drop_count < drop_interval) {
+		return false;
+	}
+
+	drop_count = 0U;
+
+	return true;
+}
+#else
+#define loopback_drop() false
+#endif
 
 int loopback_dev_init(struct device *dev)
 {
@@ -70,6 +95,12 @@ static int loopback_send(struct device *dev, struct net_pkt *pkt)
 		net_ipaddr_copy(&NET_IPV4_HDR(pkt)->dst, &addr);
 	}
 
+	if (loopback_drop()) {
+		LOG_DBG("Dropping pkt %p", pkt);
+		res = 0;
+		goto out;
+	}
+
 	/* We should simulate normal driver meaning that if the packet is
 	 * properly sent (which is always in this driver), then the packet
 	 * must be dropped. This is very much needed for TCP packets where
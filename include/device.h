@@ -206,6 +206,53 @@ extern "C" {
  */
 #define DEVICE_DECLARE(name) static struct device DEVICE_NAME_GET(name)
 
+/**
+ * @def DEVICE_INIT_PARALLEL
+ *
+ * @brief Allow a device to be initialized in parallel with others
+ *
+ * @details By default, the devices of an initialization level are
+ * initialized one after another, in priority order.  When
+ * CONFIG_DEVICE_INIT_PARALLEL is enabled, a device marked with this
+ * macro may instead be initialized concurrently with the other marked
+ * devices next to it in that order, as soon as the devices it depends
+ * on are initialized.  A device that is not marked still starts only
+ * once all devices before it are initialized, so that the existing
+ * priority ordering keeps holding for it.
+ *
+ * Parallel initialization only applies to the POST_KERNEL and
+ * APPLICATION levels; earlier levels run before the scheduler and are
+ * always sequential.
+ *
+ * The macro must follow the definition of the device, for instance
+ * with DEVICE_AND_API_INIT().  Without CONFIG_DEVICE_INIT_PARALLEL it
+ * expands to nothing.
+ *
+ * @param dev_name The same as dev_name provided to DEVICE_INIT()
+ * @param ... Names of the devices that must be initialized first, as
+ * passed to device_get_binding(), for instance devicetree labels.
+ * Names of devices that are not part of the build are ignored.  A
+ * device that the level and priority order place after this one, and
+ * that is not part of the same run of marked devices, cannot be waited
+ * for: this is reported at boot, and is an assertion failure when
+ * assertions are enabled.
+ */
+#ifdef CONFIG_DEVICE_INIT_PARALLEL
+#define DEVICE_INIT_PARALLEL(dev_name, ...)				    \
+	static const char * const _CONCAT(__init_deps_, dev_name)[] = {	    \
+		__VA_ARGS__						    \
+	};								    \
+	static const struct device_init_deps				    \
+	_CONCAT(__init_deps_entry_, dev_name) __used			    \
+	__attribute__((__section__(".devinit_deps." STRINGIFY(dev_name)))) = {\
+		.dev = DEVICE_GET(dev_name),				    \
+		.names = _CONCAT(__init_deps_, dev_name),		    \
+		.count = ARRAY_SIZE(_CONCAT(__init_deps_, dev_name)),	    \
+	}
+#else
+#define DEVICE_INIT_PARALLEL(dev_name, ...)
+#endif
+
 struct device;
 
 
@@ -237,6 +284,13 @@ struct device {
 	struct device_config *config;
 	const void *driver_api;
 	void *driver_data;
+#if defined(CONFIG_DEVICE_INIT_PARALLEL) || \
+	defined(CONFIG_BOOT_TIME_MEASUREMENT)
+	/* Boot time bookkeeping, kept to 8 bytes for the reason below */
+	u32_t init_cycles;
+	u16_t init_deps;
+	u8_t init_state;
+#endif
 #if defined(__x86_64) && __SIZEOF_POINTER__ == 4
 	/* The x32 ABI hits an edge case.  This is a 12 byte struct,
 	 * but the x86_64 linker will pack them only in units of 8
@@ -247,6 +301,19 @@ struct device {
 #endif
 };
 
+/**
+ * @brief Parallel initialization record (In ROM) of a device
+ *
+ * @param dev device that may be initialized in parallel
+ * @param names names of the devices it depends on
+ * @param count number of entries in names
+ */
+struct device_init_deps {
+	struct device *dev;
+	const char * const *names;
+	u32_t count;
+};
+
 void _sys_device_do_config_level(s32_t level);
 
 /**
@@ -127,6 +127,7 @@ struct k_mem_pool;
 struct k_timer;
 struct k_poll_event;
 struct k_poll_signal;
+struct k_pollset;
 struct k_mem_domain;
 struct k_mem_partition;
 
@@ -455,6 +456,11 @@ struct _thread_base {
 
 #endif
 
+#ifdef CONFIG_SCHED_PERCPU_RUNQ
+	/* CPU whose run queue holds the thread, NULL if not queued */
+	struct _cpu *runq_cpu;
+#endif
+
 #ifdef CONFIG_SCHED_CPU_MASK
 	/* "May run on" bits for each CPU */
 	u8_t cpu_mask;
@@ -484,11 +490,40 @@ struct _thread_stack_info {
 	 * that should be writable by the thread
 	 */
 	u32_t size;
+
+#ifdef CONFIG_STACK_USAGE_MONITOR
+	/* Highest stack usage sampled at context switches, in bytes */
+	u32_t max_used;
+#endif
 };
 
 typedef struct _thread_stack_info _thread_stack_info_t;
 #endif /* CONFIG_THREAD_STACK_INFO */
 
+#if defined(CONFIG_TRACING_CPU_STATS_THREADS)
+/* Number of buckets of the ready-to-run latency histogram */
+#define K_THREAD_LATENCY_BUCKETS 16
+
+/* CPU usage of a thread, see tracing_cpu_stats.h */
+struct k_thread_runtime_stats {
+	/* Cycles spent running the thread, interrupts excluded */
+	u64_t cycles;
+
+	/* Number of times the thread was switched in */
+	u32_t switches;
+
+	/* Ready-to-run latency histogram: bucket 0 counts waits for the
+	 * CPU under 2 us, bucket n those from 2^n to 2^(n+1) us, and the
+	 * last bucket all longer waits
+	 */
+	u32_t latency[K_THREAD_LATENCY_BUCKETS];
+
+	/* Cycle count when the thread became ready, if it is waiting */
+	u32_t ready_at;
+	u8_t waiting;
+};
+#endif /* CONFIG_TRACING_CPU_STATS_THREADS */
+
 #if defined(CONFIG_USERSPACE)
 struct _mem_domain_info {
 	/* memory domain queue node */
@@ -561,6 +596,11 @@ struct k_thread {
 	struct _thread_stack_info stack_info;
 #endif /* CONFIG_THREAD_STACK_INFO */
 
+#if defined(CONFIG_TRACING_CPU_STATS_THREADS)
+	/** CPU usage statistics */
+	struct k_thread_runtime_stats runtime_stats;
+#endif
+
 #if defined(CONFIG_USERSPACE)
 	/** memory domain info of the thread */
 	struct _mem_domain_info mem_domain_info;
@@ -621,6 +661,34 @@ typedef void (*k_thread_user_cb_t)(const struct k_thread *thread,
  */
 extern void k_thread_foreach(k_thread_user_cb_t user_cb, void *user_data);
 
+#if defined(CONFIG_STACK_USAGE_MONITOR)
+/**
+ * @brief Get the sampled stack usage of a thread.
+ *
+ * The stack pointer of a thread is sampled each time it is switched out,
+ * no stack painting is involved. The result is a lower bound of the real
+ * high-water mark: a peak reached between two context switches is not
+ * seen.
+ *
+ * @param thread Thread to query.
+ *
+ * @return Highest stack usage sampled so far, in bytes.
+ */
+extern size_t k_thread_stack_usage_get(k_tid_t thread);
+
+/**
+ * @brief Get the sampled interrupt stack usage of a CPU.
+ *
+ * The stack pointer is sampled on the interrupt stack at each tick
+ * announcement, see k_thread_stack_usage_get().
+ *
+ * @param cpu CPU number.
+ *
+ * @return Highest interrupt stack usage sampled so far, in bytes.
+ */
+extern size_t k_isr_stack_usage_get(int cpu);
+#endif
+
 /** @} */
 
 /**
@@ -1494,6 +1562,28 @@ extern void k_timer_init(struct k_timer *timer,
 __syscall void k_timer_start(struct k_timer *timer,
 			     s32_t duration, s32_t period);
 
+/**
+ * @brief Start a timer with a tolerance.
+ *
+ * This routine works like k_timer_start(), except that each expiry of the
+ * timer may be delayed by up to @a slack milliseconds. The kernel uses this
+ * tolerance to serve timeouts expiring close to each other from a single
+ * timer interrupt, which saves wakeups in tickless mode.
+ *
+ * The slack is ignored unless CONFIG_TIMEOUT_SLACK is enabled. It applies
+ * until the timer is started again.
+ *
+ * @param timer     Address of timer.
+ * @param duration  Initial timer duration (in milliseconds).
+ * @param period    Timer period (in milliseconds).
+ * @param slack     Maximum delay of each expiry (in milliseconds).
+ *
+ * @return N/A
+ */
+__syscall void k_timer_start_slack(struct k_timer *timer,
+				   s32_t duration, s32_t period,
+				   s32_t slack);
+
 /**
  * @brief Stop a timer.
  *
@@ -1639,6 +1729,33 @@ __syscall s64_t k_uptime_get(void);
  */
 int k_enable_sys_clock_always_on(void);
 
+/**
+ * @brief Timeout statistics.
+ */
+struct k_timeout_stats {
+	/** Number of timer announcements, i.e. of timer interrupts in
+	 * tickless mode
+	 */
+	u32_t announces;
+	/** Number of timeouts expired by these announcements */
+	u32_t expired;
+};
+
+#if defined(CONFIG_TIMEOUT_STATS) || defined(__DOXYGEN__)
+/**
+ * @brief Get the timeout statistics.
+ *
+ * The counters accumulate since boot. The rate of timer wakeups is
+ * obtained by sampling them along with k_uptime_get(). Requires
+ * CONFIG_TIMEOUT_STATS.
+ *
+ * @param stats Address where the statistics are copied.
+ *
+ * @return N/A
+ */
+extern void k_timeout_stats_get(struct k_timeout_stats *stats);
+#endif
+
 /**
  * @brief Disable clock always on in tickless kernel
  *
@@ -1712,6 +1829,65 @@ static inline u32_t k_uptime_delta_32(s64_t *reftime)
 	return (u32_t)k_uptime_delta(reftime);
 }
 
+#if defined(CONFIG_TIME_PAGE) || defined(__DOXYGEN__)
+/* Kernel time as of the last tick announcement, written by
+ * z_clock_announce() under a sequence count: the count is odd while
+ * an update is in progress.
+ */
+struct z_time_page {
+	u32_t seq;
+	u32_t ticks_lo;
+	u32_t ticks_hi;
+};
+
+extern struct z_time_page z_time_page;
+
+/**
+ * @brief Memory partition of the time page.
+ *
+ * User threads may read the time page, see k_uptime_get_fast(), once
+ * this partition is added to their memory domain.  It is read-only for
+ * them.
+ */
+extern struct k_mem_partition z_time_page_partition;
+
+static inline s64_t z_time_page_ticks(void)
+{
+	u32_t seq, lo, hi;
+
+	do {
+		seq = __atomic_load_n(&z_time_page.seq, __ATOMIC_ACQUIRE);
+		lo = __atomic_load_n(&z_time_page.ticks_lo, __ATOMIC_RELAXED);
+		hi = __atomic_load_n(&z_time_page.ticks_hi, __ATOMIC_RELAXED);
+		__atomic_thread_fence(__ATOMIC_ACQUIRE);
+	} while ((seq & 1) != 0 ||
+		 seq != __atomic_load_n(&z_time_page.seq, __ATOMIC_RELAXED));
+
+	return (s64_t)(((u64_t)hi << 32) | lo);
+}
+
+/**
+ * @brief Get system uptime without a system call.
+ *
+ * This routine returns the elapsed time since the system booted, in
+ * milliseconds, as of the last system clock announcement.  It reads
+ * the time page rather than trapping into the kernel, so user threads
+ * can call it cheaply once z_time_page_partition is part of their
+ * memory domain.
+ *
+ * In tickless mode the announcements only happen when a timeout
+ * expires, so the time page may be arbitrarily old when the system has
+ * been idle, unless :option:`CONFIG_TIME_PAGE_MAX_AGE_MS` bounds its
+ * age.  Use k_uptime_get() where an exact value matters.
+ *
+ * @return Uptime in milliseconds as of the last clock announcement.
+ */
+static inline s64_t k_uptime_get_fast(void)
+{
+	return __ticks_to_ms(z_time_page_ticks());
+}
+#endif /* CONFIG_TIME_PAGE */
+
 /**
  * @brief Read the hardware clock.
  *
@@ -1926,6 +2102,35 @@ extern void k_queue_merge_slist(struct k_queue *queue, sys_slist_t *list);
  */
 __syscall void *k_queue_get(struct k_queue *queue, s32_t timeout);
 
+/**
+ * @brief Get several elements from a queue at once.
+ *
+ * This routine removes up to @a max data items from the head of @a queue
+ * in a single critical section and stores their addresses in @a data, in
+ * queue order. If @a queue is empty, it waits until at least one item is
+ * available, then takes it along with whatever else has been queued by
+ * then. Consumers draining a busy queue thus pay for one lock
+ * acquisition, rather than one per item.
+ *
+ * Items queued with k_queue_alloc_append() or k_queue_alloc_prepend() are
+ * returned like those from k_queue_get(), their internal allocation is
+ * released.
+ *
+ * @note Can be called by ISRs, but @a timeout must be set to K_NO_WAIT.
+ *
+ * @param queue Address of the queue.
+ * @param data Array receiving the addresses of the data items.
+ * @param max Number of entries in @a data.
+ * @param timeout Waiting period to obtain a data item (in milliseconds),
+ *                or one of the special values K_NO_WAIT and K_FOREVER.
+ *
+ * @return Number of data items stored in @a data; 0 if returned without
+ * waiting, or waiting period timed out, or the wait was cancelled with
+ * k_queue_cancel_wait().
+ */
+__syscall int k_queue_get_batch(struct k_queue *queue, void **data, int max,
+				s32_t timeout);
+
 /**
  * @brief Remove an element from a queue.
  *
@@ -2190,6 +2395,27 @@ struct k_fifo {
 #define k_fifo_get(fifo, timeout) \
 	k_queue_get((struct k_queue *) fifo, timeout)
 
+/**
+ * @brief Get several elements from a FIFO queue at once.
+ *
+ * This routine removes up to @a max data items from @a fifo in a "first
+ * in, first out" manner, waiting only if it is empty. See
+ * k_queue_get_batch().
+ *
+ * @note Can be called by ISRs, but @a timeout must be set to K_NO_WAIT.
+ *
+ * @param fifo Address of the FIFO queue.
+ * @param data Array receiving the addresses of the data items.
+ * @param max Number of entries in @a data.
+ * @param timeout Waiting period to obtain a data item (in milliseconds),
+ *                or one of the special values K_NO_WAIT and K_FOREVER.
+ *
+ * @return Number of data items stored in @a data; 0 if returned without
+ * waiting, or waiting period timed out.
+ */
+#define k_fifo_get_batch(fifo, data, max, timeout) \
+	k_queue_get_batch((struct k_queue *) fifo, data, max, timeout)
+
 /**
  * @brief Query a FIFO queue to see if it has data available.
  *
@@ -2350,6 +2576,27 @@ struct k_lifo {
 #define k_lifo_get(lifo, timeout) \
 	k_queue_get((struct k_queue *) lifo, timeout)
 
+/**
+ * @brief Get several elements from a LIFO queue at once.
+ *
+ * This routine removes up to @a max data items from @a lifo in a "last
+ * in, first out" manner, waiting only if it is empty. See
+ * k_queue_get_batch().
+ *
+ * @note Can be called by ISRs, but @a timeout must be set to K_NO_WAIT.
+ *
+ * @param lifo Address of the LIFO queue.
+ * @param data Array receiving the addresses of the data items.
+ * @param max Number of entries in @a data.
+ * @param timeout Waiting period to obtain a data item (in milliseconds),
+ *                or one of the special values K_NO_WAIT and K_FOREVER.
+ *
+ * @return Number of data items stored in @a data; 0 if returned without
+ * waiting, or waiting period timed out.
+ */
+#define k_lifo_get_batch(lifo, data, max, timeout) \
+	k_queue_get_batch((struct k_queue *) lifo, data, max, timeout)
+
 /**
  * @brief Statically define and initialize a LIFO queue.
  *
@@ -2525,6 +2772,29 @@ struct k_work;
  */
 typedef void (*k_work_handler_t)(struct k_work *work);
 
+/**
+ * @brief Workqueue statistics.
+ *
+ * Latencies and runtimes are measured in hardware clock cycles, as
+ * returned by k_cycle_get_32().
+ */
+struct k_work_q_stats {
+	/** Number of work items currently pending in the queue */
+	atomic_t depth;
+	/** Largest number of work items seen pending at once */
+	atomic_t max_depth;
+	/** Number of work item handlers that have run */
+	u32_t processed;
+	/** Largest delay between submission and start of a handler */
+	u32_t latency_max;
+	/** Sum of the delays between submission and start of handlers */
+	u64_t latency_total;
+	/** Longest handler execution time */
+	u32_t runtime_max;
+	/** Sum of all handler execution times */
+	u64_t runtime_total;
+};
+
 /**
  * @cond INTERNAL_HIDDEN
  */
@@ -2533,16 +2803,27 @@ struct k_work_q {
 	struct k_queue queue;
 	struct k_thread thread;
 	struct k_spinlock lock;
+	int num_workers;
+#ifdef CONFIG_WORK_QUEUE_STATS
+	struct k_work_q_stats stats;
+#endif
 };
 
 enum {
 	K_WORK_STATE_PENDING,	/* Work item pending state */
+	K_WORK_STATE_RUNNING,	/* Handler running in a pool worker */
+	K_WORK_STATE_RERUN,	/* Resubmitted while running */
+	K_WORK_STATE_COUNTED,	/* Submission counted in the statistics */
+	K_WORK_STATE_RERUN_COUNTED, /* Resubmission while running counted */
 };
 
 struct k_work {
 	void *_reserved;		/* Used by k_queue implementation. */
 	k_work_handler_t handler;
 	atomic_t flags[1];
+#ifdef CONFIG_WORK_QUEUE_STATS
+	u32_t submit_time;
+#endif
 };
 
 struct k_delayed_work {
@@ -2597,6 +2878,31 @@ static inline void k_work_init(struct k_work *work, k_work_handler_t handler)
 	*work = (struct k_work)_K_WORK_INITIALIZER(handler);
 }
 
+/**
+ * @cond INTERNAL_HIDDEN
+ */
+
+#ifdef CONFIG_WORK_QUEUE_STATS
+extern void z_work_q_stats_submit(struct k_work_q *work_q,
+				  struct k_work *work);
+
+/* The statistics are kept in kernel memory and timestamped with
+ * k_cycle_get_32(), so only supervisor mode submissions are counted.
+ */
+static inline bool z_work_q_stats_enabled(void)
+{
+#ifdef CONFIG_USERSPACE
+	return !_is_user_context();
+#else
+	return true;
+#endif
+}
+#endif
+
+/**
+ * INTERNAL_HIDDEN @endcond
+ */
+
 /**
  * @brief Submit a work item.
  *
@@ -2623,6 +2929,11 @@ static inline void k_work_submit_to_queue(struct k_work_q *work_q,
 					  struct k_work *work)
 {
 	if (!atomic_test_and_set_bit(work->flags, K_WORK_STATE_PENDING)) {
+#ifdef CONFIG_WORK_QUEUE_STATS
+		if (z_work_q_stats_enabled()) {
+			z_work_q_stats_submit(work_q, work);
+		}
+#endif
 		k_queue_append(&work_q->queue, work);
 	}
 }
@@ -2730,6 +3041,77 @@ extern void k_work_q_user_start(struct k_work_q *work_q,
 				k_thread_stack_t *stack,
 				size_t stack_size, int prio);
 
+/**
+ * @brief Pin each worker thread of a workqueue pool to its own CPU.
+ *
+ * Worker @em i is pinned to CPU @em i modulo the number of CPUs. Requires
+ * CONFIG_SCHED_CPU_MASK, and is ignored otherwise.
+ */
+#define K_WORK_Q_POOL_PIN BIT(0)
+
+/**
+ * @brief Start a workqueue served by a pool of threads.
+ *
+ * This routine starts workqueue @a work_q with @a num_threads work
+ * processing threads, which run forever. Work items are processed in
+ * submission order by whichever worker is free first, so several items of
+ * the same workqueue may run concurrently.
+ *
+ * A given work item is never run by two workers at once: if it is
+ * resubmitted while its handler is running, the worker running it calls
+ * the handler again once it returns, instead of passing the item to
+ * another worker. The k_work and k_delayed_work APIs can be used on a
+ * pool exactly as on a single-threaded workqueue.
+ *
+ * The thread embedded in @a work_q is not used, the workers are @a threads
+ * instead. k_work_q_start() is equivalent to starting a pool of one thread.
+ *
+ * @param work_q Address of workqueue.
+ * @param threads Array of @a num_threads thread objects for the workers.
+ * @param stacks First of @a num_threads stacks defined as an array by
+ *		K_THREAD_STACK_ARRAY_DEFINE(), i.e. <name>[0].
+ * @param num_threads Number of worker threads.
+ * @param stack_size Size of each worker's stack (in bytes), which should
+ *		be the same constant passed to K_THREAD_STACK_ARRAY_DEFINE().
+ * @param prio Priority of the worker threads.
+ * @param options Either 0 or K_WORK_Q_POOL_PIN.
+ *
+ * @return N/A
+ */
+extern void k_work_q_pool_start(struct k_work_q *work_q,
+				struct k_thread *threads,
+				k_thread_stack_t *stacks, int num_threads,
+				size_t stack_size, int prio, u32_t options);
+
+#if defined(CONFIG_WORK_QUEUE_STATS) || defined(__DOXYGEN__)
+/**
+ * @brief Get the statistics of a workqueue.
+ *
+ * Statistics are only collected for workqueues started with
+ * k_work_q_start() or k_work_q_pool_start(), and only cover work items
+ * submitted from supervisor mode with k_work_submit_to_queue() or as
+ * delayed work.
+ *
+ * @param work_q Address of workqueue.
+ * @param stats Address where the statistics are copied.
+ *
+ * @return N/A
+ */
+extern void k_work_q_stats_get(struct k_work_q *work_q,
+			       struct k_work_q_stats *stats);
+
+/**
+ * @brief Reset the statistics of a workqueue.
+ *
+ * All statistics but the current queue depth are cleared.
+ *
+ * @param work_q Address of workqueue.
+ *
+ * @return N/A
+ */
+extern void k_work_q_stats_reset(struct k_work_q *work_q);
+#endif
+
 /**
  * @brief Initialize a delayed work item.
  *
@@ -2781,6 +3163,30 @@ extern int k_delayed_work_submit_to_queue(struct k_work_q *work_q,
 					  struct k_delayed_work *work,
 					  s32_t delay);
 
+/**
+ * @brief Submit a delayed work item with a tolerance.
+ *
+ * This routine works like k_delayed_work_submit_to_queue(), except that
+ * the work item may be submitted up to @a slack milliseconds after its
+ * delay has elapsed, so that the kernel can batch it with other timeouts.
+ * The slack is ignored unless CONFIG_TIMEOUT_SLACK is enabled.
+ *
+ * @note Can be called by ISRs.
+ *
+ * @param work_q Address of workqueue.
+ * @param work Address of delayed work item.
+ * @param delay Delay before submitting the work item (in milliseconds).
+ * @param slack Maximum extra delay (in milliseconds).
+ *
+ * @retval 0 Work item countdown started.
+ * @retval -EINPROGRESS Work item is already pending.
+ * @retval -EINVAL Work item is being processed or has completed its work.
+ * @retval -EADDRINUSE Work item is pending on a different workqueue.
+ */
+extern int k_delayed_work_submit_to_queue_slack(struct k_work_q *work_q,
+						struct k_delayed_work *work,
+						s32_t delay, s32_t slack);
+
 /**
  * @brief Cancel a delayed work item.
  *
@@ -2865,6 +3271,32 @@ static inline int k_delayed_work_submit(struct k_delayed_work *work,
 	return k_delayed_work_submit_to_queue(&k_sys_work_q, work, delay);
 }
 
+/**
+ * @brief Submit a delayed work item to the system workqueue with a
+ * tolerance.
+ *
+ * This routine works like k_delayed_work_submit(), with the work item
+ * allowed to be submitted up to @a slack milliseconds late. See
+ * k_delayed_work_submit_to_queue_slack().
+ *
+ * @note Can be called by ISRs.
+ *
+ * @param work Address of delayed work item.
+ * @param delay Delay before submitting the work item (in milliseconds).
+ * @param slack Maximum extra delay (in milliseconds).
+ *
+ * @retval 0 Work item countdown started.
+ * @retval -EINPROGRESS Work item is already pending.
+ * @retval -EINVAL Work item is being processed or has completed its work.
+ * @retval -EADDRINUSE Work item is pending on a different workqueue.
+ */
+static inline int k_delayed_work_submit_slack(struct k_delayed_work *work,
+					      s32_t delay, s32_t slack)
+{
+	return k_delayed_work_submit_to_queue_slack(&k_sys_work_q, work,
+						    delay, slack);
+}
+
 /**
  * @brief Get time remaining before a delayed work gets scheduled.
  *
@@ -3188,6 +3620,8 @@ struct k_msgq {
 
 
 #define K_MSGQ_FLAG_ALLOC	BIT(0)
+#define K_MSGQ_FLAG_PUT_CLAIMED	BIT(1)
+#define K_MSGQ_FLAG_GET_CLAIMED	BIT(2)
 
 /**
  * @brief Message Queue Attributes
@@ -3291,10 +3725,54 @@ void k_msgq_cleanup(struct k_msgq *q);
  * @retval 0 Message sent.
  * @retval -ENOMSG Returned without waiting or queue purged.
  * @retval -EAGAIN Waiting period timed out.
+ * @retval -EBUSY A message claimed with k_msgq_put_claim() is outstanding.
  * @req K-MSGQ-002
  */
 __syscall int k_msgq_put(struct k_msgq *q, void *data, s32_t timeout);
 
+/**
+ * @brief Claim the next free slot of a message queue.
+ *
+ * This routine reserves the slot in @a q's ring buffer which the next
+ * message will occupy and returns its address, so that the message can be
+ * built in place instead of being copied in by k_msgq_put(). The message
+ * is sent by k_msgq_put_finish().
+ *
+ * Only one slot can be claimed for writing at a time: until it is
+ * finished, further claims and k_msgq_put() calls fail with -EBUSY.
+ * Threads waiting in k_msgq_get() are woken by k_msgq_put_finish() as
+ * they would be by k_msgq_put().
+ *
+ * The slot lives in the message queue's buffer, so this is only usable by
+ * threads with access to that buffer and is not a system call.
+ *
+ * @note Can be called by ISRs, but @a timeout must be set to K_NO_WAIT.
+ *
+ * @param q Address of the message queue.
+ * @param msg Set to the address of the claimed slot.
+ * @param timeout Waiting period for a slot to become free (in
+ *                milliseconds), or one of the special values K_NO_WAIT and
+ *                K_FOREVER.
+ *
+ * @retval 0 Slot claimed.
+ * @retval -ENOMSG Returned without waiting or queue purged.
+ * @retval -EAGAIN Waiting period timed out.
+ * @retval -EBUSY Another slot is already claimed for writing.
+ */
+extern int k_msgq_put_claim(struct k_msgq *q, void **msg, s32_t timeout);
+
+/**
+ * @brief Send the message built in a claimed slot.
+ *
+ * @note Can be called by ISRs.
+ *
+ * @param q Address of the message queue.
+ *
+ * @retval 0 Message sent.
+ * @retval -EINVAL No slot is claimed for writing.
+ */
+extern int k_msgq_put_finish(struct k_msgq *q);
+
 /**
  * @brief Receive a message from a message queue.
  *
@@ -3311,10 +3789,54 @@ __syscall int k_msgq_put(struct k_msgq *q, void *data, s32_t timeout);
  * @retval 0 Message received.
  * @retval -ENOMSG Returned without waiting.
  * @retval -EAGAIN Waiting period timed out.
+ * @retval -EBUSY A message claimed with k_msgq_get_claim() is outstanding.
  * @req K-MSGQ-002
  */
 __syscall int k_msgq_get(struct k_msgq *q, void *data, s32_t timeout);
 
+/**
+ * @brief Claim the oldest message of a message queue.
+ *
+ * This routine returns the address of the oldest message in @a q's ring
+ * buffer so that it can be processed in place instead of being copied out
+ * by k_msgq_get(). The message is removed, and its slot freed, by
+ * k_msgq_get_finish().
+ *
+ * Only one message can be claimed for reading at a time: until it is
+ * finished, further claims and k_msgq_get() calls fail with -EBUSY.
+ * Threads waiting in k_msgq_put() are woken by k_msgq_get_finish() as
+ * they would be by k_msgq_get().
+ *
+ * The message lives in the message queue's buffer, so this is only usable
+ * by threads with access to that buffer and is not a system call.
+ *
+ * @note Can be called by ISRs, but @a timeout must be set to K_NO_WAIT.
+ *
+ * @param q Address of the message queue.
+ * @param msg Set to the address of the claimed message.
+ * @param timeout Waiting period for a message (in milliseconds), or one
+ *                of the special values K_NO_WAIT and K_FOREVER.
+ *
+ * @retval 0 Message claimed.
+ * @retval -ENOMSG Returned without waiting.
+ * @retval -EAGAIN Waiting period timed out.
+ * @retval -EBUSY Another message is already claimed for reading.
+ */
+extern int k_msgq_get_claim(struct k_msgq *q, void **msg, s32_t timeout);
+
+/**
+ * @brief Release a message claimed with k_msgq_get_claim().
+ *
+ * @note Can be called by ISRs.
+ *
+ * @param q Address of the message queue.
+ *
+ * @retval 0 Message removed from the queue.
+ * @retval -EINVAL No message is claimed for reading, or the queue was
+ *         purged since it was claimed.
+ */
+extern int k_msgq_get_finish(struct k_msgq *q);
+
 /**
  * @brief Peek/read a message from a message queue.
  *
@@ -3635,6 +4157,8 @@ struct k_pipe {
 	size_t         bytes_used;      /**< # bytes used in buffer */
 	size_t         read_index;      /**< Where in buffer to read from */
 	size_t         write_index;     /**< Where in buffer to write */
+	size_t         put_claimed;     /**< # bytes claimed for writing */
+	size_t         get_claimed;     /**< # bytes claimed for reading */
 	struct k_spinlock lock;		/**< Synchronization lock */
 
 	struct {
@@ -3658,6 +4182,8 @@ struct k_pipe {
 	.bytes_used = 0,                                            \
 	.read_index = 0,                                            \
 	.write_index = 0,                                           \
+	.put_claimed = 0,                                           \
+	.get_claimed = 0,                                           \
 	.lock = {},                                                 \
 	.wait_q = {                                                 \
 		.readers = _WAIT_Q_INIT(&obj.wait_q.readers),       \
@@ -3758,6 +4284,7 @@ __syscall int k_pipe_alloc_init(struct k_pipe *pipe, size_t size);
  * @retval -EIO Returned without waiting; zero data bytes were written.
  * @retval -EAGAIN Waiting period timed out; between zero and @a min_xfer
  *                 minus one data bytes were written.
+ * @retval -EBUSY Space claimed with k_pipe_put_claim() is outstanding.
  * @req K-PIPE-002
  */
 __syscall int k_pipe_put(struct k_pipe *pipe, void *data,
@@ -3782,12 +4309,108 @@ __syscall int k_pipe_put(struct k_pipe *pipe, void *data,
  * @retval -EIO Returned without waiting; zero data bytes were read.
  * @retval -EAGAIN Waiting period timed out; between zero and @a min_xfer
  *                 minus one data bytes were read.
+ * @retval -EBUSY Data claimed with k_pipe_get_claim() is outstanding.
  * @req K-PIPE-002
  */
 __syscall int k_pipe_get(struct k_pipe *pipe, void *data,
 			 size_t bytes_to_read, size_t *bytes_read,
 			 size_t min_xfer, s32_t timeout);
 
+/**
+ * @brief Claim free space in a pipe's ring buffer.
+ *
+ * This routine reserves up to @a size contiguous free bytes of @a pipe's
+ * ring buffer, starting where the next data written to the pipe will go,
+ * so that data can be produced in place instead of being copied in by
+ * k_pipe_put(). The data is written to the pipe by k_pipe_put_finish().
+ *
+ * Fewer bytes than requested are claimed when the free space is smaller,
+ * or wraps around the end of the ring buffer. Only one region can be
+ * claimed for writing at a time: until it is finished, further claims and
+ * k_pipe_put() calls fail with -EBUSY. Threads waiting in k_pipe_get() are
+ * served by k_pipe_put_finish() as they would be by k_pipe_put().
+ *
+ * The space lives in the pipe's ring buffer, so this is only usable by
+ * threads with access to that buffer and is not a system call.
+ *
+ * @param pipe Address of the pipe.
+ * @param data Set to the address of the claimed space.
+ * @param size Number of bytes wanted; set to the number of bytes claimed.
+ * @param timeout Waiting period for free space (in milliseconds), or one
+ *                of the special values K_NO_WAIT and K_FOREVER.
+ *
+ * @retval 0 Space claimed.
+ * @retval -EIO Returned without waiting; the ring buffer is full.
+ * @retval -EAGAIN Waiting period timed out.
+ * @retval -EBUSY Space is already claimed for writing.
+ * @retval -EINVAL @a size is zero or the pipe has no ring buffer.
+ */
+extern int k_pipe_put_claim(struct k_pipe *pipe, unsigned char **data,
+			    size_t *size, s32_t timeout);
+
+/**
+ * @brief Write data produced in claimed space to a pipe.
+ *
+ * This routine writes the first @a size bytes of the space claimed by
+ * k_pipe_put_claim() to @a pipe, and releases the claim.
+ *
+ * @param pipe Address of the pipe.
+ * @param size Number of bytes to write, at most the number claimed.
+ *
+ * @retval 0 Data written.
+ * @retval -EINVAL Nothing is claimed for writing, or @a size is larger
+ *         than the claim.
+ */
+extern int k_pipe_put_finish(struct k_pipe *pipe, size_t size);
+
+/**
+ * @brief Claim data in a pipe's ring buffer.
+ *
+ * This routine returns the address of up to @a size contiguous bytes of
+ * the oldest data in @a pipe's ring buffer so that it can be consumed in
+ * place instead of being copied out by k_pipe_get(). The data is removed
+ * from the pipe by k_pipe_get_finish().
+ *
+ * Fewer bytes than requested are claimed when the pipe holds less data,
+ * or the data wraps around the end of the ring buffer. Only one region
+ * can be claimed for reading at a time: until it is finished, further
+ * claims and k_pipe_get() calls fail with -EBUSY. Threads waiting in
+ * k_pipe_put() are served by k_pipe_get_finish() as they would be by
+ * k_pipe_get().
+ *
+ * Data is only ever claimed from the ring buffer, so a pipe without one
+ * cannot be read from this way.
+ *
+ * @param pipe Address of the pipe.
+ * @param data Set to the address of the claimed data.
+ * @param size Number of bytes wanted; set to the number of bytes claimed.
+ * @param timeout Waiting period for data (in milliseconds), or one of the
+ *                special values K_NO_WAIT and K_FOREVER.
+ *
+ * @retval 0 Data claimed.
+ * @retval -EIO Returned without waiting; the ring buffer is empty.
+ * @retval -EAGAIN Waiting period timed out.
+ * @retval -EBUSY Data is already claimed for reading.
+ * @retval -EINVAL @a size is zero or the pipe has no ring buffer.
+ */
+extern int k_pipe_get_claim(struct k_pipe *pipe, unsigned char **data,
+			    size_t *size, s32_t timeout);
+
+/**
+ * @brief Remove claimed data from a pipe.
+ *
+ * This routine removes the first @a size bytes of the data claimed by
+ * k_pipe_get_claim() from @a pipe, and releases the claim.
+ *
+ * @param pipe Address of the pipe.
+ * @param size Number of bytes consumed, at most the number claimed.
+ *
+ * @retval 0 Data removed.
+ * @retval -EINVAL Nothing is claimed for reading, or @a size is larger
+ *         than the claim.
+ */
+extern int k_pipe_get_finish(struct k_pipe *pipe, size_t size);
+
 /**
  * @brief Write memory block to a pipe.
  *
@@ -3800,6 +4423,8 @@ __syscall int k_pipe_get(struct k_pipe *pipe, void *data,
  * @param size Number of data bytes in memory block to send
  * @param sem Semaphore to signal upon completion (else NULL)
  *
+ * @note Must not be called while space is claimed with k_pipe_put_claim().
+ *
  * @return N/A
  * @req K-PIPE-002
  */
@@ -3812,13 +4437,31 @@ extern void k_pipe_block_put(struct k_pipe *pipe, struct k_mem_block *block,
  * @cond INTERNAL_HIDDEN
  */
 
+#ifdef CONFIG_MEM_SLAB_PERCPU_CACHE
+/* Keep each CPU's magazine off the others' cache lines. Statically
+ * defined slabs keep this alignment in their linker section.
+ */
+struct k_mem_slab_cache {
+	struct k_spinlock lock;
+	u32_t count;
+	char *head;
+} __aligned(64);
+#endif
+
 struct k_mem_slab {
 	_wait_q_t wait_q;
 	u32_t num_blocks;
 	size_t block_size;
 	char *buffer;
 	char *free_list;
+	/* With per-CPU caches, this counts blocks not on free_list,
+	 * i.e. including those held in the CPU magazines
+	 */
 	u32_t num_used;
+#ifdef CONFIG_MEM_SLAB_PERCPU_CACHE
+	u32_t num_waiters;
+	struct k_mem_slab_cache cache[CONFIG_MP_NUM_CPUS];
+#endif
 
 	_OBJECT_TRACING_NEXT_PTR(k_mem_slab)
 };
@@ -3945,7 +4588,20 @@ extern void k_mem_slab_free(struct k_mem_slab *slab, void **mem);
  */
 static inline u32_t k_mem_slab_num_used_get(struct k_mem_slab *slab)
 {
+#ifdef CONFIG_MEM_SLAB_PERCPU_CACHE
+	/* Unlocked snapshot: a concurrent refill or drain can make
+	 * the magazines look fuller than num_used accounts for
+	 */
+	u32_t used = slab->num_used, cached = 0;
+
+	for (int i = 0; i < CONFIG_MP_NUM_CPUS; i++) {
+		cached += slab->cache[i].count;
+	}
+
+	return used > cached ? used - cached : 0;
+#else
 	return slab->num_used;
+#endif
 }
 
 /**
@@ -3961,7 +4617,7 @@ static inline u32_t k_mem_slab_num_used_get(struct k_mem_slab *slab)
  */
 static inline u32_t k_mem_slab_num_free_get(struct k_mem_slab *slab)
 {
-	return slab->num_blocks - slab->num_used;
+	return slab->num_blocks - k_mem_slab_num_used_get(slab);
 }
 
 /** @} */
@@ -4078,6 +4734,118 @@ extern void k_mem_pool_free(struct k_mem_block *block);
  */
 extern void k_mem_pool_free_id(struct k_mem_block_id *id);
 
+/**
+ * @}
+ */
+
+/**
+ * @cond INTERNAL_HIDDEN
+ */
+
+struct k_heap {
+	struct sys_tlsf heap;
+	_wait_q_t wait_q;
+	struct k_spinlock lock;
+};
+
+/**
+ * INTERNAL_HIDDEN @endcond
+ */
+
+/**
+ * @defgroup kheap_apis Kernel Heap APIs
+ * @ingroup kernel_apis
+ * @{
+ */
+
+/**
+ * @brief Statically define and initialize a kernel heap.
+ *
+ * A kernel heap hands out blocks of arbitrary size from a single memory
+ * region using a two-level segregated fit allocator: allocation and
+ * release take constant time, blocks are only rounded up to pointer
+ * alignment, and adjacent free blocks are merged on release.  A small
+ * part of the region is used for the heap's own free list heads.
+ *
+ * If the heap is to be accessed outside the module where it is defined,
+ * it can be declared via
+ *
+ * @code extern struct k_heap <name>; @endcode
+ *
+ * @param name Name of the heap.
+ * @param bytes Size of the heap's memory region (in bytes).
+ */
+#define K_HEAP_DEFINE(name, bytes)					\
+	char __aligned(sizeof(void *)) _k_heap_buf_##name[bytes];	\
+	struct k_heap name __in_section(_k_heap, static, name) = {	\
+		.heap = {						\
+			.buf = _k_heap_buf_##name,			\
+			.size = bytes,					\
+		},							\
+	}
+
+/**
+ * @brief Initialize a kernel heap.
+ *
+ * This routine initializes a heap over a caller-provided memory region,
+ * for heaps that are not defined with K_HEAP_DEFINE().
+ *
+ * @param h Address of the heap.
+ * @param mem Start of the heap's memory region, at least pointer aligned.
+ * @param bytes Size of the memory region (in bytes).
+ *
+ * @return N/A
+ */
+extern void k_heap_init(struct k_heap *h, void *mem, size_t bytes);
+
+/**
+ * @brief Allocate memory from a kernel heap.
+ *
+ * If no free block is large enough, the calling thread may wait for
+ * other threads to release memory.  The returned memory is aligned to
+ * the size of a pointer.
+ *
+ * @param h Address of the heap.
+ * @param bytes Amount of memory to allocate (in bytes).
+ * @param timeout Maximum time to wait for operation to complete
+ *        (in milliseconds). Use K_NO_WAIT to return without waiting,
+ *        or K_FOREVER to wait as long as necessary.
+ *
+ * @return Address of the allocated memory if successful; otherwise NULL.
+ */
+extern void *k_heap_alloc(struct k_heap *h, size_t bytes, s32_t timeout);
+
+/**
+ * @brief Allocate aligned memory from a kernel heap.
+ *
+ * As k_heap_alloc(), but the returned memory is aligned to @a align
+ * bytes.
+ *
+ * @param h Address of the heap.
+ * @param align Required alignment (in bytes, a power of two).
+ * @param bytes Amount of memory to allocate (in bytes).
+ * @param timeout Maximum time to wait for operation to complete
+ *        (in milliseconds). Use K_NO_WAIT to return without waiting,
+ *        or K_FOREVER to wait as long as necessary.
+ *
+ * @return Address of the allocated memory if successful; otherwise NULL.
+ */
+extern void *k_heap_aligned_alloc(struct k_heap *h, size_t align,
+				  size_t bytes, s32_t timeout);
+
+/**
+ * @brief Free memory allocated from a kernel heap.
+ *
+ * Any threads waiting for memory on the heap are woken up to retry
+ * their allocations.  If @a mem is NULL, no operation is performed.
+ *
+ * @param h Address of the heap the memory was allocated from.
+ * @param mem Address returned by k_heap_alloc() or k_heap_aligned_alloc().
+ *
+ * @return N/A
+ */
+extern void k_heap_free(struct k_heap *h, void *mem);
+
 /**
  * @}
  */
@@ -4436,6 +5204,146 @@ __syscall void k_poll_signal_check(struct k_poll_signal *signal,
 
 __syscall int k_poll_signal_raise(struct k_poll_signal *signal, int result);
 
+/* public - persistent poll set object */
+struct k_pollset {
+	/* PRIVATE - DO NOT TOUCH */
+	_wait_q_t wait_q;
+
+	/* shared by all member events, a NULL thread marks them as such */
+	struct _poller poller;
+
+	/* members whose object became available, not yet reported */
+	sys_dlist_t ready;
+
+	/* members returned by k_pollset_wait(), to be re-armed by the
+	 * next call, whichever thread makes it
+	 */
+	sys_dlist_t reported;
+
+	/* protects the lists above, which are also updated with the lock
+	 * of the member objects held
+	 */
+	struct k_spinlock lock;
+
+	/* member storage, a K_POLL_TYPE_IGNORE entry is a free slot */
+	struct k_poll_event *events;
+	int max_events;
+};
+
+#define _K_POLLSET_INITIALIZER(obj, pollset_events, pollset_max_events) \
+	{ \
+	.wait_q = _WAIT_Q_INIT(&obj.wait_q), \
+	.poller = { .thread = NULL, .is_polling = false }, \
+	.ready = SYS_DLIST_STATIC_INIT(&obj.ready), \
+	.reported = SYS_DLIST_STATIC_INIT(&obj.reported), \
+	.events = pollset_events, \
+	.max_events = pollset_max_events, \
+	}
+
+/**
+ * @brief Statically define and initialize a poll set.
+ *
+ * The poll set can be accessed outside the module where it is defined using:
+ *
+ * @code extern struct k_pollset <name>; @endcode
+ *
+ * @param name Name of the poll set.
+ * @param max_events Maximum number of objects the poll set can watch.
+ */
+#define K_POLLSET_DEFINE(name, max_events) \
+	static struct k_poll_event _k_pollset_events_##name[max_events]; \
+	struct k_pollset name = \
+		_K_POLLSET_INITIALIZER(name, _k_pollset_events_##name, \
+				       max_events)
+
+/**
+ * @brief Initialize a poll set.
+ *
+ * A poll set keeps its events registered on the objects they watch from
+ * one wait to the next, unlike k_poll() which registers and unregisters
+ * every event on each call. Waiting on a poll set thus costs time
+ * proportional to the number of events that became ready, not to the
+ * number of objects watched, which pays off for event loops watching
+ * many objects at once.
+ *
+ * The member storage must remain valid, and must not be touched, for as
+ * long as the poll set is in use.
+ *
+ * @param set Address of the poll set.
+ * @param events Storage for the member events.
+ * @param max_events Number of entries in @a events.
+ *
+ * @return N/A
+ */
+extern void k_pollset_init(struct k_pollset *set, struct k_poll_event *events,
+			   int max_events);
+
+/**
+ * @brief Add an object to a poll set.
+ *
+ * Starts watching @a obj for the condition given by @a type. An object
+ * can be a member of a given poll set only once. If the condition is
+ * already met, the event is immediately reported to k_pollset_wait().
+ *
+ * As with k_poll(), threads pending on the object itself have precedence
+ * over the poll set, as do threads calling k_poll() on it.
+ *
+ * @param set Address of the poll set.
+ * @param type One of K_POLL_TYPE_SIGNAL, K_POLL_TYPE_SEM_AVAILABLE or
+ *             K_POLL_TYPE_DATA_AVAILABLE.
+ * @param obj Kernel object or poll signal, matching @a type.
+ * @param tag User-defined value (8 bits) reported along with the event.
+ *
+ * @retval 0 Object added.
+ * @retval -EINVAL Invalid event type.
+ * @retval -EEXIST Object already a member of the poll set.
+ * @retval -ENOMEM Poll set full.
+ */
+__syscall int k_pollset_add(struct k_pollset *set, u32_t type, void *obj,
+			    u32_t tag);
+
+/**
+ * @brief Remove an object from a poll set.
+ *
+ * @param set Address of the poll set.
+ * @param obj Object passed to k_pollset_add().
+ *
+ * @retval 0 Object removed.
+ * @retval -ENOENT Object not a member of the poll set.
+ */
+__syscall int k_pollset_del(struct k_pollset *set, void *obj);
+
+/**
+ * @brief Wait for members of a poll set to become ready.
+ *
+ * Copies up to @a max_events ready events to @a events, with their
+ * type, tag, object and state fields set as k_poll() would. Events not
+ * returned because @a events is full are returned by the next call.
+ *
+ * Reporting is level triggered: an event returned by one call is
+ * returned again by the next one if its condition still holds at that
+ * point, e.g. if the semaphore it watches has not been taken or the poll
+ * signal has not been reset.
+ *
+ * Several threads may wait on the same poll set, each ready event is
+ * then returned to only one of them. The event is checked again by the
+ * next call of k_pollset_wait(), made by any of the threads, and so may
+ * be returned to another one if its condition has not been consumed by
+ * then.
+ *
+ * @param set Address of the poll set.
+ * @param events Array receiving the ready events.
+ * @param max_events Number of entries in @a events.
+ * @param timeout Waiting period for an event to be ready (in milliseconds),
+ *                or one of the special values K_NO_WAIT and K_FOREVER.
+ *
+ * @return Number of events copied to @a events.
+ * @retval -EAGAIN Waiting period timed out.
+ * @retval -EINVAL Bad parameters (user mode only).
+ */
+__syscall int k_pollset_wait(struct k_pollset *set, struct k_poll_event *events,
+			     int max_events, s32_t timeout);
+
 /**
  * @internal
  */
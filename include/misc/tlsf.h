@@ -0,0 +1,131 @@
+/*
+ * Copyright (c) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef ZEPHYR_INCLUDE_MISC_TLSF_H_
+#define ZEPHYR_INCLUDE_MISC_TLSF_H_
+
+#include <zephyr/types.h>
+#include <stddef.h>
+
+/*
+ * Two-level segregated fit heap.
+ *
+ * Free blocks are kept in segregated lists indexed by a first level
+ * (power of two) and a second level (linear subdivision of that power
+ * of two), with a bitmap at each level so that a suitable list can be
+ * found with two find-first-set operations.  Allocation and free run
+ * in constant time regardless of heap history, blocks are sized to
+ * the request (rounded to pointer alignment) rather than to a block
+ * level, and adjacent free blocks are always coalesced.
+ *
+ * A sys_tlsf heap carries no lock of its own: callers are responsible
+ * for serializing access, see struct k_heap for a kernel object
+ * wrapper and the minimal libc malloc() for a user mode one.
+ */
+
+struct sys_tlsf_block;
+
+struct sys_tlsf {
+	/* Region handed to sys_tlsf_init() */
+	void *buf;
+	size_t size;
+
+	/* Control data, carved from the start of buf */
+	u32_t fl_bitmap;
+	u8_t fl_count;
+	u32_t *sl_bitmap;
+	struct sys_tlsf_block **free_lists;
+
+	/* Sum of the payload sizes of all free blocks */
+	size_t free_bytes;
+};
+
+/**
+ * @brief Initialize a TLSF heap
+ *
+ * Prepares the @a bytes of memory at @a mem for use as a heap.  A
+ * small part of the region (a bitmap word and a list of free list
+ * heads per power of two spanned by the region) is used for the
+ * heap's own bookkeeping.
+ *
+ * @param h Heap to initialize
+ * @param mem Memory region, at least pointer aligned
+ * @param bytes Size of the memory region
+ */
+void sys_tlsf_init(struct sys_tlsf *h, void *mem, size_t bytes);
+
+/**
+ * @brief Allocate memory from a TLSF heap
+ *
+ * The returned memory is aligned to the size of a pointer.
+ *
+ * @param h Heap to allocate from
+ * @param bytes Number of bytes requested
+ * @return Pointer to the allocated memory, or NULL if the request
+ *         cannot be satisfied or @a bytes is zero
+ */
+void *sys_tlsf_alloc(struct sys_tlsf *h, size_t bytes);
+
+/**
+ * @brief Allocate aligned memory from a TLSF heap
+ *
+ * As sys_tlsf_alloc(), but the returned memory is aligned to @a align
+ * bytes, which must be a power of two.
+ *
+ * @param h Heap to allocate from
+ * @param align Required alignment of the returned memory
+ * @param bytes Number of bytes requested
+ * @return Pointer to the allocated memory, or NULL
+ */
+void *sys_tlsf_aligned_alloc(struct sys_tlsf *h, size_t align, size_t bytes);
+
+/**
+ * @brief Free memory allocated from a TLSF heap
+ *
+ * The block is merged with any free physical neighbours.  Passing
+ * NULL is a no-op.
+ *
+ * @param h Heap the memory was allocated from
+ * @param mem Pointer returned by sys_tlsf_alloc() or
+ *            sys_tlsf_aligned_alloc()
+ */
+void sys_tlsf_free(struct sys_tlsf *h, void *mem);
+
+/**
+ * @brief Return the usable size of an allocated block
+ *
+ * This is at least the number of bytes requested at allocation time.
+ *
+ * @param mem Pointer returned by sys_tlsf_alloc() or
+ *            sys_tlsf_aligned_alloc()
+ * @return Number of bytes usable at @a mem
+ */
+size_t sys_tlsf_usable_size(void *mem);
+
+/**
+ * @brief Return the size of the largest free block
+ *
+ * Together with sys_tlsf_free_bytes() this gives a measure of external
+ * fragmentation.  Unlike the allocation paths this walks one free list
+ * and is meant for diagnostics only.
+ *
+ * @param h Heap to inspect
+ * @return Payload size of the largest free block
+ */
+size_t sys_tlsf_largest_free(struct sys_tlsf *h);
+
+/**
+ * @brief Return the number of free bytes in a TLSF heap
+ *
+ * @param h Heap to inspect
+ * @return Free bytes, not counting block headers
+ */
+static inline size_t sys_tlsf_free_bytes(struct sys_tlsf *h)
+{
+	return h->free_bytes;
+}
+
+#endif /* ZEPHYR_INCLUDE_MISC_TLSF_H_ */
@@ -0,0 +1,41 @@
+/*
+ * Copyright (c) 2019 Intel Corporation.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef ZEPHYR_INCLUDE_NET_LOOPBACK_H_
+#define ZEPHYR_INCLUDE_NET_LOOPBACK_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Loopback driver support functions
+ * @defgroup loopback Loopback driver Support Functions
+ * @ingroup networking
+ * @{
+ */
+
+#if defined(CONFIG_NET_LOOPBACK_SIMULATE_PACKET_DROP)
+/**
+ * @brief Drop packets sent over the loopback interface
+ *
+ * Every interval-th packet sent is dropped instead of being received
+ * back, to exercise the loss recovery of the protocols.
+ *
+ * @param interval Packets sent per dropped packet, 0 to drop none.
+ */
+void loopback_set_packet_drop_interval(unsigned int interval);
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+/**
+ * @}
+ */
+
+#endif /* ZEPHYR_INCLUDE_NET_LOOPBACK_H_ */
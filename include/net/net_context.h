@@ -270,6 +270,18 @@ struct net_context {
 	/** TLS context information */
 	struct tls_context *tls;
 #endif /* CONFIG_NET_SOCKETS_SOCKOPT_TLS */
+
+#if defined(CONFIG_NET_SOCKETS_EPOLL)
+	/** Epoll instance entries watching this socket */
+	sys_slist_t epoll_items;
+#endif /* CONFIG_NET_SOCKETS_EPOLL */
+
+#if defined(CONFIG_NET_SOCKETS_ZERO_COPY)
+	/** Bumped when the socket is closed, tells a stale zero copy
+	 * packet release apart from one for the current socket.
+	 */
+	u32_t zc_gen;
+#endif /* CONFIG_NET_SOCKETS_ZERO_COPY */
 #endif /* CONFIG_NET_SOCKETS */
 
 #if defined(CONFIG_NET_OFFLOAD)
@@ -871,6 +883,92 @@ int net_context_sendto_new(struct net_context *context,
 			   void *token,
 			   void *user_data);
 
+/**
+ * @brief Send a chain of network buffers to a peer without copying it.
+ *
+ * @details This works like net_context_send_new() but the payload is
+ * given as a net_buf chain built by the caller, which is linked into
+ * the outgoing packet as is. Only UDP and TCP contexts are supported.
+ * The whole chain is sent as one datagram or one TCP segment, so it
+ * must fit into the interface MTU or the TCP send MSS.
+ *
+ * On success the stack takes over the caller's reference to the chain
+ * and releases it, back to the pools the buffers came from, once the
+ * data has been sent (and acknowledged for TCP). The chain must not
+ * be modified after that. On error the chain is left to the caller.
+ *
+ * @param context The network context to use.
+ * @param frags The net_buf chain holding the payload.
+ * @param cb Caller-supplied callback function.
+ * @param timeout Timeout for the connection. Possible values
+ * are K_FOREVER, K_NO_WAIT, >0.
+ * @param token Caller specified value that is passed as is to callback.
+ * @param user_data Caller-supplied user data.
+ *
+ * @return numbers of bytes sent on success, a negative errno otherwise
+ */
+int net_context_send_buf(struct net_context *context,
+			 struct net_buf *frags,
+			 net_context_send_cb_t cb,
+			 s32_t timeout,
+			 void *token,
+			 void *user_data);
+
+/**
+ * @brief Send a chain of network buffers to a peer specified by address
+ * without copying it.
+ *
+ * @details This works like net_context_sendto_new() with the payload
+ * given as a net_buf chain, see net_context_send_buf() for the
+ * ownership rules.
+ *
+ * @param context The network context to use.
+ * @param frags The net_buf chain holding the payload.
+ * @param dst_addr Destination address.
+ * @param addrlen Length of the address.
+ * @param cb Caller-supplied callback function.
+ * @param timeout Timeout for the connection. Possible values
+ * are K_FOREVER, K_NO_WAIT, >0.
+ * @param token Caller specified value that is passed as is to callback.
+ * @param user_data Caller-supplied user data.
+ *
+ * @return numbers of bytes sent on success, a negative errno otherwise
+ */
+int net_context_sendto_buf(struct net_context *context,
+			   struct net_buf *frags,
+			   const struct sockaddr *dst_addr,
+			   socklen_t addrlen,
+			   net_context_send_cb_t cb,
+			   s32_t timeout,
+			   void *token,
+			   void *user_data);
+
+/**
+ * @brief Send data gathered from an array of buffers.
+ *
+ * @details This works like net_context_sendto_new(), with the data taken
+ * from the msg_iov buffers of the message header, which are written
+ * one after the other into a single packet. The destination is msg_name,
+ * or the connected peer if msg_name is NULL. Ancillary data is ignored.
+ * This is similar as BSD sendmsg() function.
+ *
+ * @param context The network context to use.
+ * @param msghdr The message header describing the data and destination.
+ * @param cb Caller-supplied callback function.
+ * @param timeout Timeout for the connection. Possible values
+ * are K_FOREVER, K_NO_WAIT, >0.
+ * @param token Caller specified value that is passed as is to callback.
+ * @param user_data Caller-supplied user data.
+ *
+ * @return numbers of bytes sent on success, a negative errno otherwise
+ */
+int net_context_sendmsg(struct net_context *context,
+			const struct msghdr *msghdr,
+			net_context_send_cb_t cb,
+			s32_t timeout,
+			void *token,
+			void *user_data);
+
 /**
  * @brief Receive network data from a peer specified by context.
  *
@@ -218,6 +218,71 @@ struct sockaddr_storage {
 	char data[NET_SOCKADDR_MAX_SIZE - sizeof(sa_family_t)];
 };
 
+/** Scatter/gather array element, as defined by POSIX */
+struct iovec {
+	void  *iov_base;
+	size_t iov_len;
+};
+
+/** Message header used by sendmsg() and recvmsg() */
+struct msghdr {
+	void         *msg_name;       /* optional socket address */
+	socklen_t     msg_namelen;    /* size of socket address */
+	struct iovec *msg_iov;        /* scatter/gather array */
+	size_t        msg_iovlen;     /* number of elements in msg_iov */
+	void         *msg_control;    /* ancillary data */
+	size_t        msg_controllen; /* ancillary data buffer length */
+	int           msg_flags;      /* flags on received message */
+};
+
+/** Ancillary data object header, followed by the data itself */
+struct cmsghdr {
+	socklen_t cmsg_len;    /* data byte count, including header */
+	int       cmsg_level;  /* originating protocol */
+	int       cmsg_type;   /* protocol-specific type */
+};
+
+/** @cond INTERNAL_HIDDEN */
+#define NET_CMSG_ALIGN(len) ROUND_UP(len, sizeof(void *))
+/** @endcond */
+
+#define CMSG_DATA(cmsg) \
+	((unsigned char *)(cmsg) + NET_CMSG_ALIGN(sizeof(struct cmsghdr)))
+#define CMSG_SPACE(len) \
+	(NET_CMSG_ALIGN(sizeof(struct cmsghdr)) + NET_CMSG_ALIGN(len))
+#define CMSG_LEN(len) (NET_CMSG_ALIGN(sizeof(struct cmsghdr)) + (len))
+
+#define CMSG_FIRSTHDR(msg)					\
+	((msg)->msg_controllen >= sizeof(struct cmsghdr) ?	\
+	 (struct cmsghdr *)(msg)->msg_control : NULL)
+
+#define CMSG_NXTHDR(msg, cmsg)						\
+	(((unsigned char *)(cmsg) + NET_CMSG_ALIGN((cmsg)->cmsg_len) +	\
+	  sizeof(struct cmsghdr) >					\
+	  (unsigned char *)(msg)->msg_control + (msg)->msg_controllen) ? \
+	 NULL :								\
+	 (struct cmsghdr *)((unsigned char *)(cmsg) +			\
+			    NET_CMSG_ALIGN((cmsg)->cmsg_len)))
+
+/**
+ * @brief Get the total length of the buffers of a message.
+ *
+ * @param msg Message header
+ *
+ * @return Sum of the lengths of all msg_iov entries.
+ */
+static inline size_t net_msghdr_len(const struct msghdr *msg)
+{
+	size_t len = 0;
+	size_t i;
+
+	for (i = 0; i < msg->msg_iovlen; i++) {
+		len += msg->msg_iov[i].iov_len;
+	}
+
+	return len;
+}
+
 struct net_addr {
 	sa_family_t family;
 	union {
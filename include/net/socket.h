@@ -55,8 +55,22 @@ typedef struct zsock_fd_set {
 #define ZSOCK_POLLHUP 0x10
 #define ZSOCK_POLLNVAL 0x20
 
+/* Values are compatible with Linux */
+#define ZSOCK_EPOLLIN ZSOCK_POLLIN
+#define ZSOCK_EPOLLOUT ZSOCK_POLLOUT
+#define ZSOCK_EPOLLERR ZSOCK_POLLERR
+#define ZSOCK_EPOLLHUP ZSOCK_POLLHUP
+#define ZSOCK_EPOLLONESHOT (1U << 30)
+#define ZSOCK_EPOLLET (1U << 31)
+
+#define ZSOCK_EPOLL_CTL_ADD 1
+#define ZSOCK_EPOLL_CTL_DEL 2
+#define ZSOCK_EPOLL_CTL_MOD 3
+
 #define ZSOCK_MSG_PEEK 0x02
+#define ZSOCK_MSG_TRUNC 0x20
 #define ZSOCK_MSG_DONTWAIT 0x40
+#define ZSOCK_MSG_WAITFORONE 0x10000
 
 /* Well-known values, e.g. from Linux man 2 shutdown:
  * "The constants SHUT_RD, SHUT_WR, SHUT_RDWR have the value 0, 1, 2,
@@ -120,6 +134,25 @@ typedef struct zsock_fd_set {
 
 /** @} */
 
+/** Message vector element used by sendmmsg() and recvmmsg() */
+struct zsock_mmsghdr {
+	struct msghdr msg_hdr;  /* message header */
+	unsigned int msg_len;   /* number of bytes transmitted */
+};
+
+/** User data returned with the events of a socket by epoll_wait() */
+typedef union zsock_epoll_data {
+	void *ptr;
+	int fd;
+	u32_t u32;
+	u64_t u64;
+} zsock_epoll_data_t;
+
+struct zsock_epoll_event {
+	u32_t events;             /* ZSOCK_EPOLL* event mask */
+	zsock_epoll_data_t data;  /* returned as is by epoll_wait() */
+};
+
 struct zsock_addrinfo {
 	struct zsock_addrinfo *ai_next;
 	int ai_flags;
@@ -170,10 +203,175 @@ static inline ssize_t zsock_recv(int sock, void *buf, size_t max_len,
 	return zsock_recvfrom(sock, buf, max_len, flags, NULL, NULL);
 }
 
+/**
+ * @brief Send a message gathered from an array of buffers
+ *
+ * @details The destination is taken from msg_name, or from the connected
+ * peer if it is NULL. Ancillary data in msg_control is ignored.
+ *
+ * @return Number of bytes sent, -1 with errno set on error
+ */
+__syscall ssize_t zsock_sendmsg(int sock, const struct msghdr *msg,
+				int flags);
+
+/**
+ * @brief Receive a message scattered into an array of buffers
+ *
+ * @details For datagram sockets one datagram is received, and
+ * ZSOCK_MSG_TRUNC is set in msg_flags if it did not fit. The source
+ * address is stored into msg_name if it is not NULL. msg_controllen is
+ * set to the length of the ancillary data returned.
+ *
+ * @return Number of bytes received, -1 with errno set on error
+ */
+__syscall ssize_t zsock_recvmsg(int sock, struct msghdr *msg, int flags);
+
+/**
+ * @brief Send several messages with a single call
+ *
+ * @details Sends the messages of msgvec in order, as sendmsg() would, and
+ * stores the number of bytes sent for each into msg_len. Stops at the
+ * first message that cannot be sent.
+ *
+ * @return Number of messages sent, -1 with errno set if none was sent
+ */
+__syscall int zsock_sendmmsg(int sock, struct zsock_mmsghdr *msgvec,
+			     unsigned int vlen, int flags);
+
+/**
+ * @brief Receive several messages with a single call
+ *
+ * @details Receives up to vlen messages into msgvec, as recvmsg() would.
+ * With ZSOCK_MSG_WAITFORONE only the first message is waited for, the
+ * call then returns with what is already queued. If timeout is not NULL,
+ * no more messages are received once it has expired; like on Linux it
+ * does not bound the wait for a single message.
+ *
+ * @return Number of messages received, -1 with errno set if none was
+ * received
+ */
+__syscall int zsock_recvmmsg(int sock, struct zsock_mmsghdr *msgvec,
+			     unsigned int vlen, int flags,
+			     struct zsock_timeval *timeout);
+
+#if defined(CONFIG_NET_SOCKETS_ZERO_COPY)
+struct net_pkt;
+struct net_buf;
+
+/**
+ * @brief Receive data from a socket without copying it
+ *
+ * @details Takes the next received packet off the socket and lends it
+ * to the caller, whose cursor points to the payload. The payload is
+ * read in place, e.g. with net_pkt_read_new() or by walking the
+ * net_buf fragments from the cursor. The packet must be handed back
+ * with zsock_recv_zc_release(), which frees the buffers and, for a
+ * stream socket, reopens the receive window. Only the data that was
+ * not yet read by zsock_recv() is lent.
+ *
+ * Works on native UDP and TCP sockets only, and must not be called from
+ * user mode. MSG_PEEK is not supported.
+ *
+ * @param sock Socket descriptor
+ * @param pkt Set to the lent packet, or NULL when the peer closed
+ * @param flags MSG_DONTWAIT or 0
+ * @param src_addr Where to store the source address, or NULL
+ * @param addrlen Value-result length of src_addr, or NULL
+ *
+ * @return Payload length, 0 on end of stream, -1 with errno set on error
+ */
+ssize_t zsock_recvfrom_zc(int sock, struct net_pkt **pkt, int flags,
+			  struct sockaddr *src_addr, socklen_t *addrlen);
+
+/**
+ * @brief Give back a packet lent by zsock_recvfrom_zc()
+ *
+ * @param sock Socket descriptor the packet was received on
+ * @param pkt Packet returned by zsock_recvfrom_zc()
+ */
+void zsock_recv_zc_release(int sock, struct net_pkt *pkt);
+
+/**
+ * @brief Send a caller built net_buf chain without copying it
+ *
+ * @details The chain is linked into the outgoing packet as is and must
+ * fit into one datagram, or one TCP segment of the connection's send
+ * MSS. Buffers should come from the network TX data pool, e.g. via
+ * net_pkt_get_reserve_tx_data(). On success the socket owns the chain
+ * and releases it once sent; the caller must not touch it any more.
+ * On error the chain still belongs to the caller.
+ *
+ * Works on native UDP and TCP sockets only, and must not be called from
+ * user mode.
+ *
+ * @param sock Socket descriptor
+ * @param buf The net_buf chain holding the payload
+ * @param flags MSG_DONTWAIT or 0
+ * @param dest_addr Destination address, NULL for a connected socket
+ * @param addrlen Length of dest_addr
+ *
+ * @return Number of bytes sent, -1 with errno set on error
+ */
+ssize_t zsock_sendto_zc(int sock, struct net_buf *buf, int flags,
+			const struct sockaddr *dest_addr, socklen_t addrlen);
+#endif /* CONFIG_NET_SOCKETS_ZERO_COPY */
+
 __syscall int zsock_fcntl(int sock, int cmd, int flags);
 
 __syscall int zsock_poll(struct zsock_pollfd *fds, int nfds, int timeout);
 
+/**
+ * @brief Create an epoll instance
+ *
+ * @details Requires CONFIG_NET_SOCKETS_EPOLL. The returned descriptor is
+ * released with zsock_close().
+ *
+ * @param flags Must be 0
+ *
+ * @return Descriptor of the instance, -1 with errno set on error
+ */
+__syscall int zsock_epoll_create1(int flags);
+
+/**
+ * @brief Add, modify or remove a socket of an epoll interest list
+ *
+ * @details op is one of ZSOCK_EPOLL_CTL_ADD, ZSOCK_EPOLL_CTL_MOD or
+ * ZSOCK_EPOLL_CTL_DEL. ZSOCK_EPOLLIN and ZSOCK_EPOLLOUT are the events
+ * that can be watched, the latter is always reported as with poll().
+ * Readiness is level-triggered by default, ZSOCK_EPOLLET makes it
+ * edge-triggered and ZSOCK_EPOLLONESHOT disables the socket once
+ * reported, until it is rearmed with ZSOCK_EPOLL_CTL_MOD. A closed socket
+ * is removed from the interest lists. Only native TCP and UDP sockets can
+ * be watched, EPERM is returned for other descriptors.
+ *
+ * @param epfd Descriptor of the epoll instance
+ * @param op Operation
+ * @param fd Socket descriptor
+ * @param event Events to watch and user data, ignored for
+ * ZSOCK_EPOLL_CTL_DEL
+ *
+ * @return 0 on success, -1 with errno set on error
+ */
+__syscall int zsock_epoll_ctl(int epfd, int op, int fd,
+			      struct zsock_epoll_event *event);
+
+/**
+ * @brief Wait for sockets of an epoll interest list to become ready
+ *
+ * @details Only the sockets that are ready are visited, so the cost does
+ * not depend on the number of sockets watched.
+ *
+ * @param epfd Descriptor of the epoll instance
+ * @param events Array receiving the events and user data of ready sockets
+ * @param maxevents Size of events, must be greater than 0
+ * @param timeout Timeout in milliseconds, -1 to wait forever
+ *
+ * @return Number of ready sockets stored into events, 0 on timeout, -1
+ * with errno set on error
+ */
+__syscall int zsock_epoll_wait(int epfd, struct zsock_epoll_event *events,
+			       int maxevents, int timeout);
+
 /* select() API is inefficient, and implemented as inefficient wrapper on
  * top of poll(). Avoid select(), use poll directly().
  */
@@ -265,6 +463,31 @@ static inline ssize_t recv(int sock, void *buf, size_t max_len, int flags)
 	return zsock_recv(sock, buf, max_len, flags);
 }
 
+static inline ssize_t sendmsg(int sock, const struct msghdr *msg, int flags)
+{
+	return zsock_sendmsg(sock, msg, flags);
+}
+
+static inline ssize_t recvmsg(int sock, struct msghdr *msg, int flags)
+{
+	return zsock_recvmsg(sock, msg, flags);
+}
+
+#define mmsghdr zsock_mmsghdr
+
+static inline int sendmmsg(int sock, struct zsock_mmsghdr *msgvec,
+			   unsigned int vlen, int flags)
+{
+	return zsock_sendmmsg(sock, msgvec, vlen, flags);
+}
+
+static inline int recvmmsg(int sock, struct zsock_mmsghdr *msgvec,
+			   unsigned int vlen, int flags,
+			   struct zsock_timeval *timeout)
+{
+	return zsock_recvmmsg(sock, msgvec, vlen, flags, timeout);
+}
+
 /* This conflicts with fcntl.h, so code must include fcntl.h before socket.h: */
 #define fcntl zsock_fcntl
 
@@ -286,6 +509,36 @@ static inline int poll(struct zsock_pollfd *fds, int nfds, int timeout)
 	return zsock_poll(fds, nfds, timeout);
 }
 
+#define epoll_event zsock_epoll_event
+#define epoll_data_t zsock_epoll_data_t
+
+static inline int epoll_create1(int flags)
+{
+	return zsock_epoll_create1(flags);
+}
+
+static inline int epoll_create(int size)
+{
+	if (size <= 0) {
+		errno = EINVAL;
+		return -1;
+	}
+
+	return zsock_epoll_create1(0);
+}
+
+static inline int epoll_ctl(int epfd, int op, int fd,
+			    struct zsock_epoll_event *event)
+{
+	return zsock_epoll_ctl(epfd, op, fd, event);
+}
+
+static inline int epoll_wait(int epfd, struct zsock_epoll_event *events,
+			     int maxevents, int timeout)
+{
+	return zsock_epoll_wait(epfd, events, maxevents, timeout);
+}
+
 static inline int select(int nfds, zsock_fd_set *readfds,
 			 zsock_fd_set *writefds, zsock_fd_set *exceptfds,
 			 struct timeval *timeout)
@@ -386,8 +639,21 @@ static inline int inet_pton(sa_family_t family, const char *src, void *dst)
 #define POLLHUP ZSOCK_POLLHUP
 #define POLLNVAL ZSOCK_POLLNVAL
 
+#define EPOLLIN ZSOCK_EPOLLIN
+#define EPOLLOUT ZSOCK_EPOLLOUT
+#define EPOLLERR ZSOCK_EPOLLERR
+#define EPOLLHUP ZSOCK_EPOLLHUP
+#define EPOLLONESHOT ZSOCK_EPOLLONESHOT
+#define EPOLLET ZSOCK_EPOLLET
+
+#define EPOLL_CTL_ADD ZSOCK_EPOLL_CTL_ADD
+#define EPOLL_CTL_DEL ZSOCK_EPOLL_CTL_DEL
+#define EPOLL_CTL_MOD ZSOCK_EPOLL_CTL_MOD
+
 #define MSG_PEEK ZSOCK_MSG_PEEK
+#define MSG_TRUNC ZSOCK_MSG_TRUNC
 #define MSG_DONTWAIT ZSOCK_MSG_DONTWAIT
+#define MSG_WAITFORONE ZSOCK_MSG_WAITFORONE
 
 #define SHUT_RD ZSOCK_SHUT_RD
 #define SHUT_WR ZSOCK_SHUT_WR
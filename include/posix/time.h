@@ -38,6 +38,17 @@ struct timeval {
 #define CLOCK_MONOTONIC 1
 #endif
 
+/* Faster, possibly older, readings of the clocks above, see
+ * CONFIG_TIME_PAGE. Values are compatible with Linux.
+ */
+#ifndef CLOCK_REALTIME_COARSE
+#define CLOCK_REALTIME_COARSE 5
+#endif
+
+#ifndef CLOCK_MONOTONIC_COARSE
+#define CLOCK_MONOTONIC_COARSE 6
+#endif
+
 #define NSEC_PER_MSEC (NSEC_PER_USEC * USEC_PER_MSEC)
 
 #ifndef TIMER_ABSTIME
@@ -423,6 +423,268 @@ int ring_buf_get_finish(struct ring_buf *buf, u32_t size);
  */
 u32_t ring_buf_get(struct ring_buf *buf, u8_t *data, u32_t size);
 
+/**
+ * @brief Maximum number of claims in flight in a multi-producer ring
+ * buffer
+ *
+ * A claim is in flight from the time it is made until it is visible to
+ * the consumer. Further claims fail as if the ring buffer was full.
+ */
+#define RING_BUF_MP_CLAIMS 8
+
+/**
+ * @brief A finished claim waiting for earlier claims to be published
+ */
+struct ring_buf_mp_claim {
+	atomic_t state;	/**< Free, being recorded or done */
+	atomic_t start;	/**< Start of the claim */
+	atomic_t end;	/**< End of the claim */
+};
+
+/**
+ * @brief A structure to represent a multi-producer ring buffer
+ *
+ * All positions are free running counters, reduced to buffer indices
+ * with @a mask, which is why the size must be a power of 2.
+ */
+struct ring_buf_mp {
+	atomic_t reserved;  /**< End of space claimed by producers */
+	atomic_t claims;    /**< # of claims in flight */
+	/** Finished claims waiting for earlier ones */
+	struct ring_buf_mp_claim done[RING_BUF_MP_CLAIMS];
+	atomic_t tail;	    /**< End of data visible to the consumer */
+	atomic_t head;	    /**< Start of data not yet freed by the consumer */
+	u32_t tmp_head;	    /**< End of data claimed by the consumer */
+	atomic_t dropped_put_count; /**< # of failed item put attempts */
+	u32_t size;	    /**< Size of buf in 32-bit chunks or bytes */
+	u32_t mask;	    /**< Modulo mask, size - 1 */
+	union ring_buf_buffer buf; /**< Memory region for stored data */
+};
+
+/**
+ * @brief Statically define and initialize a multi-producer ring buffer
+ * for data items.
+ *
+ * This macro establishes a multi-producer ring buffer of 2^pow 32-bit
+ * words, to be used with the ring_buf_mp_item_ calls.
+ *
+ * @param name Name of the ring buffer.
+ * @param pow Ring buffer size exponent.
+ */
+#define RING_BUF_MP_ITEM_DECLARE_POW2(name, pow) \
+	static u32_t _ring_buffer_data_##name[1 << (pow)]; \
+	struct ring_buf_mp name = { \
+		.size = (1 << (pow)), \
+		.mask = (1 << (pow)) - 1, \
+		.buf = { .buf32 = _ring_buffer_data_##name } \
+	}
+
+/**
+ * @brief Statically define and initialize a multi-producer ring buffer
+ * for byte data.
+ *
+ * This macro establishes a multi-producer ring buffer of 2^pow bytes.
+ *
+ * @param name Name of the ring buffer.
+ * @param pow Ring buffer size exponent.
+ */
+#define RING_BUF_MP_DECLARE_POW2(name, pow) \
+	static u8_t _ring_buffer_data_##name[1 << (pow)]; \
+	struct ring_buf_mp name = { \
+		.size = (1 << (pow)), \
+		.mask = (1 << (pow)) - 1, \
+		.buf = { .buf8 = _ring_buffer_data_##name } \
+	}
+
+/**
+ * @brief Initialize a multi-producer ring buffer.
+ *
+ * A multi-producer ring buffer can be written concurrently by any number
+ * of threads, ISRs and CPUs without locking, while a single consumer
+ * reads from it. Producers reserve space by atomically moving the end of
+ * the claimed space, and data becomes visible to the consumer once every
+ * producer which claimed space before it has finished. At most
+ * RING_BUF_MP_CLAIMS claims may be in flight at once.
+ *
+ * Unlike with struct ring_buf, the whole buffer can be filled.
+ *
+ * @param buf Address of ring buffer.
+ * @param size Ring buffer size (in 32-bit words or bytes), a power of 2.
+ * @param data Ring buffer data area (u32_t data[size] or u8_t data[size] for
+ *	       bytes mode).
+ */
+static inline void ring_buf_mp_init(struct ring_buf_mp *buf, u32_t size,
+				    void *data)
+{
+	__ASSERT(is_power_of_two(size), "size must be a power of 2");
+
+	memset(buf, 0, sizeof(struct ring_buf_mp));
+	buf->size = size;
+	buf->mask = size - 1;
+	buf->buf.buf32 = data;
+}
+
+/**
+ * @brief Determine if a multi-producer ring buffer holds no data visible
+ * to the consumer.
+ *
+ * @param buf Address of ring buffer.
+ *
+ * @return 1 if the ring buffer is empty, or 0 if not.
+ */
+static inline int ring_buf_mp_is_empty(struct ring_buf_mp *buf)
+{
+	return atomic_get(&buf->head) == atomic_get(&buf->tail);
+}
+
+/**
+ * @brief Determine free space in a multi-producer ring buffer.
+ *
+ * @param buf Address of ring buffer.
+ *
+ * @return Ring buffer free space (in 32-bit words or bytes), which other
+ *	   producers may claim at any time.
+ */
+static inline u32_t ring_buf_mp_space_get(struct ring_buf_mp *buf)
+{
+	return buf->size - ((u32_t)atomic_get(&buf->reserved) -
+			    (u32_t)atomic_get(&buf->head));
+}
+
+/**
+ * @brief Write a data item to a multi-producer ring buffer.
+ *
+ * Like ring_buf_item_put(), but may be called concurrently from any
+ * number of contexts.
+ *
+ * @param buf Address of ring buffer.
+ * @param type Data item's type identifier (application specific).
+ * @param value Data item's integer value (application specific).
+ * @param data Address of data item.
+ * @param size32 Data item size (number of 32-bit words).
+ *
+ * @retval 0 Data item was written.
+ * @retval -EMSGSIZE Ring buffer has insufficient free space.
+ */
+int ring_buf_mp_item_put(struct ring_buf_mp *buf, u16_t type, u8_t value,
+			 u32_t *data, u8_t size32);
+
+/**
+ * @brief Read a data item from a multi-producer ring buffer.
+ *
+ * Like ring_buf_item_get(). Only one context may read from the ring
+ * buffer at a time.
+ *
+ * @param buf Address of ring buffer.
+ * @param type Area to store the data item's type identifier.
+ * @param value Area to store the data item's integer value.
+ * @param data Area to store the data item.
+ * @param size32 Size of the data item storage area (number of 32-bit chunks).
+ *
+ * @retval 0 Data item was fetched; @a size32 now contains the number of
+ *         32-bit words read into data area @a data.
+ * @retval -EAGAIN Ring buffer is empty.
+ * @retval -EMSGSIZE Data area @a data is too small; @a size32 now contains
+ *         the number of 32-bit words needed.
+ */
+int ring_buf_mp_item_get(struct ring_buf_mp *buf, u16_t *type, u8_t *value,
+			 u32_t *data, u8_t *size32);
+
+/**
+ * @brief Allocate buffer for writing data to a multi-producer ring buffer.
+ *
+ * Like ring_buf_put_claim(), but may be called concurrently from any
+ * number of contexts.
+ *
+ * Every claim must be handed back with ring_buf_mp_put_finish(),
+ * even if nothing was written to it: data claimed later by other
+ * producers only becomes visible to the consumer once all earlier claims
+ * are finished. A claim should thus be finished promptly, and cannot be
+ * shrunk.
+ *
+ * @warning
+ * Ring buffer instance should not mix byte access and item access
+ * (calls prefixed with ring_buf_mp_item_).
+ *
+ * @param[in]  buf  Address of ring buffer.
+ * @param[out] data Pointer to the address. It is set to a location within
+ *		    ring buffer.
+ * @param[in]  size Requested allocation size (in bytes).
+ *
+ * @return Size of allocated buffer which can be smaller than requested if
+ *	   there is not enough free space or buffer wraps, and is 0 if
+ *	   RING_BUF_MP_CLAIMS claims are in flight.
+ */
+u32_t ring_buf_mp_put_claim(struct ring_buf_mp *buf, u8_t **data, u32_t size);
+
+/**
+ * @brief Indicate that bytes claimed for writing have been written.
+ *
+ * Each claim is finished on its own, as a whole.
+ *
+ * @param buf  Address of ring buffer.
+ * @param data Address returned by ring_buf_mp_put_claim().
+ * @param size Size returned by ring_buf_mp_put_claim().
+ */
+void ring_buf_mp_put_finish(struct ring_buf_mp *buf, u8_t *data, u32_t size);
+
+/**
+ * @brief Write (copy) data to a multi-producer ring buffer.
+ *
+ * Like ring_buf_put(), but may be called concurrently from any number of
+ * contexts. Data written by one call is contiguous in the stream unless
+ * it wraps around the end of the buffer, in which case data from other
+ * producers may be interleaved.
+ *
+ * @param buf Address of ring buffer.
+ * @param data Address of data.
+ * @param size Data size (in bytes).
+ *
+ * @retval Number of bytes written.
+ */
+u32_t ring_buf_mp_put(struct ring_buf_mp *buf, const u8_t *data, u32_t size);
+
+/**
+ * @brief Get address of a valid data in a multi-producer ring buffer.
+ *
+ * Like ring_buf_get_claim(). Only one context may read from the ring
+ * buffer at a time.
+ *
+ * @param[in]  buf  Address of ring buffer.
+ * @param[out] data Pointer to the address. It is set to a location within
+ *		    ring buffer.
+ * @param[in]  size Requested size (in bytes).
+ *
+ * @return Number of valid bytes in the provided buffer which can be smaller
+ *	   than requested if there is not enough data or buffer wraps.
+ */
+u32_t ring_buf_mp_get_claim(struct ring_buf_mp *buf, u8_t **data, u32_t size);
+
+/**
+ * @brief Indicate number of bytes read from claimed buffer.
+ *
+ * @param  buf  Address of ring buffer.
+ * @param  size Number of bytes that can be freed.
+ *
+ * @retval 0 Successful operation.
+ * @retval -EINVAL Provided @a size exceeds valid bytes in the ring buffer.
+ */
+int ring_buf_mp_get_finish(struct ring_buf_mp *buf, u32_t size);
+
+/**
+ * @brief Read data from a multi-producer ring buffer.
+ *
+ * Like ring_buf_get(). Only one context may read from the ring buffer at
+ * a time.
+ *
+ * @param buf  Address of ring buffer.
+ * @param data Address of the output buffer.
+ * @param size Data size (in bytes).
+ *
+ * @retval Number of bytes written to the output buffer.
+ */
+u32_t ring_buf_mp_get(struct ring_buf_mp *buf, u8_t *data, u32_t size);
+
 /**
  * @}
  */
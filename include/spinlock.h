@@ -38,10 +38,38 @@ struct k_spinlock_key {
 
 typedef struct k_spinlock_key k_spinlock_key_t;
 
+#ifdef CONFIG_SPINLOCK_STATS
+#include <zephyr/types.h>
+
+/* Contention statistics of a spinlock, updated while it is held */
+struct k_spinlock_stats {
+	/* Number of times the lock was taken */
+	u32_t acquired;
+	/* Of which the lock was held by another CPU */
+	u32_t contended;
+	/* Total number of polls of the lock while it was held elsewhere */
+	u32_t spins;
+	/* Longest time the lock was held, in cycles */
+	u32_t hold_max;
+	/* Cycle count when the lock was last taken */
+	u32_t hold_start;
+};
+
+struct k_spinlock;
+void z_spin_lock_stats(struct k_spinlock *l, u32_t spins);
+void z_spin_unlock_stats(struct k_spinlock *l);
+#endif
+
 struct k_spinlock {
 #ifdef CONFIG_SMP
+#ifdef CONFIG_SPINLOCK_TICKET
+	/* Next ticket to hand out, and ticket of the current holder */
+	atomic_t next;
+	atomic_t owner;
+#else
 	atomic_t locked;
 #endif
+#endif
 
 #ifdef SPIN_VALIDATE
 	/* Stores the thread that holds the lock with the locking CPU
@@ -49,8 +77,71 @@ struct k_spinlock {
 	 */
 	size_t thread_cpu;
 #endif
+
+#ifdef CONFIG_SPINLOCK_STATS
+	struct k_spinlock_stats stats;
+#endif
 };
 
+/* Internal function: takes the lock itself, local interrupts must be
+ * already disabled
+ */
+static ALWAYS_INLINE void z_spin_acquire(struct k_spinlock *l)
+{
+	u32_t spins = 0U;
+
+#ifdef CONFIG_SMP
+#ifdef CONFIG_SPINLOCK_TICKET
+	/* CPUs get the lock in the order they asked for it, each one
+	 * polling for its own turn
+	 */
+	atomic_val_t ticket = atomic_inc(&l->next);
+
+	while (atomic_get(&l->owner) != ticket) {
+		spins++;
+	}
+#else
+	/* Only try to take the lock when it looks free, so that waiting
+	 * CPUs do not keep writing to it
+	 */
+	while (!atomic_cas(&l->locked, 0, 1)) {
+		while (atomic_get(&l->locked) != 0) {
+			spins++;
+		}
+	}
+#endif
+#endif
+
+#ifdef CONFIG_SPINLOCK_STATS
+	z_spin_lock_stats(l, spins);
+#endif
+	ARG_UNUSED(spins);
+}
+
+/* Internal function: releases the lock itself */
+static ALWAYS_INLINE void z_spin_clear(struct k_spinlock *l)
+{
+#ifdef CONFIG_SPINLOCK_STATS
+	z_spin_unlock_stats(l);
+#endif
+
+#ifdef CONFIG_SMP
+#ifdef CONFIG_SPINLOCK_TICKET
+	/* Only the holder ever writes owner */
+	atomic_inc(&l->owner);
+#else
+	/* Strictly we don't need atomic_clear() here (which is an
+	 * exchange operation that returns the old value).  We are always
+	 * setting a zero and (because we hold the lock) know the existing
+	 * state won't change due to a race.  But some architectures need
+	 * a memory barrier when used like this, and we don't have a
+	 * Zephyr framework for that.
+	 */
+	atomic_clear(&l->locked);
+#endif
+#endif
+}
+
 static ALWAYS_INLINE k_spinlock_key_t k_spin_lock(struct k_spinlock *l)
 {
 	ARG_UNUSED(l);
@@ -66,10 +157,7 @@ static ALWAYS_INLINE k_spinlock_key_t k_spin_lock(struct k_spinlock *l)
 	__ASSERT(z_spin_lock_valid(l), "Recursive spinlock");
 #endif
 
-#ifdef CONFIG_SMP
-	while (!atomic_cas(&l->locked, 0, 1)) {
-	}
-#endif
+	z_spin_acquire(l);
 
 	return k;
 }
@@ -82,16 +170,7 @@ static ALWAYS_INLINE void k_spin_unlock(struct k_spinlock *l,
 	__ASSERT(z_spin_unlock_valid(l), "Not my spinlock!");
 #endif
 
-#ifdef CONFIG_SMP
-	/* Strictly we don't need atomic_clear() here (which is an
-	 * exchange operation that returns the old value).  We are always
-	 * setting a zero and (because we hold the lock) know the existing
-	 * state won't change due to a race.  But some architectures need
-	 * a memory barrier when used like this, and we don't have a
-	 * Zephyr framework for that.
-	 */
-	atomic_clear(&l->locked);
-#endif
+	z_spin_clear(l);
 	_arch_irq_unlock(key.key);
 }
 
@@ -104,9 +183,7 @@ static ALWAYS_INLINE void k_spin_release(struct k_spinlock *l)
 #ifdef SPIN_VALIDATE
 	__ASSERT(z_spin_unlock_valid(l), "Not my spinlock!");
 #endif
-#ifdef CONFIG_SMP
-	atomic_clear(&l->locked);
-#endif
+	z_spin_clear(l);
 }
 
 
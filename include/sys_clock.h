@@ -211,6 +211,14 @@ struct _timeout {
 	sys_dnode_t node;
 	s32_t dticks;
 	_timeout_func_t fn;
+#ifdef CONFIG_TIMEOUT_QUEUE_WHEEL
+	/* Absolute expiration tick, used by the timing wheel backend */
+	u64_t expiry;
+#endif
+#ifdef CONFIG_TIMEOUT_SLACK
+	/* Ticks by which the expiry may be delayed to batch wakeups */
+	s32_t slack;
+#endif
 };
 
 /*
@@ -8,8 +8,11 @@
 #include <string.h>
 #include <device.h>
 #include <misc/util.h>
+#include <misc/printk.h>
 #include <atomic.h>
 #include <syscall_handler.h>
+#include <init.h>
+#include <device_name_hash.h>
 
 extern struct device __device_init_start[];
 extern struct device __device_PRE_KERNEL_1_start[];
@@ -25,6 +28,318 @@ extern u32_t __device_busy_end[];
 #define DEVICE_BUSY_SIZE (__device_busy_end - __device_busy_start)
 #endif
 
+static void device_init(struct device *info)
+{
+	struct device_config *device_conf = info->config;
+	int retval;
+#ifdef CONFIG_BOOT_TIME_MEASUREMENT
+	u32_t start = k_cycle_get_32();
+#endif
+
+	retval = device_conf->init(info);
+#ifdef CONFIG_BOOT_TIME_MEASUREMENT
+	info->init_cycles = k_cycle_get_32() - start;
+#endif
+	if (retval != 0) {
+		/* Initialization failed. Clear the API struct so that
+		 * device_get_binding() will not succeed for it.
+		 */
+		info->driver_api = NULL;
+	} else {
+		_k_object_init(info);
+	}
+}
+
+#ifdef CONFIG_DEVICE_INIT_PARALLEL
+extern const struct device_init_deps __devinit_deps_start[];
+extern const struct device_init_deps __devinit_deps_end[];
+
+enum {
+	INIT_SEQUENTIAL,
+	INIT_WAITING,
+	INIT_RUNNING,
+	INIT_DONE,
+};
+
+#define INIT_THREADS CONFIG_DEVICE_INIT_PARALLEL_THREADS
+
+static K_THREAD_STACK_ARRAY_DEFINE(init_stacks, INIT_THREADS,
+				   CONFIG_DEVICE_INIT_PARALLEL_STACK_SIZE);
+static struct k_thread init_threads[INIT_THREADS];
+static bool init_threads_started;
+
+/* Wakeups of the workers and of the main thread: a worker or the main
+ * thread woken up looks for all the work there is, so these only need
+ * to count up to the number of threads waiting on them
+ */
+static K_SEM_DEFINE(init_ready, 0, INIT_THREADS);
+static K_SEM_DEFINE(init_done, 0, 1);
+
+/* The run of parallel devices being initialized, and the number of
+ * them left to initialize and being initialized, protected by init_lock.
+ */
+static struct k_spinlock init_lock;
+static struct device *run_start, *run_end;
+static int run_left, run_running;
+
+static bool in_run(struct device *info, struct device *start,
+		   struct device *end)
+{
+	return info >= start && info < end;
+}
+
+static bool depends_on(const struct device_init_deps *deps,
+		       struct device *info)
+{
+	const char *name = info->config->name;
+
+	if (deps->dev == info || name == NULL || name[0] == '\0') {
+		return false;
+	}
+
+	for (u32_t i = 0; i < deps->count; i++) {
+		if (deps->names[i] == name ||
+		    strcmp(deps->names[i], name) == 0) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
+/* A dependency initialized after the run of the device depending on it,
+ * in a later level or after a device not marked for parallel init,
+ * cannot be waited for.  Report it rather than silently dropping it.
+ */
+static void check_deps_order(const struct device_init_deps *deps,
+			     struct device *end)
+{
+	struct device *info;
+
+	for (info = end; info < __device_init_end; info++) {
+		if (depends_on(deps, info)) {
+			printk("device %s: depends on %s, which is "
+			       "initialized later\n",
+			       deps->dev->config->name, info->config->name);
+			__ASSERT(false, "device %s: dependency initialized "
+				 "later", deps->dev->config->name);
+		}
+	}
+}
+
+/* Returns a device of the run ready to be initialized, if any */
+static struct device *init_ready_get(void)
+{
+	struct device *info;
+
+	for (info = run_start; info < run_end; info++) {
+		if (info->init_state == INIT_WAITING && info->init_deps == 0) {
+			return info;
+		}
+	}
+
+	return NULL;
+}
+
+static struct device *init_claim(void)
+{
+	k_spinlock_key_t key = k_spin_lock(&init_lock);
+	struct device *info = init_ready_get();
+
+	if (info != NULL) {
+		info->init_state = INIT_RUNNING;
+		run_running++;
+	}
+	k_spin_unlock(&init_lock, key);
+
+	return info;
+}
+
+static void init_complete(struct device *info)
+{
+	const struct device_init_deps *deps;
+	k_spinlock_key_t key = k_spin_lock(&init_lock);
+	int ready = 0;
+
+	info->init_state = INIT_DONE;
+	run_left--;
+	run_running--;
+
+	for (deps = __devinit_deps_start; deps < __devinit_deps_end; deps++) {
+		struct device *dep = deps->dev;
+
+		if (in_run(dep, run_start, run_end) &&
+		    dep->init_state == INIT_WAITING && depends_on(deps, info)) {
+			dep->init_deps--;
+			if (dep->init_deps == 0) {
+				ready++;
+			}
+		}
+	}
+	k_spin_unlock(&init_lock, key);
+
+	while (ready-- > 0) {
+		k_sem_give(&init_ready);
+	}
+	k_sem_give(&init_done);
+}
+
+static void init_run_ready(void)
+{
+	struct device *info;
+
+	while ((info = init_claim()) != NULL) {
+		device_init(info);
+		init_complete(info);
+	}
+}
+
+static void init_worker(void *p1, void *p2, void *p3)
+{
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	while (true) {
+		k_sem_take(&init_ready, K_FOREVER);
+		init_run_ready();
+	}
+}
+
+/* Returns true once the run is done, otherwise whether there is
+ * anything left for the caller to do but wait for a device to complete.
+ * A device left waiting while none is ready or running is part of a
+ * dependency loop: its dependencies are then ignored so that the boot
+ * still goes on.
+ */
+static bool run_done(bool *wait)
+{
+	k_spinlock_key_t key = k_spin_lock(&init_lock);
+	bool done = run_left == 0;
+
+	*wait = false;
+	if (!done && init_ready_get() == NULL) {
+		struct device *info;
+
+		if (run_running != 0) {
+			*wait = true;
+		} else {
+			for (info = run_start;
+			     info->init_state != INIT_WAITING; info++) {
+			}
+			__ASSERT(false, "device %s: dependency loop",
+				 info->config->name);
+			info->init_deps = 0;
+		}
+	}
+	k_spin_unlock(&init_lock, key);
+
+	return done;
+}
+
+static void init_run(struct device *start, struct device *end)
+{
+	const struct device_init_deps *deps;
+	struct device *info;
+	k_spinlock_key_t key;
+	int ready = 0;
+
+	/* The workers only look at the current run, which is done, so
+	 * the new one can be set up without holding the lock
+	 */
+	for (deps = __devinit_deps_start; deps < __devinit_deps_end; deps++) {
+		if (!in_run(deps->dev, start, end)) {
+			continue;
+		}
+
+		check_deps_order(deps, end);
+
+		deps->dev->init_deps = 0;
+		for (info = start; info < end; info++) {
+			if (depends_on(deps, info)) {
+				deps->dev->init_deps++;
+			}
+		}
+		if (deps->dev->init_deps == 0) {
+			ready++;
+		}
+	}
+
+	key = k_spin_lock(&init_lock);
+	run_start = start;
+	run_end = end;
+	run_left = end - start;
+	k_spin_unlock(&init_lock, key);
+
+	if (!init_threads_started) {
+		for (int i = 0; i < INIT_THREADS; i++) {
+			k_thread_create(&init_threads[i], init_stacks[i],
+					K_THREAD_STACK_SIZEOF(init_stacks[i]),
+					init_worker, NULL, NULL, NULL,
+					CONFIG_MAIN_THREAD_PRIORITY, 0,
+					K_NO_WAIT);
+		}
+		init_threads_started = true;
+	}
+
+	while (ready-- > 0) {
+		k_sem_give(&init_ready);
+	}
+
+	/* Take part in the work until every device of the run is done */
+	while (true) {
+		bool wait;
+
+		init_run_ready();
+		if (run_done(&wait)) {
+			break;
+		}
+		if (wait) {
+			k_sem_take(&init_done, K_FOREVER);
+		}
+	}
+}
+
+static void do_config_level_parallel(struct device *start,
+				     struct device *end)
+{
+	const struct device_init_deps *deps;
+	struct device *info, *last;
+
+	for (deps = __devinit_deps_start; deps < __devinit_deps_end; deps++) {
+		if (in_run(deps->dev, start, end)) {
+			deps->dev->init_state = INIT_WAITING;
+		}
+	}
+
+	/* Devices not marked for parallel initialization still wait for
+	 * all those before them, so only runs of consecutive marked
+	 * devices are initialized concurrently
+	 */
+	for (info = start; info < end; info = last) {
+		if (info->init_state != INIT_WAITING) {
+			device_init(info);
+			last = info + 1;
+			continue;
+		}
+
+		for (last = info; last < end &&
+		     last->init_state == INIT_WAITING; last++) {
+		}
+		init_run(info, last);
+	}
+}
+
+static void init_threads_stop(void)
+{
+	if (init_threads_started) {
+		for (int i = 0; i < INIT_THREADS; i++) {
+			k_thread_abort(&init_threads[i]);
+		}
+	}
+}
+#endif /* CONFIG_DEVICE_INIT_PARALLEL */
+
 /**
  * @brief Execute all the device initialization functions at a given level
  *
@@ -48,27 +363,66 @@ void _sys_device_do_config_level(s32_t level)
 		__device_init_end,
 	};
 
+#ifdef CONFIG_DEVICE_INIT_PARALLEL
+	if (level >= _SYS_INIT_LEVEL_POST_KERNEL) {
+		do_config_level_parallel(config_levels[level],
+					 config_levels[level+1]);
+		if (level == _SYS_INIT_LEVEL_APPLICATION) {
+			init_threads_stop();
+		}
+		return;
+	}
+#endif
+
 	for (info = config_levels[level]; info < config_levels[level+1];
 								info++) {
-		int retval;
-		struct device_config *device_conf = info->config;
-
-		retval = device_conf->init(info);
-		if (retval != 0) {
-			/* Initialization failed. Clear the API struct so that
-			 * device_get_binding() will not succeed for it.
-			 */
-			info->driver_api = NULL;
-		} else {
-			_k_object_init(info);
-		}
+		device_init(info);
+	}
+}
+
+#ifdef CONFIG_DEVICE_NAME_HASH
+/* Looks a name up in the perfect hash of device names.  Returns false
+ * when several devices have this name, leaving the choice to the linear
+ * search.
+ */
+static bool device_name_hash_find(const char *name, struct device **found)
+{
+	const struct device_name_hash *table = &z_device_name_hash;
+	u32_t bucket = z_device_name_hash_fn(0, name) % table->buckets;
+	u32_t slot = z_device_name_hash_fn(table->displacements[bucket],
+					   name) % table->size;
+	u16_t entry = table->slots[slot];
+	struct device *info;
+
+	*found = NULL;
+	if (entry == DEVICE_NAME_HASH_EMPTY) {
+		return true;
+	}
+	if ((entry & DEVICE_NAME_HASH_DUP) != 0) {
+		return false;
 	}
+
+	/* Any name hashes to some slot, check it is this device's */
+	info = &__device_init_start[entry];
+	if ((info->driver_api != NULL) &&
+	    (strcmp(name, info->config->name) == 0)) {
+		*found = info;
+	}
+
+	return true;
 }
+#endif
 
 struct device *_impl_device_get_binding(const char *name)
 {
 	struct device *info;
 
+#ifdef CONFIG_DEVICE_NAME_HASH
+	if (device_name_hash_find(name, &info)) {
+		return info;
+	}
+#endif
+
 	/* Split the search into two loops: in the common scenario, where
 	 * device names are stored in ROM (and are referenced by the user
 	 * with CONFIG_* macros), only cheap pointer comparisons will be
@@ -0,0 +1,57 @@
+/*
+ * Copyright (c) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef ZEPHYR_KERNEL_INCLUDE_DEVICE_NAME_HASH_H_
+#define ZEPHYR_KERNEL_INCLUDE_DEVICE_NAME_HASH_H_
+
+/**
+ * @file
+ * @brief Perfect hash of device names
+ *
+ * The table is generated by scripts/gen_device_hash.py from the device
+ * list of the first link pass.  A name is first hashed with a seed of 0
+ * to pick a bucket, then with the displacement of that bucket as seed to
+ * pick a slot.  Slots hold the index of the device in the device list,
+ * so the table does not depend on where the devices end up.
+ */
+
+#include <zephyr/types.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Slot flag: more devices have the same name */
+#define DEVICE_NAME_HASH_DUP	0x8000
+#define DEVICE_NAME_HASH_EMPTY	0xFFFF
+
+struct device_name_hash {
+	const u16_t *displacements;
+	u16_t buckets;
+	u16_t size;
+	const u16_t *slots;
+};
+
+extern const struct device_name_hash z_device_name_hash;
+
+/* FNV-1a, seeded through its offset basis */
+static inline u32_t z_device_name_hash_fn(u32_t seed, const char *name)
+{
+	u32_t hash = 2166136261U ^ seed;
+
+	while (*name != '\0') {
+		hash ^= (u8_t)*name++;
+		hash *= 16777619U;
+	}
+
+	return hash;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_KERNEL_INCLUDE_DEVICE_NAME_HASH_H_ */
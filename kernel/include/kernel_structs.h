@@ -56,6 +56,18 @@
 #define STACK_SENTINEL 0xF0F0F0F0
 #endif
 
+#ifdef CONFIG_STACK_USAGE_MONITOR_GUARD
+/* Fill value of the stack guard region, and its offset from the lowest
+ * stack address
+ */
+#define STACK_GUARD_PATTERN 0xaa
+#ifdef CONFIG_STACK_SENTINEL
+#define STACK_GUARD_OFFSET 4
+#else
+#define STACK_GUARD_OFFSET 0
+#endif
+#endif
+
 /* lowest value of _thread_base.preempt at which a thread is non-preemptible */
 #define _NON_PREEMPT_THRESHOLD 0x0080
 
@@ -107,6 +119,11 @@ struct _cpu {
 	/* True when _current is allowed to context switch */
 	u8_t swap_ok;
 #endif
+
+#ifdef CONFIG_SCHED_PERCPU_RUNQ
+	/* threads ready to run on this CPU, excluding current */
+	struct _ready_q ready_q;
+#endif
 };
 
 typedef struct _cpu _cpu_t;
@@ -228,6 +245,13 @@ static ALWAYS_INLINE void _new_thread_init(struct k_thread *thread,
 	 */
 	*((u32_t *)pStack) = STACK_SENTINEL;
 #endif /* CONFIG_STACK_SENTINEL */
+#ifdef CONFIG_STACK_USAGE_MONITOR_GUARD
+	/* Paint the guard region right above the sentinel, if any. This is
+	 * the only part of the stack written at creation.
+	 */
+	memset(pStack + STACK_GUARD_OFFSET, STACK_GUARD_PATTERN,
+	       CONFIG_STACK_USAGE_MONITOR_GUARD_SIZE);
+#endif
 	/* Initialize various struct k_thread members */
 	_init_thread_base(&thread->base, prio, _THREAD_PRESTART, options);
 
@@ -252,6 +276,9 @@ static ALWAYS_INLINE void _new_thread_init(struct k_thread *thread,
 	thread->stack_info.start = (u32_t)pStack;
 	thread->stack_info.size = (u32_t)stackSize;
 #endif /* CONFIG_THREAD_STACK_INFO */
+#ifdef CONFIG_STACK_USAGE_MONITOR
+	thread->stack_info.max_used = 0;
+#endif
 }
 
 #endif /* _ASMLANGUAGE */
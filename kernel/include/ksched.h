@@ -54,6 +54,12 @@ struct k_thread *_find_first_thread_to_unpend(_wait_q_t *wait_q,
 void idle(void *a, void *b, void *c);
 void z_time_slice(int ticks);
 
+#ifdef CONFIG_STACK_USAGE_MONITOR
+void _stack_usage_sample_isr(void);
+#else
+#define _stack_usage_sample_isr() /**/
+#endif
+
 static inline void _pend_curr_unlocked(_wait_q_t *wait_q, s32_t timeout)
 {
 	(void) _pend_curr_irqlock(_arch_irq_lock(), wait_q, timeout);
@@ -117,7 +123,14 @@ static inline bool _is_thread_state_set(struct k_thread *thread, u32_t state)
 
 static inline bool _is_thread_queued(struct k_thread *thread)
 {
+#ifdef CONFIG_SCHED_PERCPU_RUNQ
+	/* Tracked outside of thread_state, which is not protected by
+	 * the per-CPU run queue locks
+	 */
+	return thread->base.runq_cpu != NULL;
+#else
 	return _is_thread_state_set(thread, _THREAD_QUEUED);
+#endif
 }
 
 static inline void _mark_thread_as_suspended(struct k_thread *thread)
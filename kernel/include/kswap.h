@@ -16,6 +16,12 @@ extern void _check_stack_sentinel(void);
 #define _check_stack_sentinel() /**/
 #endif
 
+#ifdef CONFIG_STACK_USAGE_MONITOR
+extern void _stack_usage_sample(void);
+#else
+#define _stack_usage_sample() /**/
+#endif
+
 /* In SMP, the irq_lock() is a spinlock which is implicitly released
  * and reacquired on context switch to preserve the existing
  * semantics.  This means that whenever we are about to return to a
@@ -52,6 +58,7 @@ static ALWAYS_INLINE unsigned int do_swap(unsigned int key,
 	old_thread = _current;
 
 	_check_stack_sentinel();
+	_stack_usage_sample();
 
 #ifdef CONFIG_TRACING
 	sys_trace_thread_switched_out();
@@ -119,6 +126,7 @@ static inline int _Swap_irqlock(unsigned int key)
 {
 	int ret;
 	_check_stack_sentinel();
+	_stack_usage_sample();
 
 #ifndef CONFIG_ARM
 #ifdef CONFIG_TRACING
@@ -23,6 +23,22 @@ extern "C" {
 static inline void _init_timeout(struct _timeout *t, _timeout_func_t fn)
 {
 	sys_dnode_init(&t->node);
+#ifdef CONFIG_TIMEOUT_SLACK
+	t->slack = 0;
+#endif
+}
+
+/* Sets the ticks by which a timeout may expire late, for all its
+ * subsequent _add_timeout() calls.  Ignored without CONFIG_TIMEOUT_SLACK.
+ */
+static inline void z_timeout_slack_set(struct _timeout *t, s32_t ticks)
+{
+#ifdef CONFIG_TIMEOUT_SLACK
+	t->slack = MAX(0, ticks);
+#else
+	ARG_UNUSED(t);
+	ARG_UNUSED(ticks);
+#endif
 }
 
 void _add_timeout(struct _timeout *to, _timeout_func_t fn, s32_t ticks);
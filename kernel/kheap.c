@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <kernel.h>
+#include <ksched.h>
+#include <wait_q.h>
+#include <init.h>
+#include <misc/__assert.h>
+#include <misc/tlsf.h>
+
+/* Linker-defined symbols bound the static heap structs */
+extern struct k_heap _k_heap_list_start[];
+extern struct k_heap _k_heap_list_end[];
+
+void k_heap_init(struct k_heap *h, void *mem, size_t bytes)
+{
+	_waitq_init(&h->wait_q);
+	sys_tlsf_init(&h->heap, mem, bytes);
+}
+
+static int init_static_heaps(struct device *unused)
+{
+	ARG_UNUSED(unused);
+	struct k_heap *h;
+
+	for (h = _k_heap_list_start; h < _k_heap_list_end; h++) {
+		k_heap_init(h, h->heap.buf, h->heap.size);
+	}
+
+	return 0;
+}
+
+SYS_INIT(init_static_heaps, PRE_KERNEL_1, CONFIG_KERNEL_INIT_PRIORITY_OBJECTS);
+
+void *k_heap_aligned_alloc(struct k_heap *h, size_t align, size_t bytes,
+			   s32_t timeout)
+{
+	s64_t end = 0;
+	void *ret;
+
+	__ASSERT(!(_is_in_isr() && timeout != K_NO_WAIT), "");
+
+	if (timeout > 0) {
+		end = z_tick_get() + _ms_to_ticks(timeout);
+	}
+
+	k_spinlock_key_t key = k_spin_lock(&h->lock);
+
+	while (true) {
+		ret = sys_tlsf_aligned_alloc(&h->heap, align, bytes);
+		if (ret != NULL || timeout == K_NO_WAIT) {
+			break;
+		}
+
+		/* Sleep until some memory is freed, then retry with
+		 * whatever is left of the timeout
+		 */
+		(void)_pend_curr(&h->lock, key, &h->wait_q, timeout);
+		key = k_spin_lock(&h->lock);
+
+		if (timeout != K_FOREVER) {
+			s64_t left = end - z_tick_get();
+
+			if (left <= 0) {
+				ret = sys_tlsf_aligned_alloc(&h->heap, align,
+							     bytes);
+				break;
+			}
+			timeout = __ticks_to_ms(left);
+		}
+	}
+
+	k_spin_unlock(&h->lock, key);
+
+	return ret;
+}
+
+void *k_heap_alloc(struct k_heap *h, size_t bytes, s32_t timeout)
+{
+	return k_heap_aligned_alloc(h, sizeof(void *), bytes, timeout);
+}
+
+void k_heap_free(struct k_heap *h, void *mem)
+{
+	k_spinlock_key_t key = k_spin_lock(&h->lock);
+
+	sys_tlsf_free(&h->heap, mem);
+
+	/* Every waiter retries: with arbitrary block sizes there is no
+	 * cheap way to tell which of them the released memory satisfies
+	 */
+	if (_unpend_all(&h->wait_q) != 0) {
+		_reschedule(&h->lock, key);
+	} else {
+		k_spin_unlock(&h->lock, key);
+	}
+}
@@ -13,6 +13,7 @@
 #include <misc/dlist.h>
 #include <ksched.h>
 #include <init.h>
+#include <string.h>
 
 extern struct k_mem_slab _k_mem_slab_list_start[];
 extern struct k_mem_slab _k_mem_slab_list_end[];
@@ -23,6 +24,138 @@ static struct k_spinlock lock;
 struct k_mem_slab *_trace_list_k_mem_slab;
 #endif	/* CONFIG_OBJECT_TRACING */
 
+#ifdef CONFIG_MEM_SLAB_PERCPU_CACHE
+/*
+ * Per-CPU magazines.  Each CPU keeps up to CACHE_SIZE free blocks of
+ * every slab on a private list under its own spinlock, and only takes
+ * the slab-wide lock to move CACHE_BATCH blocks at a time between its
+ * magazine and the slab's free list.  Lock order is magazine lock,
+ * then the slab-wide lock; two magazine locks are never held at once.
+ *
+ * slab->num_used counts the blocks off the slab's free list, including
+ * those sitting in magazines.  A thread about to block on an empty
+ * slab bumps slab->num_waiters and then empties every magazine into
+ * the slab.  While num_waiters is non-zero, magazines are neither
+ * refilled nor freed into, so every free block ends up on the slab's
+ * free list or handed to a waiter: a free or refill that saw
+ * num_waiters at zero under a magazine lock finished before that
+ * magazine was emptied.
+ */
+#define CACHE_SIZE CONFIG_MEM_SLAB_PERCPU_CACHE_SIZE
+#define CACHE_BATCH (CACHE_SIZE / 2)
+
+/* Moves up to n blocks between two free lists, returns the count */
+static u32_t move_blocks(char **from, char **to, u32_t n)
+{
+	u32_t i;
+
+	for (i = 0U; i < n && *from != NULL; i++) {
+		char *block = *from;
+
+		*from = *(char **)block;
+		*(char **)block = *to;
+		*to = block;
+	}
+
+	return i;
+}
+
+static struct k_mem_slab_cache *cache_lock(struct k_mem_slab *slab,
+					   k_spinlock_key_t *key)
+{
+	/* Mask interrupts before picking the magazine so we cannot
+	 * migrate away from its CPU, then hand the outer interrupt
+	 * state to the caller's k_spin_unlock().  The key returned by
+	 * k_spin_lock() only records that interrupts were already
+	 * masked, so restoring irq directly is what unlocking the two
+	 * nested keys in turn would do.
+	 */
+	int irq = _arch_irq_lock();
+	struct k_mem_slab_cache *c = &slab->cache[_current_cpu->id];
+
+	*key = k_spin_lock(&c->lock);
+	key->key = irq;
+
+	return c;
+}
+
+static void cache_refill(struct k_mem_slab *slab, struct k_mem_slab_cache *c)
+{
+	k_spinlock_key_t key = k_spin_lock(&lock);
+	u32_t n = move_blocks(&slab->free_list, &c->head, CACHE_BATCH);
+
+	slab->num_used += n;
+	c->count += n;
+	k_spin_unlock(&lock, key);
+}
+
+static void cache_drain(struct k_mem_slab *slab, struct k_mem_slab_cache *c,
+			u32_t n)
+{
+	k_spinlock_key_t key = k_spin_lock(&lock);
+
+	n = move_blocks(&c->head, &slab->free_list, n);
+	slab->num_used -= n;
+	c->count -= n;
+	k_spin_unlock(&lock, key);
+}
+
+static void cache_drain_all(struct k_mem_slab *slab)
+{
+	for (int i = 0; i < CONFIG_MP_NUM_CPUS; i++) {
+		struct k_mem_slab_cache *c = &slab->cache[i];
+		k_spinlock_key_t key = k_spin_lock(&c->lock);
+
+		cache_drain(slab, c, c->count);
+		k_spin_unlock(&c->lock, key);
+	}
+}
+
+static bool cache_alloc(struct k_mem_slab *slab, void **mem)
+{
+	k_spinlock_key_t key;
+	struct k_mem_slab_cache *c = cache_lock(slab, &key);
+	bool ret = false;
+
+	if (c->count == 0U && slab->num_waiters == 0U) {
+		cache_refill(slab, c);
+	}
+
+	if (c->count != 0U) {
+		*mem = c->head;
+		c->head = *(char **)c->head;
+		c->count--;
+		ret = true;
+	}
+
+	k_spin_unlock(&c->lock, key);
+
+	return ret;
+}
+
+static bool cache_free(struct k_mem_slab *slab, void *mem)
+{
+	k_spinlock_key_t key;
+	struct k_mem_slab_cache *c = cache_lock(slab, &key);
+	bool ret = false;
+
+	if (slab->num_waiters == 0U) {
+		if (c->count == CACHE_SIZE) {
+			cache_drain(slab, c, CACHE_BATCH);
+		}
+
+		*(char **)mem = c->head;
+		c->head = mem;
+		c->count++;
+		ret = true;
+	}
+
+	k_spin_unlock(&c->lock, key);
+
+	return ret;
+}
+#endif /* CONFIG_MEM_SLAB_PERCPU_CACHE */
+
 /**
  * @brief Initialize kernel memory slab subsystem.
  *
@@ -83,6 +216,10 @@ void k_mem_slab_init(struct k_mem_slab *slab, void *buffer,
 	slab->block_size = block_size;
 	slab->buffer = buffer;
 	slab->num_used = 0;
+#ifdef CONFIG_MEM_SLAB_PERCPU_CACHE
+	slab->num_waiters = 0;
+	(void)memset(slab->cache, 0, sizeof(slab->cache));
+#endif
 	create_free_list(slab);
 	_waitq_init(&slab->wait_q);
 	SYS_TRACING_OBJ_INIT(k_mem_slab, slab);
@@ -92,13 +229,29 @@ void k_mem_slab_init(struct k_mem_slab *slab, void *buffer,
 
 int k_mem_slab_alloc(struct k_mem_slab *slab, void **mem, s32_t timeout)
 {
-	k_spinlock_key_t key = k_spin_lock(&lock);
+	k_spinlock_key_t key;
 	int result;
 
 	/* block size must be word aligned */
 	__ASSERT((slab->block_size & (sizeof(void *) - 1)) == 0,
 		 "block size not word aligned");
 
+#ifdef CONFIG_MEM_SLAB_PERCPU_CACHE
+	if (cache_alloc(slab, mem)) {
+		return 0;
+	}
+
+	/* The slab ran dry, but other CPUs may hold free blocks */
+	if (timeout != K_NO_WAIT) {
+		key = k_spin_lock(&lock);
+		slab->num_waiters++;
+		k_spin_unlock(&lock, key);
+	}
+	cache_drain_all(slab);
+#endif
+
+	key = k_spin_lock(&lock);
+
 	if (slab->free_list != NULL) {
 		/* take a free block */
 		*mem = slab->free_list;
@@ -115,9 +268,19 @@ int k_mem_slab_alloc(struct k_mem_slab *slab, void **mem, s32_t timeout)
 		if (result == 0) {
 			*mem = _current->base.swap_data;
 		}
+#ifdef CONFIG_MEM_SLAB_PERCPU_CACHE
+		key = k_spin_lock(&lock);
+		slab->num_waiters--;
+		k_spin_unlock(&lock, key);
+#endif
 		return result;
 	}
 
+#ifdef CONFIG_MEM_SLAB_PERCPU_CACHE
+	if (timeout != K_NO_WAIT) {
+		slab->num_waiters--;
+	}
+#endif
 	k_spin_unlock(&lock, key);
 
 	return result;
@@ -125,6 +288,12 @@ int k_mem_slab_alloc(struct k_mem_slab *slab, void **mem, s32_t timeout)
 
 void k_mem_slab_free(struct k_mem_slab *slab, void **mem)
 {
+#ifdef CONFIG_MEM_SLAB_PERCPU_CACHE
+	if (cache_free(slab, *mem)) {
+		return;
+	}
+#endif
+
 	k_spinlock_key_t key = k_spin_lock(&lock);
 	struct k_thread *pending_thread = _unpend_first_thread(&slab->wait_q);
 
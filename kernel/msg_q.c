@@ -110,6 +110,84 @@ void k_msgq_cleanup(struct k_msgq *q)
 }
 
 
+static inline void msgq_advance(struct k_msgq *q, char **ptr)
+{
+	*ptr += q->msg_size;
+	if (*ptr == q->buffer_end) {
+		*ptr = q->buffer_start;
+	}
+}
+
+static inline void msgq_wake(struct k_thread *thread)
+{
+	_set_thread_return_value(thread, 0);
+	_ready_thread(thread);
+}
+
+/* Threads waiting in k_msgq_put_claim() and k_msgq_get_claim() have no
+ * message to give or buffer to fill: their swap_data points to one of
+ * these markers instead, and they are only woken up to retry their claim.
+ */
+static char put_claim_waiter;
+static char get_claim_waiter;
+
+static inline bool is_claim_waiter(struct k_thread *thread)
+{
+	return (thread->base.swap_data == &put_claim_waiter) ||
+		(thread->base.swap_data == &get_claim_waiter);
+}
+
+/* Unpend the thread to serve next: the first regular reader or writer
+ * if any, so that those only ever wait on a full or empty queue as they
+ * always did, otherwise the first claim waiter for claim_marker.
+ */
+static struct k_thread *msgq_unpend(struct k_msgq *q, char *claim_marker)
+{
+	struct k_thread *thread, *found = NULL;
+
+	_WAIT_Q_FOR_EACH(&q->wait_q, thread) {
+		if (!is_claim_waiter(thread)) {
+			found = thread;
+			break;
+		}
+		if ((found == NULL) &&
+		    (thread->base.swap_data == claim_marker)) {
+			found = thread;
+		}
+	}
+
+	if (found != NULL) {
+		_unpend_thread(found);
+	}
+
+	return found;
+}
+
+/* Move the first waiting writer's message, if any, into the slot just
+ * freed.  Returns true if a thread was woken up.
+ */
+static bool msgq_refill(struct k_msgq *q)
+{
+	struct k_thread *pending_thread = msgq_unpend(q, &put_claim_waiter);
+
+	if (pending_thread == NULL) {
+		return false;
+	}
+
+	if (!is_claim_waiter(pending_thread)) {
+		/* add thread's message to queue */
+		(void)memcpy(q->write_ptr, pending_thread->base.swap_data,
+		       q->msg_size);
+		msgq_advance(q, &q->write_ptr);
+		q->used_msgs++;
+	}
+
+	/* wake up waiting thread */
+	msgq_wake(pending_thread);
+
+	return true;
+}
+
 int _impl_k_msgq_put(struct k_msgq *q, void *data, s32_t timeout)
 {
 	__ASSERT(!_is_in_isr() || timeout == K_NO_WAIT, "");
@@ -118,27 +196,34 @@ int _impl_k_msgq_put(struct k_msgq *q, void *data, s32_t timeout)
 	struct k_thread *pending_thread;
 	int result;
 
-	if (q->used_msgs < q->max_msgs) {
+	if ((q->flags & K_MSGQ_FLAG_PUT_CLAIMED) != 0) {
+		/* a claimed slot sits at write_ptr */
+		result = -EBUSY;
+	} else if (q->used_msgs < q->max_msgs) {
 		/* message queue isn't full */
-		pending_thread = _unpend_first_thread(&q->wait_q);
-		if (pending_thread != NULL) {
+		pending_thread = msgq_unpend(q, &get_claim_waiter);
+		if ((pending_thread != NULL) &&
+		    !is_claim_waiter(pending_thread)) {
 			/* give message to waiting thread */
 			(void)memcpy(pending_thread->base.swap_data, data,
 			       q->msg_size);
 			/* wake up waiting thread */
-			_set_thread_return_value(pending_thread, 0);
-			_ready_thread(pending_thread);
+			msgq_wake(pending_thread);
 			_reschedule(&q->lock, key);
 			return 0;
 		} else {
 			/* put message in queue */
 			(void)memcpy(q->write_ptr, data, q->msg_size);
-			q->write_ptr += q->msg_size;
-			if (q->write_ptr == q->buffer_end) {
-				q->write_ptr = q->buffer_start;
-			}
+			msgq_advance(q, &q->write_ptr);
 			q->used_msgs++;
 		}
+
+		if (pending_thread != NULL) {
+			/* let the claimer find the message in the queue */
+			msgq_wake(pending_thread);
+			_reschedule(&q->lock, key);
+			return 0;
+		}
 		result = 0;
 	} else if (timeout == K_NO_WAIT) {
 		/* don't wait for message space to become available */
@@ -190,33 +275,19 @@ int _impl_k_msgq_get(struct k_msgq *q, void *data, s32_t timeout)
 	__ASSERT(!_is_in_isr() || timeout == K_NO_WAIT, "");
 
 	k_spinlock_key_t key = k_spin_lock(&q->lock);
-	struct k_thread *pending_thread;
 	int result;
 
-	if (q->used_msgs > 0) {
+	if ((q->flags & K_MSGQ_FLAG_GET_CLAIMED) != 0) {
+		/* the message at read_ptr is claimed */
+		result = -EBUSY;
+	} else if (q->used_msgs > 0) {
 		/* take first available message from queue */
 		(void)memcpy(data, q->read_ptr, q->msg_size);
-		q->read_ptr += q->msg_size;
-		if (q->read_ptr == q->buffer_end) {
-			q->read_ptr = q->buffer_start;
-		}
+		msgq_advance(q, &q->read_ptr);
 		q->used_msgs--;
 
 		/* handle first thread waiting to write (if any) */
-		pending_thread = _unpend_first_thread(&q->wait_q);
-		if (pending_thread != NULL) {
-			/* add thread's message to queue */
-			(void)memcpy(q->write_ptr, pending_thread->base.swap_data,
-			       q->msg_size);
-			q->write_ptr += q->msg_size;
-			if (q->write_ptr == q->buffer_end) {
-				q->write_ptr = q->buffer_start;
-			}
-			q->used_msgs++;
-
-			/* wake up waiting thread */
-			_set_thread_return_value(pending_thread, 0);
-			_ready_thread(pending_thread);
+		if (msgq_refill(q)) {
 			_reschedule(&q->lock, key);
 			return 0;
 		}
@@ -235,6 +306,158 @@ int _impl_k_msgq_get(struct k_msgq *q, void *data, s32_t timeout)
 	return result;
 }
 
+/* Common part of the claim calls: waits until ready() holds for @a q or
+ * the timeout expires.  Called and returns with q->lock held.
+ */
+static int msgq_claim_wait(struct k_msgq *q, k_spinlock_key_t *key,
+			   bool (*ready)(struct k_msgq *q), u8_t claimed_flag,
+			   char *claim_marker, s32_t timeout)
+{
+	__ASSERT(!_is_in_isr() || timeout == K_NO_WAIT, "");
+
+	bool waited = false;
+	s64_t end = 0;
+	int result;
+
+	if (timeout > 0) {
+		end = z_tick_get() + _ms_to_ticks(timeout);
+	}
+
+	while (true) {
+		if ((q->flags & claimed_flag) != 0) {
+			return -EBUSY;
+		}
+
+		if (ready(q)) {
+			q->flags |= claimed_flag;
+			return 0;
+		}
+
+		if (timeout == K_NO_WAIT) {
+			return waited ? -EAGAIN : -ENOMSG;
+		}
+
+		/* Someone else may beat us to the slot or message we are
+		 * woken up for, in which case wait again for whatever is
+		 * left of the timeout
+		 */
+		_current->base.swap_data = claim_marker;
+		result = _pend_curr(&q->lock, *key, &q->wait_q, timeout);
+		*key = k_spin_lock(&q->lock);
+		if (result != 0) {
+			return result;
+		}
+
+		waited = true;
+		if (timeout != K_FOREVER) {
+			s64_t left = end - z_tick_get();
+
+			timeout = (left > 0) ? __ticks_to_ms(left) : K_NO_WAIT;
+		}
+	}
+}
+
+static bool msgq_has_space(struct k_msgq *q)
+{
+	return q->used_msgs < q->max_msgs;
+}
+
+static bool msgq_has_msg(struct k_msgq *q)
+{
+	return q->used_msgs > 0;
+}
+
+int k_msgq_put_claim(struct k_msgq *q, void **msg, s32_t timeout)
+{
+	k_spinlock_key_t key = k_spin_lock(&q->lock);
+	int result;
+
+	result = msgq_claim_wait(q, &key, msgq_has_space,
+				 K_MSGQ_FLAG_PUT_CLAIMED, &put_claim_waiter,
+				 timeout);
+	if (result == 0) {
+		*msg = q->write_ptr;
+	}
+
+	k_spin_unlock(&q->lock, key);
+
+	return result;
+}
+
+int k_msgq_put_finish(struct k_msgq *q)
+{
+	k_spinlock_key_t key = k_spin_lock(&q->lock);
+	struct k_thread *pending_thread;
+
+	if ((q->flags & K_MSGQ_FLAG_PUT_CLAIMED) == 0) {
+		k_spin_unlock(&q->lock, key);
+		return -EINVAL;
+	}
+
+	q->flags &= ~K_MSGQ_FLAG_PUT_CLAIMED;
+
+	/* Nobody else can have filled the queue since the claim, so any
+	 * regular waiter is a reader
+	 */
+	pending_thread = msgq_unpend(q, &get_claim_waiter);
+	if ((pending_thread != NULL) && !is_claim_waiter(pending_thread)) {
+		/* give message to waiting thread, the slot stays free */
+		(void)memcpy(pending_thread->base.swap_data, q->write_ptr,
+		       q->msg_size);
+	} else {
+		msgq_advance(q, &q->write_ptr);
+		q->used_msgs++;
+	}
+
+	if (pending_thread != NULL) {
+		msgq_wake(pending_thread);
+		_reschedule(&q->lock, key);
+	} else {
+		k_spin_unlock(&q->lock, key);
+	}
+
+	return 0;
+}
+
+int k_msgq_get_claim(struct k_msgq *q, void **msg, s32_t timeout)
+{
+	k_spinlock_key_t key = k_spin_lock(&q->lock);
+	int result;
+
+	result = msgq_claim_wait(q, &key, msgq_has_msg,
+				 K_MSGQ_FLAG_GET_CLAIMED, &get_claim_waiter,
+				 timeout);
+	if (result == 0) {
+		*msg = q->read_ptr;
+	}
+
+	k_spin_unlock(&q->lock, key);
+
+	return result;
+}
+
+int k_msgq_get_finish(struct k_msgq *q)
+{
+	k_spinlock_key_t key = k_spin_lock(&q->lock);
+
+	if ((q->flags & K_MSGQ_FLAG_GET_CLAIMED) == 0) {
+		k_spin_unlock(&q->lock, key);
+		return -EINVAL;
+	}
+
+	q->flags &= ~K_MSGQ_FLAG_GET_CLAIMED;
+	msgq_advance(q, &q->read_ptr);
+	q->used_msgs--;
+
+	if (msgq_refill(q)) {
+		_reschedule(&q->lock, key);
+	} else {
+		k_spin_unlock(&q->lock, key);
+	}
+
+	return 0;
+}
+
 #ifdef CONFIG_USERSPACE
 Z_SYSCALL_HANDLER(k_msgq_get, msgq_p, data, timeout)
 {
@@ -292,6 +515,9 @@ void _impl_k_msgq_purge(struct k_msgq *q)
 	q->used_msgs = 0;
 	q->read_ptr = q->write_ptr;
 
+	/* a message claimed for reading is gone too */
+	q->flags &= ~K_MSGQ_FLAG_GET_CLAIMED;
+
 	_reschedule(&q->lock, key);
 }
 
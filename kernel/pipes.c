@@ -139,6 +139,8 @@ void k_pipe_init(struct k_pipe *pipe, unsigned char *buffer, size_t size)
 	pipe->bytes_used = 0;
 	pipe->read_index = 0;
 	pipe->write_index = 0;
+	pipe->put_claimed = 0;
+	pipe->get_claimed = 0;
 	pipe->flags = 0;
 	_waitq_init(&pipe->wait_q.writers);
 	_waitq_init(&pipe->wait_q.readers);
@@ -443,6 +445,13 @@ int _k_pipe_put_internal(struct k_pipe *pipe, struct k_pipe_async *async_desc,
 
 	k_spinlock_key_t key = k_spin_lock(&pipe->lock);
 
+	if (pipe->put_claimed != 0) {
+		/* claimed space sits at write_index */
+		k_spin_unlock(&pipe->lock, key);
+		*bytes_written = 0;
+		return -EBUSY;
+	}
+
 	/*
 	 * Create a list of "working readers" into which the data will be
 	 * directly copied.
@@ -585,6 +594,13 @@ int _impl_k_pipe_get(struct k_pipe *pipe, void *data, size_t bytes_to_read,
 
 	k_spinlock_key_t key = k_spin_lock(&pipe->lock);
 
+	if (pipe->get_claimed != 0) {
+		/* the data at read_index is claimed */
+		k_spin_unlock(&pipe->lock, key);
+		*bytes_read = 0;
+		return -EBUSY;
+	}
+
 	/*
 	 * Create a list of "working readers" into which the data will be
 	 * directly copied.
@@ -761,6 +777,215 @@ Z_SYSCALL_HANDLER(k_pipe_put, pipe, data, bytes_to_write, bytes_written_p,
 }
 #endif
 
+/*
+ * Threads waiting in k_pipe_put_claim() and k_pipe_get_claim() pend on
+ * the writers and readers wait queues with an empty descriptor.  The
+ * transfer code treats them as fully served requests and readies them,
+ * after which they look at the ring buffer again.
+ */
+static int pipe_claim_wait(struct k_pipe *pipe, k_spinlock_key_t *key,
+			   size_t *claimed, _wait_q_t *wait_q,
+			   size_t (*available)(struct k_pipe *pipe),
+			   s32_t timeout)
+{
+	struct k_pipe_desc pipe_desc = { .buffer = NULL, .bytes_to_xfer = 0 };
+	s64_t end = 0;
+	int result;
+
+	if (timeout > 0) {
+		end = z_tick_get() + _ms_to_ticks(timeout);
+	}
+
+	while (true) {
+		if (*claimed != 0) {
+			return -EBUSY;
+		}
+
+		if (available(pipe) != 0) {
+			return 0;
+		}
+
+		if (timeout == K_NO_WAIT) {
+			return -EIO;
+		}
+
+		_current->base.swap_data = &pipe_desc;
+		result = _pend_curr(&pipe->lock, *key, wait_q, timeout);
+		*key = k_spin_lock(&pipe->lock);
+		if (result != 0) {
+			return result;
+		}
+
+		if (timeout != K_FOREVER) {
+			s64_t left = end - z_tick_get();
+
+			if (left <= 0) {
+				/* woken up too late, check just once more */
+				timeout = K_NO_WAIT;
+				continue;
+			}
+			timeout = __ticks_to_ms(left);
+		}
+	}
+}
+
+static size_t pipe_space(struct k_pipe *pipe)
+{
+	return pipe->size - pipe->bytes_used;
+}
+
+static size_t pipe_data(struct k_pipe *pipe)
+{
+	return pipe->bytes_used;
+}
+
+int k_pipe_put_claim(struct k_pipe *pipe, unsigned char **data,
+		     size_t *size, s32_t timeout)
+{
+	k_spinlock_key_t key;
+	int result;
+
+	if ((*size == 0) || (pipe->size == 0)) {
+		return -EINVAL;
+	}
+
+	key = k_spin_lock(&pipe->lock);
+
+	result = pipe_claim_wait(pipe, &key, &pipe->put_claimed,
+				 &pipe->wait_q.writers, pipe_space, timeout);
+	if (result == 0) {
+		/* free space starts at write_index, up to the end */
+		*size = MIN(*size, MIN(pipe_space(pipe),
+				       pipe->size - pipe->write_index));
+		*data = pipe->buffer + pipe->write_index;
+		pipe->put_claimed = *size;
+	} else if (result == -EIO && timeout != K_NO_WAIT) {
+		result = -EAGAIN;
+	}
+
+	k_spin_unlock(&pipe->lock, key);
+
+	return result;
+}
+
+int k_pipe_put_finish(struct k_pipe *pipe, size_t size)
+{
+	k_spinlock_key_t key = k_spin_lock(&pipe->lock);
+	struct k_pipe_desc *desc;
+	struct k_thread *thread;
+	size_t bytes_copied;
+
+	if ((pipe->put_claimed == 0) || (size > pipe->put_claimed)) {
+		k_spin_unlock(&pipe->lock, key);
+		return -EINVAL;
+	}
+
+	pipe->put_claimed = 0;
+	pipe->bytes_used += size;
+	pipe->write_index += size;
+	if (pipe->write_index == pipe->size) {
+		pipe->write_index = 0;
+	}
+
+	/*
+	 * Readers only wait on an empty ring buffer, so hand them the new
+	 * data in the order they came, up to the first one it does not
+	 * satisfy.
+	 */
+	while ((thread = _waitq_head(&pipe->wait_q.readers)) != NULL) {
+		desc = (struct k_pipe_desc *)thread->base.swap_data;
+		bytes_copied = pipe_buffer_get(pipe, desc->buffer,
+						desc->bytes_to_xfer);
+
+		desc->buffer        += bytes_copied;
+		desc->bytes_to_xfer -= bytes_copied;
+
+		if (desc->bytes_to_xfer != 0) {
+			break;
+		}
+
+		_unpend_thread(thread);
+		_ready_thread(thread);
+	}
+
+	_reschedule(&pipe->lock, key);
+
+	return 0;
+}
+
+int k_pipe_get_claim(struct k_pipe *pipe, unsigned char **data,
+		     size_t *size, s32_t timeout)
+{
+	k_spinlock_key_t key;
+	int result;
+
+	if ((*size == 0) || (pipe->size == 0)) {
+		return -EINVAL;
+	}
+
+	key = k_spin_lock(&pipe->lock);
+
+	result = pipe_claim_wait(pipe, &key, &pipe->get_claimed,
+				 &pipe->wait_q.readers, pipe_data, timeout);
+	if (result == 0) {
+		/* data starts at read_index, up to the end */
+		*size = MIN(*size, MIN(pipe_data(pipe),
+				       pipe->size - pipe->read_index));
+		*data = pipe->buffer + pipe->read_index;
+		pipe->get_claimed = *size;
+	} else if (result == -EIO && timeout != K_NO_WAIT) {
+		result = -EAGAIN;
+	}
+
+	k_spin_unlock(&pipe->lock, key);
+
+	return result;
+}
+
+int k_pipe_get_finish(struct k_pipe *pipe, size_t size)
+{
+	k_spinlock_key_t key = k_spin_lock(&pipe->lock);
+	struct k_pipe_desc *desc;
+	struct k_thread *thread;
+	size_t bytes_copied;
+
+	if ((pipe->get_claimed == 0) || (size > pipe->get_claimed)) {
+		k_spin_unlock(&pipe->lock, key);
+		return -EINVAL;
+	}
+
+	pipe->get_claimed = 0;
+	pipe->bytes_used -= size;
+	pipe->read_index += size;
+	if (pipe->read_index == pipe->size) {
+		pipe->read_index = 0;
+	}
+
+	/*
+	 * Writers only wait on a full ring buffer, so let them refill it in
+	 * the order they came, up to the first one which does not fit.
+	 */
+	while ((thread = _waitq_head(&pipe->wait_q.writers)) != NULL) {
+		desc = (struct k_pipe_desc *)thread->base.swap_data;
+		bytes_copied = pipe_buffer_put(pipe, desc->buffer,
+						desc->bytes_to_xfer);
+
+		desc->buffer        += bytes_copied;
+		desc->bytes_to_xfer -= bytes_copied;
+
+		if (desc->bytes_to_xfer != 0) {
+			break;
+		}
+
+		_unpend_thread(thread);
+		pipe_thread_ready(thread);
+	}
+
+	_reschedule(&pipe->lock, key);
+
+	return 0;
+}
+
 #if (CONFIG_NUM_PIPE_ASYNC_MSGS > 0)
 void k_pipe_block_put(struct k_pipe *pipe, struct k_mem_block *block,
 		      size_t bytes_to_write, struct k_sem *sem)
@@ -768,6 +993,8 @@ void k_pipe_block_put(struct k_pipe *pipe, struct k_mem_block *block,
 	struct k_pipe_async  *async_desc;
 	size_t                dummy_bytes_written;
 
+	__ASSERT(pipe->put_claimed == 0, "pipe space is claimed");
+
 	/* For simplicity, always allocate an asynchronous descriptor */
 	pipe_async_alloc(&async_desc);
 
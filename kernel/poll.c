@@ -84,6 +84,20 @@ static inline bool is_condition_met(struct k_poll_event *event, u32_t *state)
 	return false;
 }
 
+/* Events belonging to a poll set have no thread of their own and rank
+ * below every polling thread.
+ */
+static inline bool is_poller_higher_prio(struct _poller *p1,
+					 struct _poller *p2)
+{
+	if (p1->thread == NULL) {
+		return false;
+	}
+
+	return p2->thread == NULL ||
+		_is_t1_higher_prio_than_t2(p1->thread, p2->thread);
+}
+
 static inline void add_event(sys_dlist_t *events, struct k_poll_event *event,
 			     struct _poller *poller)
 {
@@ -91,15 +105,13 @@ static inline void add_event(sys_dlist_t *events, struct k_poll_event *event,
 
 	pending = (struct k_poll_event *)sys_dlist_peek_tail(events);
 	if ((pending == NULL) ||
-		_is_t1_higher_prio_than_t2(pending->poller->thread,
-		poller->thread)) {
+		!is_poller_higher_prio(poller, pending->poller)) {
 		sys_dlist_append(events, &event->_node);
 		return;
 	}
 
 	SYS_DLIST_FOR_EACH_CONTAINER(events, pending, _node) {
-		if (_is_t1_higher_prio_than_t2(poller->thread,
-					       pending->poller->thread)) {
+		if (is_poller_higher_prio(poller, pending->poller)) {
 			sys_dlist_insert(&pending->_node, &event->_node);
 			return;
 		}
@@ -334,6 +346,31 @@ oops_free:
 }
 #endif
 
+/* must be called with interrupts locked */
+static void pollset_signal_event(struct k_poll_event *event, u32_t state)
+{
+	struct k_pollset *set = CONTAINER_OF(event->poller, struct k_pollset,
+					     poller);
+	struct k_thread *thread;
+
+	/* Called with the lock of the object held, not ours */
+	k_spinlock_key_t key = k_spin_lock(&set->lock);
+
+	/* The event is off its object's list by now, queue it for the next
+	 * k_pollset_wait(). It stays a member of the set.
+	 */
+	event->state |= state;
+	sys_dlist_append(&set->ready, &event->_node);
+
+	thread = _unpend_first_thread(&set->wait_q);
+	if (thread != NULL) {
+		_set_thread_return_value(thread, 0);
+		_ready_thread(thread);
+	}
+
+	k_spin_unlock(&set->lock, key);
+}
+
 /* must be called with interrupts locked */
 static int signal_poll_event(struct k_poll_event *event, u32_t state)
 {
@@ -341,6 +378,11 @@ static int signal_poll_event(struct k_poll_event *event, u32_t state)
 		goto ready_event;
 	}
 
+	if (event->poller->thread == NULL) {
+		pollset_signal_event(event, state);
+		return 0;
+	}
+
 	struct k_thread *thread = event->poller->thread;
 
 	__ASSERT(event->poller->thread != NULL,
@@ -448,3 +490,263 @@ Z_SYSCALL_HANDLER1_SIMPLE_VOID(k_poll_signal_reset, K_OBJ_POLL_SIGNAL,
 			       struct k_poll_signal *);
 #endif
 
+
+void k_pollset_init(struct k_pollset *set, struct k_poll_event *events,
+		    int max_events)
+{
+	__ASSERT(max_events > 0, "zero events\n");
+
+	_waitq_init(&set->wait_q);
+	set->poller.thread = NULL;
+	set->poller.is_polling = false;
+	sys_dlist_init(&set->ready);
+	sys_dlist_init(&set->reported);
+	set->lock = (struct k_spinlock) {};
+	set->events = events;
+	set->max_events = max_events;
+	(void)memset(events, 0, max_events * sizeof(*events));
+	_k_object_init(set);
+}
+
+/* must be called with lock and set->lock held */
+static void pollset_arm_event(struct k_pollset *set, struct k_poll_event *event)
+{
+	u32_t state;
+
+	event->state = K_POLL_STATE_NOT_READY;
+	event->poller = &set->poller;
+
+	if (is_condition_met(event, &state)) {
+		event->state = state;
+		sys_dlist_append(&set->ready, &event->_node);
+	} else {
+		(void)register_event(event, &set->poller);
+	}
+}
+
+static struct k_poll_event *pollset_find(struct k_pollset *set, void *obj)
+{
+	for (int i = 0; i < set->max_events; i++) {
+		struct k_poll_event *event = &set->events[i];
+
+		if (event->type != K_POLL_TYPE_IGNORE && event->obj == obj) {
+			return event;
+		}
+	}
+
+	return NULL;
+}
+
+int _impl_k_pollset_add(struct k_pollset *set, u32_t type, void *obj,
+			u32_t tag)
+{
+	struct k_poll_event *event = NULL;
+
+	if (type != K_POLL_TYPE_SIGNAL && type != K_POLL_TYPE_SEM_AVAILABLE &&
+	    type != K_POLL_TYPE_DATA_AVAILABLE) {
+		return -EINVAL;
+	}
+
+	k_spinlock_key_t key = k_spin_lock(&lock);
+
+	if (pollset_find(set, obj) != NULL) {
+		k_spin_unlock(&lock, key);
+		return -EEXIST;
+	}
+
+	for (int i = 0; i < set->max_events; i++) {
+		if (set->events[i].type == K_POLL_TYPE_IGNORE) {
+			event = &set->events[i];
+			break;
+		}
+	}
+
+	if (event == NULL) {
+		k_spin_unlock(&lock, key);
+		return -ENOMEM;
+	}
+
+	k_poll_event_init(event, type, K_POLL_MODE_NOTIFY_ONLY, obj);
+	event->tag = tag;
+
+	k_spinlock_key_t set_key = k_spin_lock(&set->lock);
+	bool wake;
+
+	pollset_arm_event(set, event);
+	wake = !sys_dlist_is_empty(&set->ready) &&
+		_waitq_head(&set->wait_q) != NULL;
+	if (wake) {
+		_ready_one_thread(&set->wait_q);
+	}
+
+	k_spin_unlock(&set->lock, set_key);
+
+	if (wake) {
+		_reschedule(&lock, key);
+	} else {
+		k_spin_unlock(&lock, key);
+	}
+
+	return 0;
+}
+
+#ifdef CONFIG_USERSPACE
+Z_SYSCALL_HANDLER(k_pollset_add, set, type, obj, tag)
+{
+	Z_OOPS(Z_SYSCALL_OBJ(set, K_OBJ_POLLSET));
+
+	switch (type) {
+	case K_POLL_TYPE_SIGNAL:
+		Z_OOPS(Z_SYSCALL_OBJ(obj, K_OBJ_POLL_SIGNAL));
+		break;
+	case K_POLL_TYPE_SEM_AVAILABLE:
+		Z_OOPS(Z_SYSCALL_OBJ(obj, K_OBJ_SEM));
+		break;
+	case K_POLL_TYPE_DATA_AVAILABLE:
+		Z_OOPS(Z_SYSCALL_OBJ(obj, K_OBJ_QUEUE));
+		break;
+	default:
+		return -EINVAL;
+	}
+
+	return _impl_k_pollset_add((struct k_pollset *)set, type, (void *)obj,
+				   tag);
+}
+#endif
+
+int _impl_k_pollset_del(struct k_pollset *set, void *obj)
+{
+	k_spinlock_key_t key = k_spin_lock(&lock);
+	struct k_poll_event *event = pollset_find(set, obj);
+
+	if (event == NULL) {
+		k_spin_unlock(&lock, key);
+		return -ENOENT;
+	}
+
+	k_spinlock_key_t set_key = k_spin_lock(&set->lock);
+
+	/* Whether it sits on its object's list or on one of the set's,
+	 * the event is linked through _node
+	 */
+	if (sys_dnode_is_linked(&event->_node)) {
+		sys_dlist_remove(&event->_node);
+	}
+	event->poller = NULL;
+	event->type = K_POLL_TYPE_IGNORE;
+	event->obj = NULL;
+
+	k_spin_unlock(&set->lock, set_key);
+	k_spin_unlock(&lock, key);
+
+	return 0;
+}
+
+#ifdef CONFIG_USERSPACE
+Z_SYSCALL_HANDLER(k_pollset_del, set, obj)
+{
+	Z_OOPS(Z_SYSCALL_OBJ(set, K_OBJ_POLLSET));
+	return _impl_k_pollset_del((struct k_pollset *)set, (void *)obj);
+}
+#endif
+
+int _impl_k_pollset_wait(struct k_pollset *set, struct k_poll_event *events,
+			 int max_events, s32_t timeout)
+{
+	__ASSERT(!_is_in_isr() || timeout == K_NO_WAIT, "");
+	__ASSERT(max_events > 0, "zero events\n");
+
+	struct k_poll_event *event, *next;
+	sys_dnode_t *node;
+	s64_t end = 0;
+	int num = 0;
+
+	if (timeout > 0) {
+		end = z_tick_get() + _ms_to_ticks(timeout);
+	}
+
+	k_spinlock_key_t key = k_spin_lock(&lock);
+	k_spinlock_key_t set_key = k_spin_lock(&set->lock);
+
+	/* Events handed out by earlier calls were left off their objects,
+	 * so that a condition not consumed yet is not reported again while
+	 * that caller acts on it. Check them again now, whichever thread
+	 * got them: this only walks what was ready, not the whole set.
+	 */
+	SYS_DLIST_FOR_EACH_CONTAINER_SAFE(&set->reported, event, next, _node) {
+		sys_dlist_remove(&event->_node);
+		pollset_arm_event(set, event);
+	}
+
+	k_spin_unlock(&set->lock, set_key);
+	k_spin_unlock(&lock, key);
+
+	key = k_spin_lock(&set->lock);
+
+	while (sys_dlist_is_empty(&set->ready)) {
+		if (timeout == K_NO_WAIT) {
+			k_spin_unlock(&set->lock, key);
+			return -EAGAIN;
+		}
+
+		(void)_pend_curr(&set->lock, key, &set->wait_q, timeout);
+		key = k_spin_lock(&set->lock);
+
+		/* Another waiter may have taken the events we were woken
+		 * for, keep waiting for whatever is left of the timeout
+		 */
+		if (timeout != K_FOREVER && sys_dlist_is_empty(&set->ready)) {
+			s64_t left = end - z_tick_get();
+
+			if (left <= 0) {
+				k_spin_unlock(&set->lock, key);
+				return -EAGAIN;
+			}
+			timeout = __ticks_to_ms(left);
+		}
+	}
+
+	/* Handing an event out takes it off the ready list under the set
+	 * lock, so no other waiter gets it until we wait again
+	 */
+	while (num < max_events &&
+	       (node = sys_dlist_get(&set->ready)) != NULL) {
+		event = (struct k_poll_event *)node;
+
+		events[num] = *event;
+		events[num].poller = NULL;
+		(void)memset(&events[num]._node, 0, sizeof(sys_dnode_t));
+		num++;
+
+		event->poller = NULL;
+		sys_dlist_append(&set->reported, node);
+	}
+
+	k_spin_unlock(&set->lock, key);
+
+	return num;
+}
+
+#ifdef CONFIG_USERSPACE
+Z_SYSCALL_HANDLER(k_pollset_wait, set, events, max_events, timeout)
+{
+	unsigned int bounds;
+
+	Z_OOPS(Z_SYSCALL_OBJ(set, K_OBJ_POLLSET));
+	if (Z_SYSCALL_VERIFY((int)max_events > 0)) {
+		return -EINVAL;
+	}
+	if (Z_SYSCALL_VERIFY_MSG(
+		!__builtin_umul_overflow(max_events,
+					 sizeof(struct k_poll_event),
+					 &bounds),
+		"max_events too large")) {
+		return -EINVAL;
+	}
+	Z_OOPS(Z_SYSCALL_MEMORY_WRITE(events, bounds));
+
+	return _impl_k_pollset_wait((struct k_pollset *)set,
+				    (struct k_poll_event *)events,
+				    max_events, timeout);
+}
+#endif
@@ -279,13 +279,27 @@ void k_queue_merge_slist(struct k_queue *queue, sys_slist_t *list)
 	sys_slist_init(list);
 }
 
+/* must be called with the queue lock held */
+static int queue_take(struct k_queue *queue, void **data, int max)
+{
+	int num = 0;
+
+	while ((num < max) && !sys_sflist_is_empty(&queue->data_q)) {
+		sys_sfnode_t *node = sys_sflist_get_not_empty(&queue->data_q);
+
+		data[num++] = z_queue_node_peek(node, true);
+	}
+
+	return num;
+}
+
 #if defined(CONFIG_POLL)
-static void *k_queue_poll(struct k_queue *queue, s32_t timeout)
+static int k_queue_poll(struct k_queue *queue, void **data, int max,
+			s32_t timeout)
 {
 	struct k_poll_event event;
-	int err, elapsed = 0, done = 0;
+	int err, elapsed = 0, done = 0, num;
 	k_spinlock_key_t key;
-	void *val;
 	u32_t start;
 
 	k_poll_event_init(&event, K_POLL_TYPE_FIFO_DATA_AVAILABLE,
@@ -301,20 +315,20 @@ static void *k_queue_poll(struct k_queue *queue, s32_t timeout)
 		err = k_poll(&event, 1, timeout - elapsed);
 
 		if (err && err != -EAGAIN) {
-			return NULL;
+			return 0;
 		}
 
 		key = k_spin_lock(&queue->lock);
-		val = z_queue_node_peek(sys_sflist_get(&queue->data_q), true);
+		num = queue_take(queue, data, max);
 		k_spin_unlock(&queue->lock, key);
 
-		if ((val == NULL) && (timeout != K_FOREVER)) {
+		if ((num == 0) && (timeout != K_FOREVER)) {
 			elapsed = k_uptime_get_32() - start;
 			done = elapsed > timeout;
 		}
-	} while (!val && !done);
+	} while (!num && !done);
 
-	return val;
+	return num;
 }
 #endif /* CONFIG_POLL */
 
@@ -340,7 +354,7 @@ void *_impl_k_queue_get(struct k_queue *queue, s32_t timeout)
 #if defined(CONFIG_POLL)
 	k_spin_unlock(&queue->lock, key);
 
-	return k_queue_poll(queue, timeout);
+	return (k_queue_poll(queue, &data, 1, timeout) != 0) ? data : NULL;
 
 #else
 	int ret = _pend_curr(&queue->lock, key, &queue->wait_q, timeout);
@@ -349,6 +363,47 @@ void *_impl_k_queue_get(struct k_queue *queue, s32_t timeout)
 #endif /* CONFIG_POLL */
 }
 
+int _impl_k_queue_get_batch(struct k_queue *queue, void **data, int max,
+			    s32_t timeout)
+{
+	__ASSERT(max > 0, "max must be positive");
+
+	k_spinlock_key_t key = k_spin_lock(&queue->lock);
+	int num = queue_take(queue, data, max);
+
+	if ((num != 0) || (timeout == K_NO_WAIT)) {
+		k_spin_unlock(&queue->lock, key);
+		return num;
+	}
+
+#if defined(CONFIG_POLL)
+	k_spin_unlock(&queue->lock, key);
+
+	return k_queue_poll(queue, data, max, timeout);
+
+#else
+	int ret = _pend_curr(&queue->lock, key, &queue->wait_q, timeout);
+
+	/* The producer handed us its item directly, NULL means the wait
+	 * was cancelled
+	 */
+	data[0] = _current->base.swap_data;
+	if ((ret != 0) || (data[0] == NULL)) {
+		return 0;
+	}
+
+	if (max == 1) {
+		return 1;
+	}
+
+	key = k_spin_lock(&queue->lock);
+	num = 1 + queue_take(queue, &data[1], max - 1);
+	k_spin_unlock(&queue->lock, key);
+
+	return num;
+#endif /* CONFIG_POLL */
+}
+
 #ifdef CONFIG_USERSPACE
 Z_SYSCALL_HANDLER(k_queue_get, queue, timeout_p)
 {
@@ -359,6 +414,23 @@ Z_SYSCALL_HANDLER(k_queue_get, queue, timeout_p)
 	return (u32_t)_impl_k_queue_get((struct k_queue *)queue, timeout);
 }
 
+Z_SYSCALL_HANDLER(k_queue_get_batch, queue, data, max, timeout_p)
+{
+	s32_t timeout = timeout_p;
+	unsigned int bounds;
+
+	Z_OOPS(Z_SYSCALL_OBJ(queue, K_OBJ_QUEUE));
+	Z_OOPS(Z_SYSCALL_VERIFY((int)max > 0));
+	Z_OOPS(Z_SYSCALL_VERIFY_MSG(!__builtin_umul_overflow(max,
+							     sizeof(void *),
+							     &bounds),
+				    "max too large"));
+	Z_OOPS(Z_SYSCALL_MEMORY_WRITE(data, bounds));
+
+	return _impl_k_queue_get_batch((struct k_queue *)queue, (void **)data,
+				       max, timeout);
+}
+
 Z_SYSCALL_HANDLER1_SIMPLE(k_queue_is_empty, K_OBJ_QUEUE, struct k_queue *);
 Z_SYSCALL_HANDLER1_SIMPLE(k_queue_peek_head, K_OBJ_QUEUE, struct k_queue *);
 Z_SYSCALL_HANDLER1_SIMPLE(k_queue_peek_tail, K_OBJ_QUEUE, struct k_queue *);
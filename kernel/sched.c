@@ -176,6 +176,157 @@ static ALWAYS_INLINE struct k_thread *_priq_dumb_mask_best(sys_dlist_t *pq)
 }
 #endif
 
+#ifdef CONFIG_SCHED_PERCPU_RUNQ
+/* Each CPU's run queue, and the runq_cpu field of the threads it
+ * holds, is protected by its own lock.  When both are needed
+ * sched_lock is taken first.  Only steal_thread() holds two run
+ * queue locks at once, and takes them in CPU id order.
+ */
+static struct k_spinlock runq_locks[CONFIG_MP_NUM_CPUS];
+
+static ALWAYS_INLINE bool cpu_allowed(struct k_thread *th, int cpu)
+{
+#ifdef CONFIG_SCHED_CPU_MASK
+	return (th->base.cpu_mask & BIT(cpu)) != 0;
+#else
+	return true;
+#endif
+}
+
+static ALWAYS_INLINE bool cpu_is_idle(int cpu)
+{
+	struct k_thread *curr = _kernel.cpus[cpu].current;
+
+	return curr != NULL && _is_idle(curr);
+}
+
+/* Picks the run queue of a thread becoming ready: the CPU it last ran
+ * on, to keep it cache-hot, unless that CPU is busy with a thread of
+ * equal or higher priority and another permitted CPU sits idle.
+ */
+static struct _cpu *runq_select(struct k_thread *th)
+{
+	int cpu = th->base.cpu;
+	struct k_thread *curr;
+
+	if (!cpu_allowed(th, cpu)) {
+		for (cpu = 0; cpu < CONFIG_MP_NUM_CPUS - 1; cpu++) {
+			if (cpu_allowed(th, cpu)) {
+				break;
+			}
+		}
+	}
+
+	curr = _kernel.cpus[cpu].current;
+	if (cpu_is_idle(cpu) ||
+	    (curr != NULL && _is_t1_higher_prio_than_t2(th, curr))) {
+		return &_kernel.cpus[cpu];
+	}
+
+	for (int i = 0; i < CONFIG_MP_NUM_CPUS; i++) {
+		if (cpu_allowed(th, i) && cpu_is_idle(i)) {
+			return &_kernel.cpus[i];
+		}
+	}
+
+	return &_kernel.cpus[cpu];
+}
+
+static ALWAYS_INLINE void runq_add_locked(struct _cpu *cpu,
+					  struct k_thread *thread)
+{
+	_priq_run_add(&cpu->ready_q.runq, thread);
+	thread->base.runq_cpu = cpu;
+}
+
+static ALWAYS_INLINE void runq_remove_locked(struct k_thread *thread)
+{
+	_priq_run_remove(&thread->base.runq_cpu->ready_q.runq, thread);
+	thread->base.runq_cpu = NULL;
+}
+
+/* A thread that is running when re-queued (yield, time slice
+ * expiry) stays on its CPU, others go where runq_select() says.
+ */
+static void runq_add(struct k_thread *thread)
+{
+	struct _cpu *cpu = thread == _current ? _current_cpu
+		: runq_select(thread);
+
+	LOCKED(&runq_locks[cpu->id]) {
+		runq_add_locked(cpu, thread);
+	}
+}
+
+/* The queue holding a thread can change (another CPU may steal it)
+ * until that queue's lock is held, so recheck under the lock.
+ */
+static void runq_remove(struct k_thread *thread)
+{
+	struct _cpu *cpu;
+	bool removed = false;
+
+	while (!removed && (cpu = thread->base.runq_cpu) != NULL) {
+		LOCKED(&runq_locks[cpu->id]) {
+			if (thread->base.runq_cpu == cpu) {
+				runq_remove_locked(thread);
+				removed = true;
+			}
+		}
+	}
+}
+
+/* Moves the best thread out of another CPU's run queue into the one
+ * of cpu, visiting the other CPUs round robin starting with the next
+ * one.  Both queues are locked for the move, so that the thread is
+ * always owned by one of them and runq_remove() cannot miss it.
+ * Called with no run queue lock held.
+ */
+static void steal_thread(struct _cpu *cpu)
+{
+	struct k_thread *th = NULL;
+	int me = cpu->id;
+
+	for (int i = 1; th == NULL && i < CONFIG_MP_NUM_CPUS; i++) {
+		int other = (me + i) % CONFIG_MP_NUM_CPUS;
+		struct _cpu *victim = &_kernel.cpus[other];
+		struct k_spinlock *first = &runq_locks[MIN(me, other)];
+		struct k_spinlock *second = &runq_locks[MAX(me, other)];
+		k_spinlock_key_t key1 = k_spin_lock(first);
+		k_spinlock_key_t key2 = k_spin_lock(second);
+
+		th = _priq_run_best(&victim->ready_q.runq);
+		if (th != NULL) {
+			_priq_run_remove(&victim->ready_q.runq, th);
+			runq_add_locked(cpu, th);
+		}
+
+		k_spin_unlock(second, key2);
+		k_spin_unlock(first, key1);
+	}
+}
+
+/* Lock protecting the state next_up() looks at */
+#define NEXT_UP_LOCK (&runq_locks[_current_cpu->id])
+
+#else
+
+static ALWAYS_INLINE void runq_add(struct k_thread *thread)
+{
+	_priq_run_add(&_kernel.ready_q.runq, thread);
+	_mark_thread_as_queued(thread);
+}
+
+static ALWAYS_INLINE void runq_remove(struct k_thread *thread)
+{
+	_priq_run_remove(&_kernel.ready_q.runq, thread);
+	_mark_thread_as_not_queued(thread);
+}
+
+#define NEXT_UP_LOCK (&sched_lock)
+
+#endif /* CONFIG_SCHED_PERCPU_RUNQ */
+
 static ALWAYS_INLINE struct k_thread *next_up(void)
 {
 #ifndef CONFIG_SMP
@@ -188,6 +339,52 @@ static ALWAYS_INLINE struct k_thread *next_up(void)
 	struct k_thread *th = _priq_run_best(&_kernel.ready_q.runq);
 
 	return th ? th : _current_cpu->idle_thread;
+#elif defined(CONFIG_SCHED_PERCPU_RUNQ)
+	/* Same logic as below, but choosing from the local run queue
+	 * only.  A CPU that would otherwise go idle first tries to
+	 * steal a thread from another CPU, which means dropping its
+	 * own queue's lock for a moment.
+	 */
+	struct _cpu *cpu = _current_cpu;
+	int active = !_is_thread_prevented_from_running(_current);
+	struct k_thread *th = _priq_run_best(&cpu->ready_q.runq);
+	int queued;
+
+	if (th == NULL && (!active || _is_idle(_current))) {
+		k_spin_release(NEXT_UP_LOCK);
+		steal_thread(cpu);
+		(void)k_spin_lock(NEXT_UP_LOCK);
+
+		th = _priq_run_best(&cpu->ready_q.runq);
+	}
+
+	if (th == NULL) {
+		th = cpu->idle_thread;
+	}
+
+	queued = _is_thread_queued(_current);
+
+	if (active) {
+		if (!queued &&
+		    !_is_t1_higher_prio_than_t2(th, _current)) {
+			th = _current;
+		}
+
+		if (!should_preempt(th, cpu->swap_ok)) {
+			th = _current;
+		}
+	}
+
+	if (th != _current && active && !_is_idle(_current) && !queued) {
+		runq_add_locked(cpu, _current);
+	}
+
+	if (_is_thread_queued(th)) {
+		__ASSERT_NO_MSG(th->base.runq_cpu == cpu);
+		runq_remove_locked(th);
+	}
+
+	return th;
 #else
 
 	/* Under SMP, the "cache" mechanism for selecting the next
@@ -331,8 +528,7 @@ static void update_cache(int preempt_ok)
 void _add_thread_to_ready_q(struct k_thread *thread)
 {
 	LOCKED(&sched_lock) {
-		_priq_run_add(&_kernel.ready_q.runq, thread);
-		_mark_thread_as_queued(thread);
+		runq_add(thread);
 		update_cache(0);
 	}
 }
@@ -340,9 +536,8 @@ void _add_thread_to_ready_q(struct k_thread *thread)
 void _move_thread_to_end_of_prio_q(struct k_thread *thread)
 {
 	LOCKED(&sched_lock) {
-		_priq_run_remove(&_kernel.ready_q.runq, thread);
-		_priq_run_add(&_kernel.ready_q.runq, thread);
-		_mark_thread_as_queued(thread);
+		runq_remove(thread);
+		runq_add(thread);
 		update_cache(thread == _current);
 	}
 }
@@ -351,8 +546,7 @@ void _remove_thread_from_ready_q(struct k_thread *thread)
 {
 	LOCKED(&sched_lock) {
 		if (_is_thread_queued(thread)) {
-			_priq_run_remove(&_kernel.ready_q.runq, thread);
-			_mark_thread_as_not_queued(thread);
+			runq_remove(thread);
 			update_cache(thread == _current);
 		}
 	}
@@ -479,9 +673,9 @@ void _thread_priority_set(struct k_thread *thread, int prio)
 		need_sched = _is_thread_ready(thread);
 
 		if (need_sched) {
-			_priq_run_remove(&_kernel.ready_q.runq, thread);
+			runq_remove(thread);
 			thread->base.prio = prio;
-			_priq_run_add(&_kernel.ready_q.runq, thread);
+			runq_add(thread);
 			update_cache(1);
 		} else {
 			thread->base.prio = prio;
@@ -554,7 +748,7 @@ struct k_thread *_get_next_ready_thread(void)
 {
 	struct k_thread *ret = 0;
 
-	LOCKED(&sched_lock) {
+	LOCKED(NEXT_UP_LOCK) {
 		ret = next_up();
 	}
 
@@ -568,7 +762,7 @@ void *_get_next_switch_handle(void *interrupted)
 	_current->switch_handle = interrupted;
 
 #ifdef CONFIG_SMP
-	LOCKED(&sched_lock) {
+	LOCKED(NEXT_UP_LOCK) {
 		struct k_thread *th = next_up();
 
 		if (_current != th) {
@@ -750,14 +944,14 @@ int _unpend_all(_wait_q_t *wait_q)
 	return need_sched;
 }
 
-void _sched_init(void)
+static void init_ready_q(struct _ready_q *rq)
 {
 #ifdef CONFIG_SCHED_DUMB
-	sys_dlist_init(&_kernel.ready_q.runq);
+	sys_dlist_init(&rq->runq);
 #endif
 
 #ifdef CONFIG_SCHED_SCALABLE
-	_kernel.ready_q.runq = (struct _priq_rb) {
+	rq->runq = (struct _priq_rb) {
 		.tree = {
 			.lessthan_fn = _priq_rb_lessthan,
 		}
@@ -765,8 +959,19 @@ void _sched_init(void)
 #endif
 
 #ifdef CONFIG_SCHED_MULTIQ
-	for (int i = 0; i < ARRAY_SIZE(_kernel.ready_q.runq.queues); i++) {
-		sys_dlist_init(&_kernel.ready_q.runq.queues[i]);
+	for (int i = 0; i < ARRAY_SIZE(rq->runq.queues); i++) {
+		sys_dlist_init(&rq->runq.queues[i]);
+	}
+#endif
+}
+
+void _sched_init(void)
+{
+	init_ready_q(&_kernel.ready_q);
+
+#ifdef CONFIG_SCHED_PERCPU_RUNQ
+	for (int i = 0; i < CONFIG_MP_NUM_CPUS; i++) {
+		init_ready_q(&_kernel.cpus[i].ready_q);
 	}
 #endif
 
@@ -825,8 +1030,8 @@ void _impl_k_thread_deadline_set(k_tid_t tid, int deadline)
 	LOCKED(&sched_lock) {
 		th->base.prio_deadline = k_cycle_get_32() + deadline;
 		if (_is_thread_queued(th)) {
-			_priq_run_remove(&_kernel.ready_q.runq, th);
-			_priq_run_add(&_kernel.ready_q.runq, th);
+			runq_remove(th);
+			runq_add(th);
 		}
 	}
 }
@@ -853,8 +1058,10 @@ void _impl_k_yield(void)
 
 	if (!_is_idle(_current)) {
 		LOCKED(&sched_lock) {
-			_priq_run_remove(&_kernel.ready_q.runq, _current);
-			_priq_run_add(&_kernel.ready_q.runq, _current);
+			if (_is_thread_queued(_current)) {
+				runq_remove(_current);
+			}
+			runq_add(_current);
 			update_cache(1);
 		}
 	}
@@ -13,13 +13,26 @@
 #ifdef CONFIG_SMP
 static atomic_t global_lock;
 
+/* The global lock may be released by a thread that does not hold it
+ * (see _smp_release_global_lock()), so it stays a plain test-and-set
+ * lock whatever the spinlock implementation: clearing it is harmless
+ * when it is not held.  Waiting CPUs only poll it though, and try to
+ * take it once it looks free.
+ */
+static void global_lock_take(void)
+{
+	while (!atomic_cas(&global_lock, 0, 1)) {
+		while (atomic_get(&global_lock) != 0) {
+		}
+	}
+}
+
 unsigned int _smp_global_lock(void)
 {
 	unsigned int key = _arch_irq_lock();
 
 	if (!_current->base.global_lock_count) {
-		while (!atomic_cas(&global_lock, 0, 1)) {
-		}
+		global_lock_take();
 	}
 
 	_current->base.global_lock_count++;
@@ -45,8 +58,7 @@ void _smp_reacquire_global_lock(struct k_thread *thread)
 	if (thread->base.global_lock_count) {
 		_arch_irq_lock();
 
-		while (!atomic_cas(&global_lock, 0, 1)) {
-		}
+		global_lock_take();
 	}
 }
 
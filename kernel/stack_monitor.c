@@ -0,0 +1,116 @@
+/*
+ * Copyright (c) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file
+ * @brief Sampled stack usage monitor
+ *
+ * Instead of painting stacks at thread creation and scanning them for the
+ * high-water mark, the stack pointer is sampled at points where it is
+ * cheap to obtain: when the outgoing thread enters _Swap(), and on the
+ * interrupt stack when a tick is announced. All stacks are assumed to
+ * grow down, see misc/stack.h.
+ */
+
+#include <kernel.h>
+#include <kernel_structs.h>
+#include <ksched.h>
+#include <kswap.h>
+
+K_THREAD_STACK_EXTERN(_interrupt_stack);
+
+static u32_t isr_stack_max_used[CONFIG_MP_NUM_CPUS];
+
+#ifdef CONFIG_STACK_USAGE_MONITOR_GUARD
+BUILD_ASSERT_MSG((CONFIG_STACK_USAGE_MONITOR_GUARD_SIZE % 4) == 0,
+		 "STACK_USAGE_MONITOR_GUARD_SIZE must be a multiple of 4");
+
+#define GUARD_WORD (STACK_GUARD_PATTERN * 0x01010101U)
+
+static void check_stack_guard(struct k_thread *thread)
+{
+	u32_t *guard = (u32_t *)(thread->stack_info.start +
+				 STACK_GUARD_OFFSET);
+	int i;
+
+	for (i = 0; i < CONFIG_STACK_USAGE_MONITOR_GUARD_SIZE / 4; i++) {
+		if (guard[i] != GUARD_WORD) {
+			/* Restore it so further checks don't trigger this
+			 * same error
+			 */
+			(void)memset(guard, STACK_GUARD_PATTERN,
+				     CONFIG_STACK_USAGE_MONITOR_GUARD_SIZE);
+			_k_except_reason(_NANO_ERR_STACK_CHK_FAIL);
+			return;
+		}
+	}
+}
+#endif
+
+/* Called by the outgoing thread on its own stack, from _Swap(). The frame
+ * address of this function is a close lower bound of the stack pointer at
+ * the switch.
+ */
+void _stack_usage_sample(void)
+{
+	struct k_thread *thread = _current;
+	uintptr_t sp = (uintptr_t)__builtin_frame_address(0);
+	uintptr_t start, end;
+
+	if ((thread->base.thread_state & _THREAD_DUMMY) != 0) {
+		return;
+	}
+
+	start = (uintptr_t)thread->stack_info.start;
+	end = start + thread->stack_info.size;
+
+	/* A user thread in a system call runs on its privileged stack,
+	 * which is not the one being monitored.
+	 */
+	if (sp > start && sp <= end &&
+	    end - sp > thread->stack_info.max_used) {
+		thread->stack_info.max_used = end - sp;
+	}
+
+#ifdef CONFIG_STACK_USAGE_MONITOR_GUARD
+	check_stack_guard(thread);
+#endif
+}
+
+/* Called on each tick announcement, normally from the timer interrupt */
+void _stack_usage_sample_isr(void)
+{
+	int cpu = _current_cpu->id;
+	uintptr_t sp = (uintptr_t)__builtin_frame_address(0);
+	uintptr_t end;
+
+	if (cpu == 0) {
+		end = (uintptr_t)K_THREAD_STACK_BUFFER(_interrupt_stack) +
+			CONFIG_ISR_STACK_SIZE;
+	} else {
+		end = (uintptr_t)_current_cpu->irq_stack;
+	}
+
+	/* Ports that run interrupts on the interrupted thread stack never
+	 * record anything here.
+	 */
+	if (sp < end && end - sp <= CONFIG_ISR_STACK_SIZE &&
+	    end - sp > isr_stack_max_used[cpu]) {
+		isr_stack_max_used[cpu] = end - sp;
+	}
+}
+
+size_t k_thread_stack_usage_get(k_tid_t thread)
+{
+	return thread->stack_info.max_used;
+}
+
+size_t k_isr_stack_usage_get(int cpu)
+{
+	__ASSERT(cpu >= 0 && cpu < CONFIG_MP_NUM_CPUS, "invalid cpu %d", cpu);
+
+	return isr_stack_max_used[cpu];
+}
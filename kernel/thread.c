@@ -30,6 +30,7 @@
 #include <init.h>
 #include <tracing.h>
 #include <stdbool.h>
+#include <string.h>
 
 extern struct _static_thread_data _static_thread_data_list_start[];
 extern struct _static_thread_data _static_thread_data_list_end[];
@@ -394,6 +395,10 @@ void _setup_new_thread(struct k_thread *new_thread,
 #ifdef CONFIG_SCHED_CPU_MASK
 	new_thread->base.cpu_mask = -1;
 #endif
+#ifdef CONFIG_TRACING_CPU_STATS_THREADS
+	(void)memset(&new_thread->runtime_stats, 0,
+		     sizeof(new_thread->runtime_stats));
+#endif
 #ifdef CONFIG_ARCH_HAS_CUSTOM_SWAP_TO_MAIN
 	/* _current may be null if the dummy thread is not used */
 	if (!_current) {
@@ -703,8 +708,8 @@ FUNC_NORETURN void k_thread_user_mode_enter(k_thread_entry_t entry,
 #endif
 }
 
-/* These spinlock assertion predicates are defined here because having
- * them in spinlock.h is a giant header ordering headache.
+/* These spinlock assertion predicates and statistics are defined here
+ * because having them in spinlock.h is a giant header ordering headache.
  */
 #ifdef SPIN_VALIDATE
 int z_spin_lock_valid(struct k_spinlock *l)
@@ -727,3 +732,44 @@ int z_spin_unlock_valid(struct k_spinlock *l)
 	return 1;
 }
 #endif
+
+#ifdef CONFIG_SPINLOCK_STATS
+/* Some timer drivers take a spinlock to read the cycle counter, which
+ * must not be timed in turn
+ */
+static bool spin_stats_busy[CONFIG_MP_NUM_CPUS];
+
+void z_spin_lock_stats(struct k_spinlock *l, u32_t spins)
+{
+	struct k_spinlock_stats *stats = &l->stats;
+	bool *busy = &spin_stats_busy[_current_cpu->id];
+
+	stats->acquired++;
+	if (spins != 0U) {
+		stats->contended++;
+		stats->spins += spins;
+	}
+
+	if (!*busy) {
+		*busy = true;
+		stats->hold_start = k_cycle_get_32();
+		*busy = false;
+	}
+}
+
+void z_spin_unlock_stats(struct k_spinlock *l)
+{
+	struct k_spinlock_stats *stats = &l->stats;
+	bool *busy = &spin_stats_busy[_current_cpu->id];
+	u32_t held;
+
+	if (!*busy) {
+		*busy = true;
+		held = k_cycle_get_32() - stats->hold_start;
+		if (held > stats->hold_max) {
+			stats->hold_max = held;
+		}
+		*busy = false;
+	}
+}
+#endif
@@ -9,6 +9,10 @@
 #include <spinlock.h>
 #include <ksched.h>
 #include <syscall_handler.h>
+#ifdef CONFIG_TIME_PAGE
+#include <init.h>
+#include <app_memory/app_memdomain.h>
+#endif
 
 #define LOCKED(lck) for (k_spinlock_key_t __i = {},			\
 					  __key = k_spin_lock(lck);	\
@@ -17,7 +21,9 @@
 
 static u64_t curr_tick;
 
+#ifndef CONFIG_TIMEOUT_QUEUE_WHEEL
 static sys_dlist_t timeout_list = SYS_DLIST_STATIC_INIT(&timeout_list);
+#endif
 
 static struct k_spinlock timeout_lock;
 
@@ -30,6 +36,399 @@ static int announce_remaining;
 int z_clock_hw_cycles_per_sec = CONFIG_SYS_CLOCK_HW_CYCLES_PER_SEC;
 #endif
 
+#ifdef CONFIG_TIMEOUT_STATS
+static struct k_timeout_stats timeout_stats;
+#define STATS_INC(field) (timeout_stats.field++)
+#else
+#define STATS_INC(field) do {} while (false)
+#endif
+
+#ifdef CONFIG_TIME_PAGE
+K_APPMEM_PARTITION_DEFINE(z_time_page_partition);
+K_APP_BMEM(z_time_page_partition) struct z_time_page z_time_page;
+
+/* Publishes curr_tick to user threads, see z_time_page_ticks() */
+static void time_page_update(void)
+{
+	u32_t seq = z_time_page.seq;
+
+	__atomic_store_n(&z_time_page.seq, seq + 1, __ATOMIC_RELAXED);
+	__atomic_thread_fence(__ATOMIC_RELEASE);
+	__atomic_store_n(&z_time_page.ticks_lo, (u32_t)curr_tick,
+			 __ATOMIC_RELAXED);
+	__atomic_store_n(&z_time_page.ticks_hi, (u32_t)(curr_tick >> 32),
+			 __ATOMIC_RELAXED);
+	__atomic_store_n(&z_time_page.seq, seq + 2, __ATOMIC_RELEASE);
+}
+
+static int time_page_init(struct device *unused)
+{
+	ARG_UNUSED(unused);
+
+#if defined(CONFIG_X86)
+	/* Partitions only apply to the user page tables with KPTI, so
+	 * the kernel can still write the page
+	 */
+	z_time_page_partition.attr = K_MEM_PARTITION_P_RO_U_RO;
+#elif defined(K_MEM_PARTITION_P_RW_U_RO)
+	z_time_page_partition.attr = K_MEM_PARTITION_P_RW_U_RO;
+#else
+#error "No memory partition attribute for the time page"
+#endif
+	return 0;
+}
+
+SYS_INIT(time_page_init, PRE_KERNEL_1, CONFIG_KERNEL_INIT_PRIORITY_DEFAULT);
+#endif /* CONFIG_TIME_PAGE */
+
+/* Bounds the next timer interrupt, in ticks, so that the time page
+ * is refreshed often enough in tickless mode
+ */
+static inline s32_t time_page_bound(s32_t ticks)
+{
+#if defined(CONFIG_TIME_PAGE_MAX_AGE_MS) && CONFIG_TIME_PAGE_MAX_AGE_MS > 0
+	s32_t max = MAX(1, _ms_to_ticks(CONFIG_TIME_PAGE_MAX_AGE_MS));
+
+	if (ticks == K_FOREVER || ticks > max) {
+		return max;
+	}
+#endif
+	return ticks;
+}
+
+static inline s32_t timeout_slack(struct _timeout *t)
+{
+#ifdef CONFIG_TIMEOUT_SLACK
+	return t->slack;
+#else
+	ARG_UNUSED(t);
+	return 0;
+#endif
+}
+
+#ifdef CONFIG_TIMEOUT_QUEUE_WHEEL
+/*
+ * Hierarchical timing wheel.  Level N has WHEEL_SLOTS buckets, each
+ * one spanning 2^(N * WHEEL_BITS) ticks, and receives the timeouts
+ * whose distance from curr_tick at insertion time lies between
+ * 2^(N * WHEEL_BITS) and 2^((N + 1) * WHEEL_BITS) ticks.  A bucket is
+ * emptied when curr_tick enters the tick range it indexes, and its
+ * timeouts are re-inserted at a lower level (or onto the expired
+ * list), so insertion and removal are O(1) and each timeout is moved
+ * at most once per level.
+ */
+#define WHEEL_BITS CONFIG_TIMEOUT_WHEEL_SLOT_BITS
+#define WHEEL_SLOTS BIT(WHEEL_BITS)
+#define WHEEL_MASK (WHEEL_SLOTS - 1)
+#define WHEEL_ALL ((u32_t)((1ULL << WHEEL_SLOTS) - 1))
+#define WHEEL_LEVELS ((32 + WHEEL_BITS - 1) / WHEEL_BITS)
+#define WHEEL_NONE UINT64_MAX
+
+/* A bucket list head is only valid while its bit is set in
+ * wheel_occupied[], so the (large) array needs no static
+ * initialization.  _abort_timeout() may leave the bit of an emptied
+ * bucket set, it is cleared lazily by wheel_next_slot().
+ */
+static sys_dlist_t wheel[WHEEL_LEVELS][WHEEL_SLOTS];
+
+static u32_t wheel_occupied[WHEEL_LEVELS];
+
+/* Timeouts which have reached their expiry tick but whose callbacks
+ * have not been run yet by z_clock_announce()
+ */
+static sys_dlist_t expired_list = SYS_DLIST_STATIC_INIT(&expired_list);
+
+/* Cached result of wheel_next_expiry() */
+static u64_t next_expiry;
+static bool next_expiry_valid;
+
+static struct _timeout *first_expired(void)
+{
+	sys_dnode_t *t = sys_dlist_peek_head(&expired_list);
+
+	return t == NULL ? NULL : CONTAINER_OF(t, struct _timeout, node);
+}
+
+static void wheel_insert(struct _timeout *to)
+{
+	u64_t delta = to->expiry - curr_tick;
+	int lvl, slot;
+
+	if (to->expiry <= curr_tick) {
+		sys_dlist_append(&expired_list, &to->node);
+		return;
+	}
+
+	lvl = (31 - __builtin_clz((u32_t)MIN(delta, UINT32_MAX))) / WHEEL_BITS;
+	slot = (to->expiry >> (lvl * WHEEL_BITS)) & WHEEL_MASK;
+
+	if ((wheel_occupied[lvl] & BIT(slot)) == 0U) {
+		sys_dlist_init(&wheel[lvl][slot]);
+		wheel_occupied[lvl] |= BIT(slot);
+	}
+	sys_dlist_append(&wheel[lvl][slot], &to->node);
+}
+
+/* Returns the distance (1..WHEEL_SLOTS) in buckets from the current
+ * one to the next non-empty bucket of a level, or 0 if it is empty.
+ * The current bucket itself is entered again last.
+ */
+static int wheel_next_slot(int lvl)
+{
+	int now = (curr_tick >> (lvl * WHEEL_BITS)) & WHEEL_MASK;
+	int start = (now + 1) & WHEEL_MASK;
+
+	while (wheel_occupied[lvl] != 0U) {
+		u32_t bits = wheel_occupied[lvl];
+		u32_t rot = bits >> start;
+		int k, slot;
+
+		if (start != 0) {
+			rot |= (bits << (WHEEL_SLOTS - start)) & WHEEL_ALL;
+		}
+
+		k = __builtin_ctz(rot) + 1;
+		slot = (now + k) & WHEEL_MASK;
+
+		if (!sys_dlist_is_empty(&wheel[lvl][slot])) {
+			return k;
+		}
+		wheel_occupied[lvl] &= ~BIT(slot);
+	}
+
+	return 0;
+}
+
+/* Absolute tick of the earliest pending expiry, or WHEEL_NONE.  The
+ * next bucket of each level holds that level's earliest timeouts;
+ * level 0 buckets are exactly one tick wide, upper level buckets are
+ * scanned, which is only needed when the cached value is stale.
+ */
+static u64_t wheel_next_expiry(void)
+{
+	u64_t ret;
+
+	if (next_expiry_valid) {
+		return next_expiry;
+	}
+
+	ret = sys_dlist_is_empty(&expired_list) ? WHEEL_NONE : curr_tick;
+
+	for (int lvl = 0; lvl < WHEEL_LEVELS; lvl++) {
+		int shift = lvl * WHEEL_BITS;
+		int k = wheel_next_slot(lvl);
+		u64_t start = ((curr_tick >> shift) + k) << shift;
+		struct _timeout *t;
+
+		if (k == 0 || start >= ret) {
+			continue;
+		}
+
+		if (lvl == 0) {
+			ret = start;
+			continue;
+		}
+
+		SYS_DLIST_FOR_EACH_CONTAINER(&wheel[lvl][(start >> shift) &
+						      WHEEL_MASK], t, node) {
+			ret = MIN(ret, t->expiry);
+		}
+	}
+
+	next_expiry = ret;
+	next_expiry_valid = true;
+	return ret;
+}
+
+#ifdef CONFIG_TIMEOUT_SLACK
+/* Cached result of wheel_next_deadline() */
+static u64_t next_deadline;
+static bool next_deadline_valid;
+
+/* Absolute tick by which the timer must fire, i.e. the earliest
+ * expiry plus slack of all pending timeouts.  A bucket never starts
+ * after the expiries it holds, so the scan of each level stops at
+ * the first bucket starting after the best deadline found so far.
+ */
+static u64_t wheel_next_deadline(void)
+{
+	u64_t ret;
+
+	if (next_deadline_valid) {
+		return next_deadline;
+	}
+
+	ret = sys_dlist_is_empty(&expired_list) ? WHEEL_NONE : curr_tick;
+
+	for (int lvl = 0; lvl < WHEEL_LEVELS; lvl++) {
+		int shift = lvl * WHEEL_BITS;
+		u64_t now = curr_tick >> shift;
+		struct _timeout *t;
+
+		for (int k = 1; k <= WHEEL_SLOTS; k++) {
+			int slot = (now + k) & WHEEL_MASK;
+
+			if (((now + k) << shift) >= ret) {
+				break;
+			}
+
+			if ((wheel_occupied[lvl] & BIT(slot)) == 0U) {
+				continue;
+			}
+
+			SYS_DLIST_FOR_EACH_CONTAINER(&wheel[lvl][slot], t,
+						     node) {
+				ret = MIN(ret, t->expiry + t->slack);
+			}
+		}
+	}
+
+	next_deadline = ret;
+	next_deadline_valid = true;
+	return ret;
+}
+#else
+#define wheel_next_deadline() wheel_next_expiry()
+#endif
+
+/* Moves curr_tick forward, emptying every bucket whose tick range
+ * was entered on the way and re-inserting its timeouts.
+ */
+static void wheel_advance(u64_t tick)
+{
+	sys_dlist_t todo;
+	sys_dnode_t *node;
+
+	sys_dlist_init(&todo);
+
+	for (int lvl = 0; lvl < WHEEL_LEVELS; lvl++) {
+		int shift = lvl * WHEEL_BITS;
+		u64_t from = curr_tick >> shift;
+		u64_t crossed = (tick >> shift) - from;
+		u32_t pending = WHEEL_ALL;
+
+		if (crossed == 0) {
+			break;
+		}
+
+		if (crossed < WHEEL_SLOTS) {
+			u32_t run = BIT(crossed) - 1;
+			int start = (from + 1) & WHEEL_MASK;
+
+			pending = run << start;
+			if (start != 0) {
+				pending |= run >> (WHEEL_SLOTS - start);
+			}
+			pending &= WHEEL_ALL;
+		}
+
+		pending &= wheel_occupied[lvl];
+		while (pending != 0U) {
+			int slot = __builtin_ctz(pending);
+
+			while ((node = sys_dlist_get(&wheel[lvl][slot])) != NULL) {
+				sys_dlist_append(&todo, node);
+			}
+			pending &= ~BIT(slot);
+			wheel_occupied[lvl] &= ~BIT(slot);
+		}
+	}
+
+	curr_tick = tick;
+	next_expiry_valid = false;
+#ifdef CONFIG_TIMEOUT_SLACK
+	next_deadline_valid = false;
+#endif
+
+	while ((node = sys_dlist_get(&todo)) != NULL) {
+		wheel_insert(CONTAINER_OF(node, struct _timeout, node));
+	}
+}
+
+static s32_t elapsed(void)
+{
+	return announce_remaining == 0 ? z_clock_elapsed() : 0;
+}
+
+static s32_t next_timeout(void)
+{
+	int maxw = can_wait_forever ? K_FOREVER : INT_MAX;
+	u64_t next = wheel_next_deadline();
+	s32_t ret = maxw;
+
+	if (next != WHEEL_NONE) {
+		ret = MAX(0, (s32_t)MIN(next - curr_tick, INT_MAX) - elapsed());
+	}
+
+#ifdef CONFIG_TIMESLICING
+	if (_current_cpu->slice_ticks && _current_cpu->slice_ticks < ret) {
+		ret = _current_cpu->slice_ticks;
+	}
+#endif
+	return time_page_bound(ret);
+}
+
+void _add_timeout(struct _timeout *to, _timeout_func_t fn, s32_t ticks)
+{
+	__ASSERT(!sys_dnode_is_linked(&to->node), "");
+	to->fn = fn;
+	ticks = MAX(1, ticks);
+
+	LOCKED(&timeout_lock) {
+		u64_t prev = wheel_next_expiry();
+		u64_t prev_deadline = wheel_next_deadline();
+
+		to->expiry = curr_tick + ticks + elapsed();
+		wheel_insert(to);
+
+		next_expiry = MIN(prev, to->expiry);
+		if (to->expiry + timeout_slack(to) < prev_deadline) {
+#ifdef CONFIG_TIMEOUT_SLACK
+			next_deadline = to->expiry + to->slack;
+#endif
+			z_clock_set_timeout(next_timeout(), false);
+		}
+	}
+}
+
+int _abort_timeout(struct _timeout *to)
+{
+	int ret = -EINVAL;
+
+	LOCKED(&timeout_lock) {
+		if (sys_dnode_is_linked(&to->node)) {
+			sys_dlist_remove(&to->node);
+			if (to->expiry == next_expiry) {
+				next_expiry_valid = false;
+			}
+#ifdef CONFIG_TIMEOUT_SLACK
+			if (to->expiry + to->slack == next_deadline) {
+				next_deadline_valid = false;
+			}
+#endif
+			ret = 0;
+		}
+	}
+
+	return ret;
+}
+
+s32_t z_timeout_remaining(struct _timeout *timeout)
+{
+	s32_t ticks = 0;
+
+	if (_is_inactive_timeout(timeout)) {
+		return 0;
+	}
+
+	LOCKED(&timeout_lock) {
+		ticks = timeout->expiry - curr_tick;
+	}
+
+	return ticks;
+}
+
+#else
 static struct _timeout *first(void)
 {
 	sys_dnode_t *t = sys_dlist_peek_head(&timeout_list);
@@ -58,18 +457,38 @@ static s32_t elapsed(void)
 	return announce_remaining == 0 ? z_clock_elapsed() : 0;
 }
 
+/* Ticks from curr_tick by which the timer must fire, i.e. to the
+ * earliest expiry plus slack of all pending timeouts, or INT_MAX if
+ * there are none.  The list is sorted by expiry, so the walk stops at
+ * the first timeout expiring after the best deadline found so far.
+ */
+static s32_t first_deadline(void)
+{
+	s64_t ticks = 0, ret = INT_MAX;
+
+	for (struct _timeout *t = first(); t != NULL; t = next(t)) {
+		ticks += t->dticks;
+		if (ticks >= ret) {
+			break;
+		}
+		ret = MIN(ret, ticks + timeout_slack(t));
+	}
+
+	return (s32_t)ret;
+}
+
 static s32_t next_timeout(void)
 {
 	int maxw = can_wait_forever ? K_FOREVER : INT_MAX;
 	struct _timeout *to = first();
-	s32_t ret = to == NULL ? maxw : MAX(0, to->dticks - elapsed());
+	s32_t ret = to == NULL ? maxw : MAX(0, first_deadline() - elapsed());
 
 #ifdef CONFIG_TIMESLICING
 	if (_current_cpu->slice_ticks && _current_cpu->slice_ticks < ret) {
 		ret = _current_cpu->slice_ticks;
 	}
 #endif
-	return ret;
+	return time_page_bound(ret);
 }
 
 void _add_timeout(struct _timeout *to, _timeout_func_t fn, s32_t ticks)
@@ -79,9 +498,12 @@ void _add_timeout(struct _timeout *to, _timeout_func_t fn, s32_t ticks)
 	ticks = MAX(1, ticks);
 
 	LOCKED(&timeout_lock) {
+		s32_t prev = first_deadline();
 		struct _timeout *t;
+		s64_t deadline;
 
 		to->dticks = ticks + elapsed();
+		deadline = (s64_t)to->dticks + timeout_slack(to);
 		for (t = first(); t != NULL; t = next(t)) {
 			__ASSERT(t->dticks >= 0, "");
 
@@ -97,7 +519,7 @@ void _add_timeout(struct _timeout *to, _timeout_func_t fn, s32_t ticks)
 			sys_dlist_append(&timeout_list, &to->node);
 		}
 
-		if (to == first()) {
+		if (to == first() || deadline < prev) {
 			z_clock_set_timeout(next_timeout(), false);
 		}
 	}
@@ -137,6 +559,8 @@ s32_t z_timeout_remaining(struct _timeout *timeout)
 	return ticks;
 }
 
+#endif /* CONFIG_TIMEOUT_QUEUE_WHEEL */
+
 s32_t _get_next_timeout_expiry(void)
 {
 	s32_t ret = K_FOREVER;
@@ -166,14 +590,60 @@ void z_set_timeout_expiry(s32_t ticks, bool idle)
 	}
 }
 
+#ifdef CONFIG_TIMEOUT_QUEUE_WHEEL
+void z_clock_announce(s32_t ticks)
+{
+	_stack_usage_sample_isr();
+
+#ifdef CONFIG_TIMESLICING
+	z_time_slice(ticks);
+#endif
+
+	k_spinlock_key_t key = k_spin_lock(&timeout_lock);
+	u64_t target = curr_tick + ticks;
+	u64_t next;
+
+	STATS_INC(announces);
+	announce_remaining = ticks;
+
+	while ((next = wheel_next_expiry()) <= target) {
+		struct _timeout *t;
+
+		wheel_advance(next);
+		announce_remaining = target - next;
+
+		while ((t = first_expired()) != NULL) {
+			sys_dlist_remove(&t->node);
+			STATS_INC(expired);
+
+			k_spin_unlock(&timeout_lock, key);
+			t->fn(t);
+			key = k_spin_lock(&timeout_lock);
+		}
+	}
+
+	wheel_advance(target);
+	announce_remaining = 0;
+
+#ifdef CONFIG_TIME_PAGE
+	time_page_update();
+#endif
+	z_clock_set_timeout(next_timeout(), false);
+
+	k_spin_unlock(&timeout_lock, key);
+}
+#else
 void z_clock_announce(s32_t ticks)
 {
+	_stack_usage_sample_isr();
+
 #ifdef CONFIG_TIMESLICING
 	z_time_slice(ticks);
 #endif
 
 	k_spinlock_key_t key = k_spin_lock(&timeout_lock);
 
+	STATS_INC(announces);
 	announce_remaining = ticks;
 
 	while (first() != NULL && first()->dticks <= announce_remaining) {
@@ -184,6 +654,7 @@ void z_clock_announce(s32_t ticks)
 		announce_remaining -= dt;
 		t->dticks = 0;
 		remove_timeout(t);
+		STATS_INC(expired);
 
 		k_spin_unlock(&timeout_lock, key);
 		t->fn(t);
@@ -197,10 +668,23 @@ void z_clock_announce(s32_t ticks)
 	curr_tick += announce_remaining;
 	announce_remaining = 0;
 
+#ifdef CONFIG_TIME_PAGE
+	time_page_update();
+#endif
 	z_clock_set_timeout(next_timeout(), false);
 
 	k_spin_unlock(&timeout_lock, key);
 }
+#endif /* CONFIG_TIMEOUT_QUEUE_WHEEL */
+
+#ifdef CONFIG_TIMEOUT_STATS
+void k_timeout_stats_get(struct k_timeout_stats *stats)
+{
+	LOCKED(&timeout_lock) {
+		*stats = timeout_stats;
+	}
+}
+#endif
 
 int k_enable_sys_clock_always_on(void)
 {
@@ -109,10 +109,12 @@ void k_timer_init(struct k_timer *timer,
 }
 
 
-void _impl_k_timer_start(struct k_timer *timer, s32_t duration, s32_t period)
+void _impl_k_timer_start_slack(struct k_timer *timer, s32_t duration,
+			       s32_t period, s32_t slack)
 {
 	__ASSERT(duration >= 0 && period >= 0 &&
 		 (duration != 0 || period != 0), "invalid parameters\n");
+	__ASSERT(slack >= 0, "invalid slack\n");
 
 	volatile s32_t period_in_ticks, duration_in_ticks;
 
@@ -122,10 +124,16 @@ void _impl_k_timer_start(struct k_timer *timer, s32_t duration, s32_t period)
 	(void)_abort_timeout(&timer->timeout);
 	timer->period = period_in_ticks;
 	timer->status = 0;
+	z_timeout_slack_set(&timer->timeout, _ms_to_ticks(slack));
 	_add_timeout(&timer->timeout, _timer_expiration_handler,
 		     duration_in_ticks);
 }
 
+void _impl_k_timer_start(struct k_timer *timer, s32_t duration, s32_t period)
+{
+	_impl_k_timer_start_slack(timer, duration, period, 0);
+}
+
 #ifdef CONFIG_USERSPACE
 Z_SYSCALL_HANDLER(k_timer_start, timer, duration_p, period_p)
 {
@@ -140,6 +148,23 @@ Z_SYSCALL_HANDLER(k_timer_start, timer, duration_p, period_p)
 	_impl_k_timer_start((struct k_timer *)timer, duration, period);
 	return 0;
 }
+
+Z_SYSCALL_HANDLER(k_timer_start_slack, timer, duration_p, period_p, slack_p)
+{
+	s32_t duration, period, slack;
+
+	duration = (s32_t)duration_p;
+	period = (s32_t)period_p;
+	slack = (s32_t)slack_p;
+
+	Z_OOPS(Z_SYSCALL_VERIFY(duration >= 0 && period >= 0 &&
+				(duration != 0 || period != 0)));
+	Z_OOPS(Z_SYSCALL_VERIFY(slack >= 0));
+	Z_OOPS(Z_SYSCALL_OBJ(timer, K_OBJ_TIMER));
+	_impl_k_timer_start_slack((struct k_timer *)timer, duration, period,
+				  slack);
+	return 0;
+}
 #endif
 
 void _impl_k_timer_stop(struct k_timer *timer)
@@ -8,7 +8,6 @@
 #include <kernel.h>
 #include <string.h>
 #include <misc/printk.h>
-#include <misc/rb.h>
 #include <kernel_structs.h>
 #include <sys_io.h>
 #include <ksched.h>
@@ -31,7 +30,7 @@ LOG_MODULE_DECLARE(kernel);
  * not.
  */
 #ifdef CONFIG_DYNAMIC_OBJECTS
-static struct k_spinlock lists_lock;       /* kobj rbtree/dlist */
+static struct k_spinlock lists_lock;       /* kobj hash table */
 static struct k_spinlock objfree_lock;     /* k_object_free */
 #endif
 static struct k_spinlock obj_lock;         /* kobj struct data */
@@ -86,8 +85,6 @@ struct perm_ctx {
 #ifdef CONFIG_DYNAMIC_OBJECTS
 struct dyn_obj {
 	struct _k_object kobj;
-	sys_dnode_t obj_list;
-	struct rbnode node; /* must be immediately before data member */
 	u8_t data[]; /* The object itself */
 };
 
@@ -95,26 +92,142 @@ extern struct _k_object *_k_object_gperf_find(void *obj);
 extern void _k_object_gperf_wordlist_foreach(_wordlist_cb_func_t func,
 					     void *context);
 
-static bool node_lessthan(struct rbnode *a, struct rbnode *b);
-
 /*
- * Red/black tree of allocated kernel objects, for reasonably fast lookups
- * based on object pointer values.
+ * Open addressing hash table of allocated kernel objects, keyed by object
+ * address, for constant time lookups and for iteration over all of them
+ * (and potentially deleting them during iteration).  Collisions are
+ * resolved by linear probing.  Removed entries are replaced by a
+ * tombstone so that iteration is not disturbed, the tombstones are
+ * dropped when the table is rebuilt.
  */
-static struct rbtree obj_rb_tree = {
-	.lessthan_fn = node_lessthan
-};
+#define OBJ_TABLE_MIN_SIZE	16
+#define OBJ_TABLE_TOMBSTONE	((struct dyn_obj *)-1)
 
-/*
- * Linked list of allocated kernel objects, for iteration over all allocated
- * objects (and potentially deleting them during iteration).
- */
-static sys_dlist_t obj_list = SYS_DLIST_STATIC_INIT(&obj_list);
+static struct dyn_obj **obj_table;
+static size_t obj_table_size;	/* Slots, always a power of 2 */
+static size_t obj_table_count;	/* Live entries */
+static size_t obj_table_used;	/* Live entries and tombstones */
+
+static inline size_t obj_hash(void *obj)
+{
+	/* Fibonacci hashing, objects are at least 4-byte aligned */
+	return (size_t)(((uintptr_t)obj >> 2) * 2654435761U) &
+		(obj_table_size - 1);
+}
+
+static inline bool obj_slot_live(struct dyn_obj *entry)
+{
+	return entry != NULL && entry != OBJ_TABLE_TOMBSTONE;
+}
+
+/* Must be called with lists_lock held */
+static struct dyn_obj **obj_table_slot(void *obj)
+{
+	size_t i;
+
+	if (obj_table_size == 0) {
+		return NULL;
+	}
+
+	for (i = obj_hash(obj); obj_table[i] != NULL;
+	     i = (i + 1) & (obj_table_size - 1)) {
+		if (obj_table[i] != OBJ_TABLE_TOMBSTONE &&
+		    obj_table[i]->data == obj) {
+			return &obj_table[i];
+		}
+	}
+
+	return NULL;
+}
+
+/* Must be called with lists_lock held, and with a free slot available */
+static void obj_table_insert(struct dyn_obj *dyn_obj)
+{
+	size_t i = obj_hash(dyn_obj->data);
+
+	while (obj_slot_live(obj_table[i])) {
+		i = (i + 1) & (obj_table_size - 1);
+	}
+
+	if (obj_table[i] == NULL) {
+		obj_table_used++;
+	}
+	obj_table[i] = dyn_obj;
+	obj_table_count++;
+}
+
+/* Must be called with lists_lock held */
+static void obj_table_remove(struct dyn_obj *dyn_obj)
+{
+	struct dyn_obj **slot = obj_table_slot(dyn_obj->data);
+
+	__ASSERT(slot != NULL, "object %p not in table", dyn_obj->data);
+	*slot = OBJ_TABLE_TOMBSTONE;
+	obj_table_count--;
+}
+
+static bool obj_table_full(void)
+{
+	/* Keep at least a quarter of the slots empty, so probes stay short
+	 * and always terminate
+	 */
+	return (obj_table_used + 1) * 4 > obj_table_size * 3;
+}
 
 /*
- * TODO: Write some hash table code that will replace both obj_rb_tree
- * and obj_list.
+ * Makes room for one more entry, rebuilding the table at twice the
+ * number of live entries if it is too full.  The new table is allocated
+ * without holding lists_lock, so the check is repeated once it is held
+ * again in case another CPU got there first.  Returns with lists_lock
+ * held on success.
  */
+static int obj_table_reserve(k_spinlock_key_t *key)
+{
+	struct dyn_obj **table, **old;
+	size_t size, old_size;
+
+	*key = k_spin_lock(&lists_lock);
+
+	while (obj_table_full()) {
+		size = OBJ_TABLE_MIN_SIZE;
+		while (size < (obj_table_count + 1) * 2) {
+			size *= 2;
+		}
+		k_spin_unlock(&lists_lock, *key);
+
+		table = k_calloc(size, sizeof(*table));
+		if (table == NULL) {
+			return -ENOMEM;
+		}
+
+		*key = k_spin_lock(&lists_lock);
+		if (!obj_table_full() || (obj_table_count + 1) * 2 > size) {
+			/* Raced with another resize */
+			k_spin_unlock(&lists_lock, *key);
+			k_free(table);
+			*key = k_spin_lock(&lists_lock);
+			continue;
+		}
+
+		old = obj_table;
+		old_size = obj_table_size;
+		obj_table = table;
+		obj_table_size = size;
+		obj_table_count = 0;
+		obj_table_used = 0;
+		for (size_t i = 0; i < old_size; i++) {
+			if (obj_slot_live(old[i])) {
+				obj_table_insert(old[i]);
+			}
+		}
+		k_spin_unlock(&lists_lock, *key);
+
+		k_free(old);
+		*key = k_spin_lock(&lists_lock);
+	}
+
+	return 0;
+}
 
 static size_t obj_size_get(enum k_objects otype)
 {
@@ -130,34 +243,16 @@ static size_t obj_size_get(enum k_objects otype)
 	return ret;
 }
 
-static bool node_lessthan(struct rbnode *a, struct rbnode *b)
-{
-	return a < b;
-}
-
-static inline struct dyn_obj *node_to_dyn_obj(struct rbnode *node)
-{
-	return CONTAINER_OF(node, struct dyn_obj, node);
-}
-
 static struct dyn_obj *dyn_object_find(void *obj)
 {
-	struct rbnode *node;
+	struct dyn_obj **slot;
 	struct dyn_obj *ret;
 
-	/* For any dynamically allocated kernel object, the object
-	 * pointer is just a member of the conatining struct dyn_obj,
-	 * so just a little arithmetic is necessary to locate the
-	 * corresponding struct rbnode
-	 */
-	node = (struct rbnode *)((char *)obj - sizeof(struct rbnode));
-
 	k_spinlock_key_t key = k_spin_lock(&lists_lock);
-	if (rb_contains(&obj_rb_tree, node)) {
-		ret = node_to_dyn_obj(node);
-	} else {
-		ret = NULL;
-	}
+
+	slot = obj_table_slot(obj);
+	ret = slot != NULL ? *slot : NULL;
+
 	k_spin_unlock(&lists_lock, key);
 
 	return ret;
@@ -264,10 +359,18 @@ void *_impl_k_object_alloc(enum k_objects otype)
 	 */
 	_thread_perms_set(&dyn_obj->kobj, _current);
 
-	k_spinlock_key_t key = k_spin_lock(&lists_lock);
+	k_spinlock_key_t key;
 
-	rb_insert(&obj_rb_tree, &dyn_obj->node);
-	sys_dlist_append(&obj_list, &dyn_obj->obj_list);
+	if (obj_table_reserve(&key) != 0) {
+		LOG_WRN("could not grow kernel object table");
+		if (otype == K_OBJ_THREAD) {
+			_thread_idx_free(dyn_obj->kobj.data);
+		}
+		k_free(dyn_obj);
+		return NULL;
+	}
+
+	obj_table_insert(dyn_obj);
 	k_spin_unlock(&lists_lock, key);
 
 	return dyn_obj->kobj.name;
@@ -286,8 +389,10 @@ void k_object_free(void *obj)
 
 	dyn_obj = dyn_object_find(obj);
 	if (dyn_obj != NULL) {
-		rb_remove(&obj_rb_tree, &dyn_obj->node);
-		sys_dlist_remove(&dyn_obj->obj_list);
+		k_spinlock_key_t lists_key = k_spin_lock(&lists_lock);
+
+		obj_table_remove(dyn_obj);
+		k_spin_unlock(&lists_lock, lists_key);
 
 		if (dyn_obj->kobj.type == K_OBJ_THREAD) {
 			_thread_idx_free(dyn_obj->kobj.data);
@@ -320,14 +425,17 @@ struct _k_object *_k_object_find(void *obj)
 
 void _k_object_wordlist_foreach(_wordlist_cb_func_t func, void *context)
 {
-	struct dyn_obj *obj, *next;
-
 	_k_object_gperf_wordlist_foreach(func, context);
 
 	k_spinlock_key_t key = k_spin_lock(&lists_lock);
 
-	SYS_DLIST_FOR_EACH_CONTAINER_SAFE(&obj_list, obj, next, obj_list) {
-		func(&obj->kobj, context);
+	/* The callback may remove the current entry, which only leaves a
+	 * tombstone in its slot
+	 */
+	for (size_t i = 0; i < obj_table_size; i++) {
+		if (obj_slot_live(obj_table[i])) {
+			func(&obj_table[i]->kobj, context);
+		}
 	}
 	k_spin_unlock(&lists_lock, key);
 }
@@ -346,8 +454,21 @@ static int thread_index_get(struct k_thread *t)
 	return ko->data;
 }
 
-static void unref_check(struct _k_object *ko, int index)
+/*
+ * Drops the reference thread index holds on ko, freeing a dynamic object
+ * when it was the last one.  Removing the object modifies the hash table,
+ * so lists_lock is taken first unless the caller, walking the table,
+ * already holds it.
+ */
+static void unref_check(struct _k_object *ko, int index, bool lists_locked)
 {
+#ifdef CONFIG_DYNAMIC_OBJECTS
+	k_spinlock_key_t lists_key = { 0 };
+
+	if (!lists_locked) {
+		lists_key = k_spin_lock(&lists_lock);
+	}
+#endif
 	k_spinlock_key_t key = k_spin_lock(&obj_lock);
 
 	sys_bitfield_clear_bit((mem_addr_t)&ko->perms, index);
@@ -386,12 +507,17 @@ static void unref_check(struct _k_object *ko, int index)
 		break;
 	}
 
-	rb_remove(&obj_rb_tree, &dyn_obj->node);
-	sys_dlist_remove(&dyn_obj->obj_list);
+	obj_table_remove(dyn_obj);
 	k_free(dyn_obj);
 out:
-#endif
 	k_spin_unlock(&obj_lock, key);
+	if (!lists_locked) {
+		k_spin_unlock(&lists_lock, lists_key);
+	}
+#else
+	ARG_UNUSED(lists_locked);
+	k_spin_unlock(&obj_lock, key);
+#endif
 }
 
 static void wordlist_cb(struct _k_object *ko, void *ctx_ptr)
@@ -432,7 +558,7 @@ void _thread_perms_clear(struct _k_object *ko, struct k_thread *thread)
 
 	if (index != -1) {
 		sys_bitfield_clear_bit((mem_addr_t)&ko->perms, index);
-		unref_check(ko, index);
+		unref_check(ko, index, false);
 	}
 }
 
@@ -440,7 +566,10 @@ static void clear_perms_cb(struct _k_object *ko, void *ctx_ptr)
 {
 	int id = (int)ctx_ptr;
 
-	unref_check(ko, id);
+	/* Called from _k_object_wordlist_foreach(), which holds lists_lock
+	 * while it visits dynamic objects
+	 */
+	unref_check(ko, id, true);
 }
 
 void _thread_perms_all_clear(struct k_thread *thread)
@@ -16,19 +16,227 @@
 #include <spinlock.h>
 #include <errno.h>
 #include <stdbool.h>
+#include <string.h>
 
 #define WORKQUEUE_THREAD_NAME	"workqueue"
 
-extern void z_work_q_main(void *work_q_ptr, void *p2, void *p3);
+#ifdef CONFIG_WORK_QUEUE_STATS
+void z_work_q_stats_submit(struct k_work_q *work_q, struct k_work *work)
+{
+	struct k_work_q_stats *stats = &work_q->stats;
+	atomic_val_t depth;
+	atomic_val_t max;
 
-void k_work_q_start(struct k_work_q *work_q, k_thread_stack_t *stack,
-		    size_t stack_size, int prio)
+	/* Items of user mode workqueues are never taken off the count */
+	if (work_q->num_workers == 0) {
+		return;
+	}
+
+	atomic_set_bit(work->flags, K_WORK_STATE_COUNTED);
+	depth = atomic_inc(&stats->depth) + 1;
+
+	do {
+		max = atomic_get(&stats->max_depth);
+	} while (depth > max && !atomic_cas(&stats->max_depth, max, depth));
+
+	work->submit_time = k_cycle_get_32();
+}
+
+static void work_q_stats_update(struct k_work_q *work_q, struct k_work *work,
+				u32_t start, u32_t end)
+{
+	struct k_work_q_stats *stats = &work_q->stats;
+	u32_t latency = start - work->submit_time;
+	u32_t runtime = end - start;
+	k_spinlock_key_t key = k_spin_lock(&work_q->lock);
+
+	stats->processed++;
+	stats->latency_total += latency;
+	stats->latency_max = MAX(stats->latency_max, latency);
+	stats->runtime_total += runtime;
+	stats->runtime_max = MAX(stats->runtime_max, runtime);
+
+	k_spin_unlock(&work_q->lock, key);
+}
+
+void k_work_q_stats_get(struct k_work_q *work_q, struct k_work_q_stats *stats)
+{
+	k_spinlock_key_t key = k_spin_lock(&work_q->lock);
+
+	*stats = work_q->stats;
+
+	k_spin_unlock(&work_q->lock, key);
+}
+
+void k_work_q_stats_reset(struct k_work_q *work_q)
+{
+	k_spinlock_key_t key = k_spin_lock(&work_q->lock);
+
+	atomic_set(&work_q->stats.max_depth,
+		   atomic_get(&work_q->stats.depth));
+	work_q->stats.processed = 0;
+	work_q->stats.latency_max = 0;
+	work_q->stats.latency_total = 0;
+	work_q->stats.runtime_max = 0;
+	work_q->stats.runtime_total = 0;
+
+	k_spin_unlock(&work_q->lock, key);
+}
+#endif /* CONFIG_WORK_QUEUE_STATS */
+
+/* Take ownership of a work item taken off the queue, so that it never
+ * runs in two workers at once.  Returns false if it must not be run,
+ * either because it was canceled or because another worker is running
+ * it, in which case that worker is told to run it again.  counted tells
+ * whether the submission was counted in the statistics.
+ */
+static bool work_claim(struct k_work_q *work_q, struct k_work *work,
+		       bool counted)
+{
+	k_spinlock_key_t key;
+	bool claimed = false;
+
+	/* Reset pending state so it can be resubmitted by handler */
+	if (work_q->num_workers == 1) {
+		return atomic_test_and_clear_bit(work->flags,
+						 K_WORK_STATE_PENDING);
+	}
+
+	key = k_spin_lock(&work_q->lock);
+	if (atomic_test_and_clear_bit(work->flags, K_WORK_STATE_PENDING)) {
+		if (atomic_test_and_set_bit(work->flags,
+					    K_WORK_STATE_RUNNING)) {
+			atomic_set_bit(work->flags, K_WORK_STATE_RERUN);
+			if (counted) {
+				atomic_set_bit(work->flags,
+					       K_WORK_STATE_RERUN_COUNTED);
+			}
+		} else {
+			claimed = true;
+		}
+	}
+	k_spin_unlock(&work_q->lock, key);
+
+	return claimed;
+}
+
+/* Returns true if the work item was resubmitted while running and must
+ * be run again by the same worker, and then sets counted for that run.
+ */
+static bool work_release(struct k_work_q *work_q, struct k_work *work,
+			 bool *counted)
 {
+	k_spinlock_key_t key;
+	bool rerun;
+
+	if (work_q->num_workers == 1) {
+		return false;
+	}
+
+	key = k_spin_lock(&work_q->lock);
+	rerun = atomic_test_and_clear_bit(work->flags, K_WORK_STATE_RERUN);
+	*counted = atomic_test_and_clear_bit(work->flags,
+					     K_WORK_STATE_RERUN_COUNTED);
+	if (!rerun) {
+		atomic_clear_bit(work->flags, K_WORK_STATE_RUNNING);
+	}
+	k_spin_unlock(&work_q->lock, key);
+
+	return rerun;
+}
+
+static void work_q_pool_main(void *work_q_ptr, void *p2, void *p3)
+{
+	struct k_work_q *work_q = work_q_ptr;
+
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	while (true) {
+		struct k_work *work;
+		k_work_handler_t handler;
+		bool counted = false;
+
+		work = k_queue_get(&work_q->queue, K_FOREVER);
+		if (work == NULL) {
+			continue;
+		}
+
+#ifdef CONFIG_WORK_QUEUE_STATS
+		counted = atomic_test_and_clear_bit(work->flags,
+						    K_WORK_STATE_COUNTED);
+		if (counted) {
+			atomic_dec(&work_q->stats.depth);
+		}
+#endif
+
+		handler = work->handler;
+
+		if (work_claim(work_q, work, counted)) {
+			do {
+#ifdef CONFIG_WORK_QUEUE_STATS
+				u32_t start = k_cycle_get_32();
+
+				handler(work);
+				if (counted) {
+					work_q_stats_update(work_q, work, start,
+							    k_cycle_get_32());
+				}
+#else
+				handler(work);
+#endif
+			} while (work_release(work_q, work, &counted));
+		}
+
+		/* Make sure we don't hog up the CPU if the FIFO never (or
+		 * very rarely) gets empty.
+		 */
+		k_yield();
+	}
+}
+
+void k_work_q_pool_start(struct k_work_q *work_q, struct k_thread *threads,
+			 k_thread_stack_t *stacks, int num_threads,
+			 size_t stack_size, int prio, u32_t options)
+{
+	size_t stride = K_THREAD_STACK_LEN(stack_size);
+
+	__ASSERT(num_threads > 0, "");
+
 	k_queue_init(&work_q->queue);
-	(void)k_thread_create(&work_q->thread, stack, stack_size, z_work_q_main,
-			work_q, NULL, NULL, prio, 0, 0);
+	work_q->num_workers = num_threads;
+#ifdef CONFIG_WORK_QUEUE_STATS
+	(void)memset(&work_q->stats, 0, sizeof(work_q->stats));
+#endif
+
+	for (int i = 0; i < num_threads; i++) {
+		k_thread_stack_t *stack = (k_thread_stack_t *)
+			((char *)stacks + i * stride);
+
+		(void)k_thread_create(&threads[i], stack, stack_size,
+				      work_q_pool_main, work_q, NULL, NULL,
+				      prio, 0, K_FOREVER);
+		k_thread_name_set(&threads[i], WORKQUEUE_THREAD_NAME);
+
+#ifdef CONFIG_SCHED_CPU_MASK
+		if ((options & K_WORK_Q_POOL_PIN) != 0) {
+			(void)k_thread_cpu_mask_clear(&threads[i]);
+			(void)k_thread_cpu_mask_enable(&threads[i],
+						       i % CONFIG_MP_NUM_CPUS);
+		}
+#else
+		ARG_UNUSED(options);
+#endif
+
+		k_thread_start(&threads[i]);
+	}
+}
 
-	k_thread_name_set(&work_q->thread, WORKQUEUE_THREAD_NAME);
+void k_work_q_start(struct k_work_q *work_q, k_thread_stack_t *stack,
+		    size_t stack_size, int prio)
+{
+	k_work_q_pool_start(work_q, &work_q->thread, stack, 1, stack_size,
+			    prio, 0);
 }
 
 #ifdef CONFIG_SYS_CLOCK_EXISTS
@@ -57,10 +265,20 @@ static int work_cancel(struct k_delayed_work *work)
 		if (!k_queue_remove(&work->work_q->queue, &work->work)) {
 			return -EINVAL;
 		}
+#ifdef CONFIG_WORK_QUEUE_STATS
+		if (atomic_test_and_clear_bit(work->work.flags,
+					      K_WORK_STATE_COUNTED)) {
+			atomic_dec(&work->work_q->stats.depth);
+		}
+#endif
 	} else {
 		(void)_abort_timeout(&work->timeout);
 	}
 
+	/* A pool worker still running the handler must not run it again */
+	atomic_clear_bit(work->work.flags, K_WORK_STATE_RERUN);
+	atomic_clear_bit(work->work.flags, K_WORK_STATE_RERUN_COUNTED);
+
 	/* Detach from workqueue */
 	work->work_q = NULL;
 
@@ -72,6 +290,13 @@ static int work_cancel(struct k_delayed_work *work)
 int k_delayed_work_submit_to_queue(struct k_work_q *work_q,
 				   struct k_delayed_work *work,
 				   s32_t delay)
+{
+	return k_delayed_work_submit_to_queue_slack(work_q, work, delay, 0);
+}
+
+int k_delayed_work_submit_to_queue_slack(struct k_work_q *work_q,
+					 struct k_delayed_work *work,
+					 s32_t delay, s32_t slack)
 {
 	k_spinlock_key_t key = k_spin_lock(&work_q->lock);
 	int err = 0;
@@ -103,6 +328,7 @@ int k_delayed_work_submit_to_queue(struct k_work_q *work_q,
 	}
 
 	/* Add timeout */
+	z_timeout_slack_set(&work->timeout, _ms_to_ticks(slack));
 	_add_timeout(&work->timeout, work_timeout,
 		     _TICK_ALIGN + _ms_to_ticks(delay));
 
@@ -9,6 +9,7 @@
 #include <init.h>
 #include <errno.h>
 #include <misc/mempool.h>
+#include <misc/tlsf.h>
 #include <string.h>
 #include <app_memory/app_memdomain.h>
 
@@ -28,6 +29,92 @@ K_APPMEM_PARTITION_DEFINE(z_malloc_partition);
 #endif /* CONFIG_APP_SHARED_MEM */
 
 K_MUTEX_DEFINE(malloc_mutex);
+#endif
+
+#if (CONFIG_MINIMAL_LIBC_MALLOC_ARENA_SIZE > 0) && \
+	defined(CONFIG_MINIMAL_LIBC_MALLOC_TLSF)
+static char __aligned(sizeof(void *)) _GENERIC_SECTION(POOL_SECTION)
+	z_malloc_heap_buf[CONFIG_MINIMAL_LIBC_MALLOC_ARENA_SIZE];
+_GENERIC_SECTION(POOL_SECTION) static struct sys_tlsf z_malloc_heap;
+
+void *malloc(size_t size)
+{
+	void *ret;
+
+	if (size == 0) {
+		return NULL;
+	}
+
+	k_mutex_lock(&malloc_mutex, K_FOREVER);
+	ret = sys_tlsf_alloc(&z_malloc_heap, size);
+	k_mutex_unlock(&malloc_mutex);
+
+	if (ret == NULL) {
+		errno = ENOMEM;
+	}
+
+	return ret;
+}
+
+void free(void *ptr)
+{
+	if (ptr == NULL) {
+		return;
+	}
+
+	k_mutex_lock(&malloc_mutex, K_FOREVER);
+	sys_tlsf_free(&z_malloc_heap, ptr);
+	k_mutex_unlock(&malloc_mutex);
+}
+
+void *realloc(void *ptr, size_t requested_size)
+{
+	size_t block_size;
+	void *new_ptr;
+
+	if (requested_size == 0) {
+		return NULL;
+	}
+
+	if (ptr == NULL) {
+		return malloc(requested_size);
+	}
+
+	/* Blocks are only rounded up to pointer alignment, so growing
+	 * in place past the usable size is not worth the bookkeeping
+	 */
+	block_size = sys_tlsf_usable_size(ptr);
+	if (block_size >= requested_size) {
+		return ptr;
+	}
+
+	new_ptr = malloc(requested_size);
+	if (new_ptr == NULL) {
+		return NULL;
+	}
+
+	memcpy(new_ptr, ptr, block_size);
+	free(ptr);
+
+	return new_ptr;
+}
+
+static int malloc_prepare(struct device *unused)
+{
+	ARG_UNUSED(unused);
+
+#ifdef CONFIG_USERSPACE
+	k_object_access_all_grant(&malloc_mutex);
+#endif
+	sys_tlsf_init(&z_malloc_heap, z_malloc_heap_buf,
+		      sizeof(z_malloc_heap_buf));
+
+	return 0;
+}
+
+SYS_INIT(malloc_prepare, APPLICATION, CONFIG_KERNEL_INIT_PRIORITY_DEFAULT);
+#else /* sys_mem_pool backend */
+#if (CONFIG_MINIMAL_LIBC_MALLOC_ARENA_SIZE > 0)
 SYS_MEM_POOL_DEFINE(z_malloc_mem_pool, &malloc_mutex, 16,
 		    CONFIG_MINIMAL_LIBC_MALLOC_ARENA_SIZE, 1, 4, POOL_SECTION);
 
@@ -73,36 +160,6 @@ void free(void *ptr)
 	sys_mem_pool_free(ptr);
 }
 
-static bool size_t_mul_overflow(size_t a, size_t b, size_t *res)
-{
-#if __SIZEOF_SIZE_T__ == 4
-	return __builtin_umul_overflow((unsigned int)a, (unsigned int)b,
-				       (unsigned int *)res);
-#else /* __SIZEOF_SIZE_T__ == 8 */
-	return __builtin_umulll_overflow((unsigned long long)a,
-					 (unsigned long long)b,
-					 (unsigned long long *)res);
-#endif
-}
-
-void *calloc(size_t nmemb, size_t size)
-{
-	void *ret;
-
-	if (size_t_mul_overflow(nmemb, size, &size)) {
-		errno = ENOMEM;
-		return NULL;
-	}
-
-	ret = malloc(size);
-
-	if (ret != NULL) {
-		(void)memset(ret, 0, size);
-	}
-
-	return ret;
-}
-
 void *realloc(void *ptr, size_t requested_size)
 {
 	struct sys_mem_pool_block *blk;
@@ -143,7 +200,37 @@ void *realloc(void *ptr, size_t requested_size)
 
 	return new_ptr;
 }
+#endif /* CONFIG_MINIMAL_LIBC_MALLOC_TLSF */
+
+static bool size_t_mul_overflow(size_t a, size_t b, size_t *res)
+{
+#if __SIZEOF_SIZE_T__ == 4
+	return __builtin_umul_overflow((unsigned int)a, (unsigned int)b,
+				       (unsigned int *)res);
+#else /* __SIZEOF_SIZE_T__ == 8 */
+	return __builtin_umulll_overflow((unsigned long long)a,
+					 (unsigned long long)b,
+					 (unsigned long long *)res);
+#endif
+}
+
+void *calloc(size_t nmemb, size_t size)
+{
+	void *ret;
+
+	if (size_t_mul_overflow(nmemb, size, &size)) {
+		errno = ENOMEM;
+		return NULL;
+	}
 
+	ret = malloc(size);
+
+	if (ret != NULL) {
+		(void)memset(ret, 0, size);
+	}
+
+	return ret;
+}
 
 void *reallocarray(void *ptr, size_t nmemb, size_t size)
 {
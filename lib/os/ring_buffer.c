@@ -213,3 +213,277 @@ u32_t ring_buf_get(struct ring_buf *buf, u8_t *data, u32_t size)
 
 	return total_size;
 }
+
+/*
+ * Multi-producer ring buffer.
+ *
+ * Producers claim space by moving 'reserved' forward with a CAS, and
+ * publish it by moving 'tail' over it, in reservation order.  A producer
+ * whose claim starts at the tail publishes it directly.  Otherwise it
+ * records its finished claim in a free 'done' slot, and whichever
+ * producer moves the tail up to that claim publishes it as well.  No
+ * producer ever waits for another one, so ISRs may interrupt a thread in
+ * the middle of a claim; the consumer simply does not see that thread's
+ * data, nor anything claimed after it, until the claim is finished.
+ *
+ * Publishing checks the tail after recording a claim, and the recorded
+ * claims after moving the tail, so one of two producers finishing
+ * next to each other always sees the other one.  Claims are limited to
+ * RING_BUF_MP_CLAIMS in flight, so a finishing producer always finds a
+ * free slot.
+ *
+ * Positions are free running and only masked when indexing the buffer.
+ */
+
+enum {
+	MP_CLAIM_FREE,
+	MP_CLAIM_BUSY,	/* Being recorded */
+	MP_CLAIM_DONE,
+};
+
+static bool mp_claim_begin(struct ring_buf_mp *buf)
+{
+	if ((u32_t)atomic_inc(&buf->claims) >= RING_BUF_MP_CLAIMS) {
+		atomic_dec(&buf->claims);
+		return false;
+	}
+
+	return true;
+}
+
+/* Publish recorded claims as long as one starts at the tail */
+static void mp_publish(struct ring_buf_mp *buf)
+{
+	struct ring_buf_mp_claim *claim;
+	u32_t tail;
+	int i;
+
+	do {
+		tail = atomic_get(&buf->tail);
+
+		for (i = 0; i < RING_BUF_MP_CLAIMS; i++) {
+			claim = &buf->done[i];
+
+			/* A slot only goes back to FREE after the tail moved
+			 * past its claim, so if the CAS succeeds, 'end'
+			 * belongs to the claim starting at 'tail'.
+			 */
+			if ((u32_t)atomic_get(&claim->start) == tail &&
+			    atomic_get(&claim->state) == MP_CLAIM_DONE) {
+				break;
+			}
+		}
+
+		if (i == RING_BUF_MP_CLAIMS) {
+			return;
+		}
+
+		if (atomic_cas(&buf->tail, tail, atomic_get(&claim->end))) {
+			atomic_set(&claim->state, MP_CLAIM_FREE);
+			atomic_dec(&buf->claims);
+		}
+	} while (true);
+}
+
+static void mp_commit(struct ring_buf_mp *buf, u32_t start, u32_t end)
+{
+	struct ring_buf_mp_claim *claim;
+	int i = 0;
+
+	if (atomic_cas(&buf->tail, start, end)) {
+		atomic_dec(&buf->claims);
+	} else {
+		/* A slot is always free, but other producers may be
+		 * taking and freeing slots meanwhile
+		 */
+		while (!atomic_cas(&buf->done[i].state, MP_CLAIM_FREE,
+				   MP_CLAIM_BUSY)) {
+			i = (i + 1) % RING_BUF_MP_CLAIMS;
+		}
+
+		claim = &buf->done[i];
+		atomic_set(&claim->start, start);
+		atomic_set(&claim->end, end);
+		atomic_set(&claim->state, MP_CLAIM_DONE);
+	}
+
+	mp_publish(buf);
+}
+
+int ring_buf_mp_item_put(struct ring_buf_mp *buf, u16_t type, u8_t value,
+			 u32_t *data, u8_t size32)
+{
+	struct ring_element *header;
+	u32_t start, i;
+
+	if (!mp_claim_begin(buf)) {
+		atomic_inc(&buf->dropped_put_count);
+		return -EMSGSIZE;
+	}
+
+	do {
+		start = atomic_get(&buf->reserved);
+		if (buf->size - (start - (u32_t)atomic_get(&buf->head)) <
+		    size32 + 1) {
+			atomic_dec(&buf->claims);
+			atomic_inc(&buf->dropped_put_count);
+			return -EMSGSIZE;
+		}
+	} while (!atomic_cas(&buf->reserved, start, start + size32 + 1));
+
+	header = (struct ring_element *)&buf->buf.buf32[start & buf->mask];
+	header->type = type;
+	header->length = size32;
+	header->value = value;
+
+	for (i = 0U; i < size32; ++i) {
+		buf->buf.buf32[(start + i + 1) & buf->mask] = data[i];
+	}
+
+	mp_commit(buf, start, start + size32 + 1);
+
+	return 0;
+}
+
+int ring_buf_mp_item_get(struct ring_buf_mp *buf, u16_t *type, u8_t *value,
+			 u32_t *data, u8_t *size32)
+{
+	struct ring_element *header;
+	u32_t head = atomic_get(&buf->head);
+	u32_t i;
+
+	if (head == (u32_t)atomic_get(&buf->tail)) {
+		return -EAGAIN;
+	}
+
+	header = (struct ring_element *)&buf->buf.buf32[head & buf->mask];
+
+	if (header->length > *size32) {
+		*size32 = header->length;
+		return -EMSGSIZE;
+	}
+
+	*size32 = header->length;
+	*type = header->type;
+	*value = header->value;
+
+	for (i = 0U; i < header->length; ++i) {
+		data[i] = buf->buf.buf32[(head + i + 1) & buf->mask];
+	}
+
+	head += header->length + 1;
+	buf->tmp_head = head;
+	atomic_set(&buf->head, head);
+
+	return 0;
+}
+
+u32_t ring_buf_mp_put_claim(struct ring_buf_mp *buf, u8_t **data, u32_t size)
+{
+	u32_t start, space, allocated;
+
+	if (!mp_claim_begin(buf)) {
+		return 0;
+	}
+
+	do {
+		start = atomic_get(&buf->reserved);
+		space = buf->size - (start - (u32_t)atomic_get(&buf->head));
+
+		/* Limit allocated size to available and trail size. */
+		allocated = MIN(size, MIN(space,
+					  buf->size - (start & buf->mask)));
+		if (allocated == 0) {
+			atomic_dec(&buf->claims);
+			break;
+		}
+	} while (!atomic_cas(&buf->reserved, start, start + allocated));
+
+	*data = &buf->buf.buf8[start & buf->mask];
+
+	return allocated;
+}
+
+void ring_buf_mp_put_finish(struct ring_buf_mp *buf, u8_t *data, u32_t size)
+{
+	u32_t tail = atomic_get(&buf->tail);
+	u32_t start;
+
+	/* An unpublished claim starts less than a buffer size past the
+	 * tail, which gives back its free running position
+	 */
+	start = tail + (((u32_t)(data - buf->buf.buf8) - tail) & buf->mask);
+
+	mp_commit(buf, start, start + size);
+}
+
+u32_t ring_buf_mp_put(struct ring_buf_mp *buf, const u8_t *data, u32_t size)
+{
+	u8_t *dst;
+	u32_t partial_size;
+	u32_t total_size = 0U;
+
+	do {
+		partial_size = ring_buf_mp_put_claim(buf, &dst, size);
+		if (partial_size == 0) {
+			break;
+		}
+
+		memcpy(dst, data, partial_size);
+		ring_buf_mp_put_finish(buf, dst, partial_size);
+		total_size += partial_size;
+		size -= partial_size;
+		data += partial_size;
+	} while (size);
+
+	return total_size;
+}
+
+u32_t ring_buf_mp_get_claim(struct ring_buf_mp *buf, u8_t **data, u32_t size)
+{
+	u32_t space, granted_size;
+
+	space = (u32_t)atomic_get(&buf->tail) - buf->tmp_head;
+
+	/* Limit granted size to available and trail size. */
+	granted_size = MIN(size, MIN(space,
+				     buf->size - (buf->tmp_head & buf->mask)));
+
+	*data = &buf->buf.buf8[buf->tmp_head & buf->mask];
+	buf->tmp_head += granted_size;
+
+	return granted_size;
+}
+
+int ring_buf_mp_get_finish(struct ring_buf_mp *buf, u32_t size)
+{
+	u32_t head = atomic_get(&buf->head);
+
+	if (size > (u32_t)atomic_get(&buf->tail) - head) {
+		return -EINVAL;
+	}
+
+	buf->tmp_head = head + size;
+	atomic_set(&buf->head, head + size);
+
+	return 0;
+}
+
+u32_t ring_buf_mp_get(struct ring_buf_mp *buf, u8_t *data, u32_t size)
+{
+	u8_t *src;
+	u32_t partial_size;
+	u32_t total_size = 0U;
+
+	do {
+		partial_size = ring_buf_mp_get_claim(buf, &src, size);
+		memcpy(data, src, partial_size);
+		total_size += partial_size;
+		size -= partial_size;
+		data += partial_size;
+	} while (size && partial_size);
+
+	ring_buf_mp_get_finish(buf, total_size);
+
+	return total_size;
+}
@@ -0,0 +1,404 @@
+/*
+ * Copyright (c) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <kernel.h>
+#include <string.h>
+#include <misc/__assert.h>
+#include <misc/tlsf.h>
+
+/*
+ * Block layout.  A block header sits immediately before the memory
+ * handed out to the user.  Only the size word is live while a block
+ * is allocated: prev_phys overlaps the tail of the previous block and
+ * is only valid (and only written) while that previous block is free,
+ * and the free list links overlap the user data.
+ *
+ * Sizes are payload sizes, always a multiple of the pointer size,
+ * which leaves the bottom bits of the size word for flags.  The heap
+ * ends with a zero sized, permanently allocated sentinel block so
+ * that the last real block always has a physical successor.
+ */
+struct sys_tlsf_block {
+	struct sys_tlsf_block *prev_phys;
+	size_t size;
+	struct sys_tlsf_block *next_free;
+	struct sys_tlsf_block *prev_free;
+};
+
+#define BLOCK_FREE	((size_t)BIT(0))
+#define BLOCK_PREV_FREE	((size_t)BIT(1))
+#define BLOCK_FLAGS	(BLOCK_FREE | BLOCK_PREV_FREE)
+
+#define BLOCK_OVERHEAD	sizeof(size_t)
+#define PAYLOAD_OFFSET	offsetof(struct sys_tlsf_block, next_free)
+#define BLOCK_MIN	(sizeof(struct sys_tlsf_block) - BLOCK_OVERHEAD)
+
+#define ALIGN		sizeof(void *)
+#define ALIGN_LOG2	(sizeof(void *) == 8 ? 3 : 2)
+
+/* Second level lists per power of two.  Below SMALL_BLOCK the first
+ * level collapses to a single list per ALIGN-sized size class.
+ */
+#define SL_BITS		CONFIG_SYS_TLSF_SL_BITS
+#define SL_COUNT	(1U << SL_BITS)
+#define FL_SHIFT	(SL_BITS + ALIGN_LOG2)
+#define SMALL_BLOCK	((size_t)1 << FL_SHIFT)
+
+BUILD_ASSERT(sizeof(size_t) == sizeof(void *));
+
+static inline int msb(size_t x)
+{
+	return (int)(8 * sizeof(unsigned long)) - 1 -
+		__builtin_clzl((unsigned long)x);
+}
+
+static inline size_t block_size(struct sys_tlsf_block *b)
+{
+	return b->size & ~BLOCK_FLAGS;
+}
+
+static inline void *block_payload(struct sys_tlsf_block *b)
+{
+	return (u8_t *)b + PAYLOAD_OFFSET;
+}
+
+static inline struct sys_tlsf_block *payload_block(void *mem)
+{
+	return (struct sys_tlsf_block *)((u8_t *)mem - PAYLOAD_OFFSET);
+}
+
+static inline struct sys_tlsf_block *next_phys(struct sys_tlsf_block *b)
+{
+	return (struct sys_tlsf_block *)((u8_t *)block_payload(b)
+					 + block_size(b) - BLOCK_OVERHEAD);
+}
+
+static void mapping(size_t size, int *fl, int *sl)
+{
+	if (size < SMALL_BLOCK) {
+		*fl = 0;
+		*sl = size >> ALIGN_LOG2;
+	} else {
+		int m = msb(size);
+
+		*sl = (size >> (m - SL_BITS)) ^ SL_COUNT;
+		*fl = m - FL_SHIFT + 1;
+	}
+}
+
+/* Like mapping(), but rounds up to the next size class so that any
+ * block found in the resulting list is large enough.
+ */
+static void mapping_search(size_t size, int *fl, int *sl)
+{
+	if (size >= SMALL_BLOCK) {
+		size += ((size_t)1 << (msb(size) - SL_BITS)) - 1;
+	}
+
+	mapping(size, fl, sl);
+}
+
+static inline struct sys_tlsf_block **list_head(struct sys_tlsf *h,
+						int fl, int sl)
+{
+	return &h->free_lists[fl * SL_COUNT + sl];
+}
+
+static void insert_free(struct sys_tlsf *h, struct sys_tlsf_block *b)
+{
+	struct sys_tlsf_block **head;
+	int fl, sl;
+
+	mapping(block_size(b), &fl, &sl);
+	head = list_head(h, fl, sl);
+
+	b->prev_free = NULL;
+	b->next_free = *head;
+	if (*head != NULL) {
+		(*head)->prev_free = b;
+	}
+	*head = b;
+
+	h->fl_bitmap |= BIT(fl);
+	h->sl_bitmap[fl] |= BIT(sl);
+	h->free_bytes += block_size(b);
+}
+
+static void remove_free(struct sys_tlsf *h, struct sys_tlsf_block *b)
+{
+	struct sys_tlsf_block **head;
+	int fl, sl;
+
+	mapping(block_size(b), &fl, &sl);
+	head = list_head(h, fl, sl);
+
+	if (b->prev_free != NULL) {
+		b->prev_free->next_free = b->next_free;
+	} else {
+		*head = b->next_free;
+	}
+	if (b->next_free != NULL) {
+		b->next_free->prev_free = b->prev_free;
+	}
+
+	if (*head == NULL) {
+		h->sl_bitmap[fl] &= ~BIT(sl);
+		if (h->sl_bitmap[fl] == 0) {
+			h->fl_bitmap &= ~BIT(fl);
+		}
+	}
+
+	h->free_bytes -= block_size(b);
+}
+
+static struct sys_tlsf_block *find_free(struct sys_tlsf *h, size_t size)
+{
+	u32_t sl_map, fl_map;
+	int fl, sl;
+
+	mapping_search(size, &fl, &sl);
+	if (fl >= h->fl_count) {
+		return NULL;
+	}
+
+	sl_map = h->sl_bitmap[fl] & (~0U << sl);
+	if (sl_map == 0) {
+		fl_map = h->fl_bitmap & (~0U << (fl + 1));
+		if (fl_map == 0) {
+			return NULL;
+		}
+
+		fl = __builtin_ctz(fl_map);
+		sl_map = h->sl_bitmap[fl];
+	}
+
+	return *list_head(h, fl, __builtin_ctz(sl_map));
+}
+
+/* Returns the payload size to carve for a request, or zero if it can
+ * never be satisfied.
+ */
+static size_t adjust_request(struct sys_tlsf *h, size_t bytes)
+{
+	if (bytes == 0 || bytes > h->size) {
+		return 0;
+	}
+
+	bytes = ROUND_UP(bytes, ALIGN);
+
+	return MAX(bytes, BLOCK_MIN);
+}
+
+/* Cuts b down to a payload of size bytes and returns the (free, not
+ * yet listed) block made of what was left.  The caller fixes up the
+ * physical links.
+ */
+static struct sys_tlsf_block *split(struct sys_tlsf_block *b, size_t size)
+{
+	struct sys_tlsf_block *rem;
+
+	rem = (struct sys_tlsf_block *)((u8_t *)block_payload(b) + size
+					 - BLOCK_OVERHEAD);
+	rem->size = (block_size(b) - size - BLOCK_OVERHEAD) | BLOCK_FREE;
+	b->size = size | (b->size & BLOCK_FLAGS);
+
+	return rem;
+}
+
+static bool can_split(struct sys_tlsf_block *b, size_t size)
+{
+	return block_size(b) >= size + sizeof(struct sys_tlsf_block);
+}
+
+/* Marks a block just removed from its free list as allocated,
+ * returning any excess beyond size to the heap.
+ */
+static void *use_block(struct sys_tlsf *h, struct sys_tlsf_block *b,
+		       size_t size)
+{
+	struct sys_tlsf_block *n;
+
+	if (can_split(b, size)) {
+		struct sys_tlsf_block *rem = split(b, size);
+
+		n = next_phys(rem);
+		n->prev_phys = rem;
+		n->size |= BLOCK_PREV_FREE;
+		insert_free(h, rem);
+	} else {
+		n = next_phys(b);
+		n->size &= ~BLOCK_PREV_FREE;
+	}
+
+	b->size &= ~BLOCK_FREE;
+
+	return block_payload(b);
+}
+
+void *sys_tlsf_alloc(struct sys_tlsf *h, size_t bytes)
+{
+	struct sys_tlsf_block *b;
+	size_t size = adjust_request(h, bytes);
+
+	if (size == 0) {
+		return NULL;
+	}
+
+	b = find_free(h, size);
+	if (b == NULL) {
+		return NULL;
+	}
+
+	remove_free(h, b);
+
+	return use_block(h, b, size);
+}
+
+void *sys_tlsf_aligned_alloc(struct sys_tlsf *h, size_t align, size_t bytes)
+{
+	const size_t gap_min = sizeof(struct sys_tlsf_block);
+	struct sys_tlsf_block *b;
+	uintptr_t p, a;
+	size_t size;
+
+	__ASSERT((align & (align - 1)) == 0, "align must be a power of two");
+
+	if (align <= ALIGN) {
+		return sys_tlsf_alloc(h, bytes);
+	}
+
+	size = adjust_request(h, bytes);
+	if (size == 0 || align > h->size ||
+	    size + align + gap_min > h->size) {
+		return NULL;
+	}
+
+	/* Any free block this large has an aligned address inside it
+	 * which leaves room for a free block in front of it
+	 */
+	b = find_free(h, size + align + gap_min);
+	if (b == NULL) {
+		return NULL;
+	}
+
+	remove_free(h, b);
+
+	p = (uintptr_t)block_payload(b);
+	a = ROUND_UP(p, align);
+	if (a != p && a - p < gap_min) {
+		a = ROUND_UP(p + gap_min, align);
+	}
+
+	if (a != p) {
+		struct sys_tlsf_block *rem = split(b, a - p - BLOCK_OVERHEAD);
+
+		rem->prev_phys = b;
+		rem->size |= BLOCK_PREV_FREE;
+		next_phys(rem)->prev_phys = rem;
+		insert_free(h, b);
+		b = rem;
+	}
+
+	return use_block(h, b, size);
+}
+
+void sys_tlsf_free(struct sys_tlsf *h, void *mem)
+{
+	struct sys_tlsf_block *b, *n;
+
+	if (mem == NULL) {
+		return;
+	}
+
+	b = payload_block(mem);
+	__ASSERT((b->size & BLOCK_FREE) == 0, "double free of %p", mem);
+
+	b->size |= BLOCK_FREE;
+
+	if (b->size & BLOCK_PREV_FREE) {
+		struct sys_tlsf_block *p = b->prev_phys;
+
+		remove_free(h, p);
+		p->size += block_size(b) + BLOCK_OVERHEAD;
+		b = p;
+	}
+
+	n = next_phys(b);
+	if (n->size & BLOCK_FREE) {
+		remove_free(h, n);
+		b->size += block_size(n) + BLOCK_OVERHEAD;
+		n = next_phys(b);
+	}
+
+	n->prev_phys = b;
+	n->size |= BLOCK_PREV_FREE;
+	insert_free(h, b);
+}
+
+size_t sys_tlsf_usable_size(void *mem)
+{
+	return block_size(payload_block(mem));
+}
+
+size_t sys_tlsf_largest_free(struct sys_tlsf *h)
+{
+	struct sys_tlsf_block *b;
+	size_t largest = 0;
+	int fl;
+
+	if (h->fl_bitmap == 0) {
+		return 0;
+	}
+
+	fl = msb(h->fl_bitmap);
+	b = *list_head(h, fl, msb(h->sl_bitmap[fl]));
+	for (; b != NULL; b = b->next_free) {
+		largest = MAX(largest, block_size(b));
+	}
+
+	return largest;
+}
+
+void sys_tlsf_init(struct sys_tlsf *h, void *mem, size_t bytes)
+{
+	uintptr_t start = (uintptr_t)mem;
+	uintptr_t end = ROUND_DOWN(start + bytes, ALIGN);
+	struct sys_tlsf_block *b, *sentinel;
+	size_t bitmaps, lists;
+	int fl, sl;
+
+	__ASSERT((start & (ALIGN - 1)) == 0, "unaligned heap memory");
+
+	/* No block can be as large as the region itself, so its size
+	 * class bounds the number of first level lists needed
+	 */
+	mapping(bytes, &fl, &sl);
+	__ASSERT(fl < 31, "heap too large");
+
+	bitmaps = ROUND_UP((fl + 1) * sizeof(u32_t), ALIGN);
+	lists = (fl + 1) * SL_COUNT * sizeof(struct sys_tlsf_block *);
+	__ASSERT(end - start >= bitmaps + lists + 3 * BLOCK_OVERHEAD
+		 + BLOCK_MIN, "heap memory too small");
+
+	h->buf = mem;
+	h->size = bytes;
+	h->fl_bitmap = 0;
+	h->fl_count = fl + 1;
+	h->sl_bitmap = mem;
+	h->free_lists = (struct sys_tlsf_block **)(start + bitmaps);
+	h->free_bytes = 0;
+	(void)memset(mem, 0, bitmaps + lists);
+
+	start += bitmaps + lists;
+	b = (struct sys_tlsf_block *)start;
+	b->size = (end - start - 3 * BLOCK_OVERHEAD) | BLOCK_FREE;
+
+	sentinel = next_phys(b);
+	sentinel->prev_phys = b;
+	sentinel->size = BLOCK_PREV_FREE;
+
+	insert_free(h, b);
+}
@@ -43,6 +43,7 @@ void k_work_q_user_start(struct k_work_q *work_q, k_thread_stack_t *stack,
 			 size_t stack_size, int prio)
 {
 	k_queue_init(&work_q->queue);
+	work_q->num_workers = 0;
 
 	/* Created worker thread will inherit object permissions and memory
 	 * domain configuration of the caller
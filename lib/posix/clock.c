@@ -17,6 +17,20 @@
  */
 static struct timespec rt_clock_base;
 
+/*
+ * The coarse clocks are read from the time page when available, which
+ * spares user threads a system call, but is only tick-accurate and may
+ * lag in tickless mode, see k_uptime_get_fast().
+ */
+static s64_t uptime_get_coarse(void)
+{
+#ifdef CONFIG_TIME_PAGE
+	return k_uptime_get_fast();
+#else
+	return k_uptime_get();
+#endif
+}
+
 /**
  * @brief Get clock time specified by clock_id.
  *
@@ -26,13 +40,20 @@ int clock_gettime(clockid_t clock_id, struct timespec *ts)
 {
 	u64_t elapsed_msecs;
 	struct timespec base;
+	bool coarse = false;
 
 	switch (clock_id) {
+	case CLOCK_MONOTONIC_COARSE:
+		coarse = true;
+		/* fall through */
 	case CLOCK_MONOTONIC:
 		base.tv_sec = 0;
 		base.tv_nsec = 0;
 		break;
 
+	case CLOCK_REALTIME_COARSE:
+		coarse = true;
+		/* fall through */
 	case CLOCK_REALTIME:
 		base = rt_clock_base;
 		break;
@@ -42,7 +63,7 @@ int clock_gettime(clockid_t clock_id, struct timespec *ts)
 		return -1;
 	}
 
-	elapsed_msecs = k_uptime_get();
+	elapsed_msecs = coarse ? uptime_get_coarse() : k_uptime_get();
 	ts->tv_sec = (s32_t) (elapsed_msecs / MSEC_PER_SEC);
 	ts->tv_nsec = (s32_t) ((elapsed_msecs % MSEC_PER_SEC) *
 					USEC_PER_MSEC * NSEC_PER_USEC);
@@ -323,7 +323,15 @@ def analyze_die_array(die):
     type_env[die.offset] = ArrayType(die.offset, elements, type_offset)
 
 
+def addr_size(elf):
+    return 8 if elf.elfclass == 64 else 4
+
+
 def addr_deref(elf, addr):
+    # Pointers are as wide as the ELF class
+    size = addr_size(elf)
+    fmt = ("<" if elf.little_endian else ">") + ("Q" if size == 8 else "I")
+
     for section in elf.iter_sections():
         start = section['sh_addr']
         end = start + section['sh_size']
@@ -331,14 +339,14 @@ def addr_deref(elf, addr):
         if addr >= start and addr < end:
             data = section.data()
             offset = addr - start
-            return struct.unpack("<I" if elf.little_endian else ">I",
-                                 data[offset:offset + 4])[0]
+            return struct.unpack(fmt, data[offset:offset + size])[0]
 
     return 0
 
 
 def device_get_api_addr(elf, addr):
-    return addr_deref(elf, addr + 4)
+    # The api pointer follows the config pointer in struct device
+    return addr_deref(elf, addr + addr_size(elf))
 
 
 def get_filename_lineno(die):
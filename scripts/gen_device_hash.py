@@ -0,0 +1,213 @@
+#!/usr/bin/env python3
+#
+# Copyright (c) 2019 Intel Corporation
+#
+# SPDX-License-Identifier: Apache-2.0
+
+"""
+Generate a perfect hash table of device names
+
+device_get_binding() looks devices up by name. This script reads the
+names of all the devices of the kernel binary from its first link pass,
+and generates a C file with a perfect hash table of these names, so that
+the lookup takes constant time once the table is linked into the final
+binary.
+
+The generated file only holds data. It maps names to indexes in the
+device list, which does not change between link passes, rather than to
+addresses, so the table can be placed anywhere in the final binary. The
+hash function is implemented in kernel/include/device_name_hash.h; the
+table uses the hash and displace scheme:
+
+    bucket = hash(0, name) % buckets
+    slot = hash(displacements[bucket], name) % size
+
+Names shared by several devices are flagged, and left to the linear
+search of device_get_binding().
+"""
+
+import os
+import sys
+import argparse
+from collections import Counter
+from elftools.elf.sections import SymbolTableSection
+from elf_helper import ElfHelper, addr_deref
+
+DUP = 0x8000
+EMPTY = 0xFFFF
+MAX_DISPLACEMENT = 0xFFFF
+
+header = """/* Generated by %s, do not edit */
+
+#include <device_name_hash.h>
+
+"""
+
+
+def debug(text):
+    if args.verbose:
+        sys.stdout.write(sys.argv[0] + ": " + text + "\n")
+
+
+def error(text):
+    sys.stderr.write("%s ERROR: %s\n" % (sys.argv[0], text))
+    sys.exit(1)
+
+
+def name_hash(seed, name):
+    # Must match z_device_name_hash_fn()
+    h = 2166136261 ^ seed
+    for c in name:
+        h = ((h ^ c) * 16777619) & 0xFFFFFFFF
+    return h
+
+
+def read_string(elf, addr):
+    for section in elf.iter_sections():
+        start = section['sh_addr']
+        end = start + section['sh_size']
+
+        if section['sh_type'] != 'SHT_NOBITS' and start <= addr < end:
+            data = section.data()
+            offset = addr - start
+            return data[offset:data.index(b'\0', offset)]
+
+    return None
+
+
+def get_devices(eh):
+    """Returns the names of the devices, in device list order"""
+    elf = eh.elf
+    syms = eh.get_symbols()
+    start = syms["__device_init_start"]
+    end = syms["__device_init_end"]
+
+    # Devices are static objects of the same size in the device list
+    sizes = set()
+    for section in elf.iter_sections():
+        if not isinstance(section, SymbolTableSection):
+            continue
+        for sym in section.iter_symbols():
+            if (sym.entry.st_info.type == 'STT_OBJECT' and
+                    start <= sym.entry.st_value < end and
+                    sym.entry.st_size != 0):
+                sizes.add(sym.entry.st_size)
+
+    if not sizes:
+        return []
+    if len(sizes) != 1:
+        error("cannot tell the size of struct device: %s" % sorted(sizes))
+
+    size = sizes.pop()
+    names = []
+    for addr in range(start, end, size):
+        # struct device starts with its config, which starts with its name
+        config = addr_deref(elf, addr)
+        name = read_string(elf, addr_deref(elf, config))
+        names.append(name if name else None)
+
+    return names
+
+
+def build_table(keys):
+    """Returns displacements and slots of a perfect hash of keys, a
+    dictionary of names to slot values
+    """
+    names = list(keys)
+    buckets = max(1, (len(names) + 3) // 4)
+    size = max(1, len(names) + len(names) // 4)
+
+    while True:
+        bucket_names = [[] for _ in range(buckets)]
+        for name in names:
+            bucket_names[name_hash(0, name) % buckets].append(name)
+
+        displacements = [0] * buckets
+        slots = [EMPTY] * size
+
+        # Place the largest buckets first, while most slots are free
+        order = sorted((b for b in range(buckets) if bucket_names[b]),
+                       key=lambda b: -len(bucket_names[b]))
+        for b in order:
+            for d in range(MAX_DISPLACEMENT + 1):
+                pos = [name_hash(d, name) % size for name in bucket_names[b]]
+                if (len(set(pos)) == len(pos) and
+                        all(slots[p] == EMPTY for p in pos)):
+                    break
+            else:
+                break
+
+            displacements[b] = d
+            for p, name in zip(pos, bucket_names[b]):
+                slots[p] = keys[name]
+        else:
+            return displacements, slots
+
+        debug("no displacement found with %d slots, retrying" % size)
+        size += 1
+
+
+def write_array(fp, name, values):
+    fp.write("static const u16_t %s[] = {" % name)
+    for i, value in enumerate(values):
+        if i % 8 == 0:
+            fp.write("\n\t")
+        else:
+            fp.write(" ")
+        fp.write("0x%04x," % value)
+    fp.write("\n};\n\n")
+
+
+def write_table(fp, displacements, slots):
+    fp.write(header % os.path.basename(sys.argv[0]))
+    write_array(fp, "displacements", displacements)
+    write_array(fp, "slots", slots)
+    fp.write("const struct device_name_hash z_device_name_hash = {\n")
+    fp.write("\t.displacements = displacements,\n")
+    fp.write("\t.buckets = %d,\n" % len(displacements))
+    fp.write("\t.size = %d,\n" % len(slots))
+    fp.write("\t.slots = slots,\n")
+    fp.write("};\n")
+
+
+def parse_args():
+    global args
+
+    parser = argparse.ArgumentParser(
+        description=__doc__,
+        formatter_class=argparse.RawDescriptionHelpFormatter)
+
+    parser.add_argument("-k", "--kernel", required=True,
+                        help="Input zephyr ELF binary")
+    parser.add_argument("-o", "--output", required=True,
+                        help="Output C file of the device name hash table")
+    parser.add_argument("-v", "--verbose", action="store_true",
+                        help="Print extra debugging information")
+    args = parser.parse_args()
+
+
+def main():
+    parse_args()
+
+    eh = ElfHelper(args.kernel, args.verbose, {}, [])
+    names = get_devices(eh)
+    if len(names) >= DUP:
+        error("too many devices (%d)" % len(names))
+
+    # SYS_INIT() entries have no name and cannot be looked up
+    counts = Counter(name for name in names if name)
+    keys = {}
+    for index, name in enumerate(names):
+        if name and name not in keys:
+            keys[name] = index | (DUP if counts[name] > 1 else 0)
+
+    displacements, slots = build_table(keys)
+    debug("%d devices, %d names, %d buckets, %d slots" %
+          (len(names), len(keys), len(displacements), len(slots)))
+
+    with open(args.output, "w") as fp:
+        write_table(fp, displacements, slots)
+
+
+if __name__ == "__main__":
+    main()
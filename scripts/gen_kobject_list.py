@@ -23,6 +23,7 @@ kobjects = {
     "k_pipe": None,
     "k_queue": None,
     "k_poll_signal": None,
+    "k_pollset": None,
     "k_sem": None,
     "k_stack": None,
     "k_thread": None,
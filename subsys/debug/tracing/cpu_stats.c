@@ -6,6 +6,8 @@
 
 #include <tracing_cpu_stats.h>
 #include <misc/printk.h>
+#include <ksched.h>
+#include <string.h>
 
 enum cpu_state {
 	CPU_STATE_IDLE,
@@ -48,6 +50,10 @@ void update_counter(volatile u64_t *cnt)
 
 static void cpu_stats_update_counters(void)
 {
+#ifdef CONFIG_TRACING_CPU_STATS_THREADS
+	u32_t prev_time = last_time;
+#endif
+
 	switch (last_cpu_state) {
 	case CPU_STATE_IDLE:
 		update_counter(&stats_hw_tick.idle);
@@ -66,8 +72,84 @@ static void cpu_stats_update_counters(void)
 		__ASSERT_NO_MSG(false);
 		break;
 	}
+
+#ifdef CONFIG_TRACING_CPU_STATS_THREADS
+	/* Time outside of the scheduler and interrupts belongs to the
+	 * thread that was running
+	 */
+	if (last_cpu_state != CPU_STATE_SCHEDULER && nested_interrupts == 0 &&
+	    current_thread != NULL) {
+		current_thread->runtime_stats.cycles += last_time - prev_time;
+	}
+#endif
+}
+
+#ifdef CONFIG_TRACING_CPU_STATS_THREADS
+static void thread_wait_start(struct k_thread *thread)
+{
+	struct k_thread_runtime_stats *stats = &thread->runtime_stats;
+
+	if (!stats->waiting) {
+		stats->ready_at = k_cycle_get_32();
+		stats->waiting = 1U;
+	}
+}
+
+static void thread_wait_end(struct k_thread *thread)
+{
+	struct k_thread_runtime_stats *stats = &thread->runtime_stats;
+	u32_t us, bucket = 0U;
+
+	stats->switches++;
+	if (!stats->waiting) {
+		return;
+	}
+
+	us = (u32_t)(SYS_CLOCK_HW_CYCLES_TO_NS64(k_cycle_get_32() -
+						 stats->ready_at) / 1000);
+	while (us > 1U && bucket < K_THREAD_LATENCY_BUCKETS - 1) {
+		us >>= 1;
+		bucket++;
+	}
+	stats->latency[bucket]++;
+	stats->waiting = 0U;
+}
+
+void sys_trace_thread_ready(struct k_thread *thread)
+{
+	int key = irq_lock();
+
+	if (thread != k_current_get()) {
+		thread_wait_start(thread);
+	}
+	irq_unlock(key);
+}
+
+void cpu_stats_thread_get(k_tid_t thread,
+			  struct k_thread_runtime_stats *stats)
+{
+	int key = irq_lock();
+
+	if (thread == current_thread) {
+		cpu_stats_update_counters();
+	}
+	*stats = thread->runtime_stats;
+	irq_unlock(key);
 }
 
+void cpu_stats_thread_reset(k_tid_t thread)
+{
+	int key = irq_lock();
+
+	if (thread == current_thread) {
+		cpu_stats_update_counters();
+	}
+	(void)memset(&thread->runtime_stats, 0,
+		     sizeof(thread->runtime_stats));
+	irq_unlock(key);
+}
+#endif /* CONFIG_TRACING_CPU_STATS_THREADS */
+
 void cpu_stats_get_ns(struct cpu_stats *cpu_stats_ns)
 {
 	int key = irq_lock();
@@ -110,6 +192,9 @@ void sys_trace_thread_switched_in(void)
 
 	cpu_stats_update_counters();
 	current_thread = k_current_get();
+#ifdef CONFIG_TRACING_CPU_STATS_THREADS
+	thread_wait_end(current_thread);
+#endif
 	if (is_idle_thread(current_thread)) {
 		last_cpu_state = CPU_STATE_IDLE;
 	} else {
@@ -126,6 +211,13 @@ void sys_trace_thread_switched_out(void)
 	__ASSERT_NO_MSG(current_thread == k_current_get());
 
 	cpu_stats_update_counters();
+#ifdef CONFIG_TRACING_CPU_STATS_THREADS
+	/* A preempted thread waits for the CPU again */
+	if (_is_thread_ready(current_thread) &&
+	    !is_idle_thread(current_thread)) {
+		thread_wait_start(current_thread);
+	}
+#endif
 	last_cpu_state = CPU_STATE_SCHEDULER;
 	irq_unlock(key);
 }
@@ -147,11 +239,14 @@ void sys_trace_isr_exit(void)
 {
 	int key = irq_lock();
 
-	nested_interrupts--;
-	if (nested_interrupts == 0) {
+	/* Account the interrupt before leaving it, so that its time is
+	 * not charged to the interrupted thread
+	 */
+	if (nested_interrupts == 1) {
 		cpu_stats_update_counters();
 		last_cpu_state = cpu_state_before_interrupts;
 	}
+	nested_interrupts--;
 	irq_unlock(key);
 }
 
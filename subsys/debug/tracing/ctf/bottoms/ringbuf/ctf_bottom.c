@@ -0,0 +1,360 @@
+/*
+ * Copyright (c) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <errno.h>
+#include <kernel.h>
+#include <kernel_structs.h>
+#include <atomic.h>
+#include <misc/util.h>
+#include <ctf_middle.h>
+#include "ctf_bottom.h"
+
+#ifdef CONFIG_ARCH_POSIX
+#include <stdio.h>
+#include "soc.h"
+#include "cmdline.h" /* native_posix command line options header */
+#include "posix_trace.h"
+#endif
+
+#define RING_SIZE CONFIG_TRACING_CTF_RINGBUF_SIZE
+#define RING_MASK (RING_SIZE - 1)
+
+BUILD_ASSERT_MSG((RING_SIZE & RING_MASK) == 0,
+		 "TRACING_CTF_RINGBUF_SIZE must be a power of two");
+
+/* Size of the events_dropped event: timestamp, id and count */
+#define DROP_EVENT_SIZE (sizeof(u32_t) + sizeof(u8_t) + sizeof(u32_t))
+
+/* Ring buffer of packed events, with a single producer and a single
+ * consumer. head and tail run freely and are only reduced modulo the
+ * size when indexing data[].
+ */
+struct ctf_ring {
+	/* Written by the owning CPU, with its interrupts locked */
+	atomic_t head;
+	/* Written by the drain thread */
+	atomic_t tail;
+	/* Events lost since the last events_dropped event */
+	u32_t dropped;
+	/* Events lost since boot */
+	u32_t dropped_total;
+	u8_t data[RING_SIZE];
+};
+
+static struct ctf_ring rings[CONFIG_MP_NUM_CPUS];
+
+/* Set while the rings are being drained, which also protects the output */
+static atomic_t draining;
+
+static void ring_copy_in(u8_t *buf, u32_t size, u32_t pos,
+			 const void *src, u32_t len)
+{
+	u32_t off = pos & (size - 1);
+	u32_t first = MIN(len, size - off);
+
+	memcpy(&buf[off], src, first);
+	memcpy(&buf[0], (const u8_t *)src + first, len - first);
+}
+
+void ctf_bottom_emit(const void *ptr, size_t size)
+{
+	unsigned int key;
+	struct ctf_ring *ring;
+	u32_t head, tail, need;
+	u32_t tstamp;
+
+	/* Only the owning CPU writes to a ring, so masking local
+	 * interrupts is enough to serialize its producers. irq_lock() is
+	 * a global lock on SMP, use the underlying arch implementation.
+	 */
+	key = _arch_irq_lock();
+
+	ring = &rings[_current_cpu->id];
+	tstamp = k_cycle_get_32();
+
+	head = (u32_t)atomic_get(&ring->head);
+	tail = (u32_t)atomic_get(&ring->tail);
+	need = sizeof(tstamp) + size;
+	if (ring->dropped != 0) {
+		need += DROP_EVENT_SIZE;
+	}
+
+	if (need > RING_SIZE - (head - tail)) {
+		ring->dropped++;
+		ring->dropped_total++;
+		_arch_irq_unlock(key);
+		return;
+	}
+
+	/* Report the gap at the position it occurred in the stream */
+	if (ring->dropped != 0) {
+		u8_t id = CTF_EVENT_EVENTS_DROPPED;
+
+		ring_copy_in(ring->data, RING_SIZE, head, &tstamp,
+			     sizeof(tstamp));
+		head += sizeof(tstamp);
+		ring_copy_in(ring->data, RING_SIZE, head, &id, sizeof(id));
+		head += sizeof(id);
+		ring_copy_in(ring->data, RING_SIZE, head, &ring->dropped,
+			     sizeof(ring->dropped));
+		head += sizeof(ring->dropped);
+		ring->dropped = 0;
+	}
+
+	ring_copy_in(ring->data, RING_SIZE, head, &tstamp, sizeof(tstamp));
+	head += sizeof(tstamp);
+	ring_copy_in(ring->data, RING_SIZE, head, ptr, size);
+	head += size;
+
+	/* Publish the complete events to the drain thread */
+	atomic_set(&ring->head, (atomic_val_t)head);
+
+	_arch_irq_unlock(key);
+}
+
+u32_t ctf_bottom_dropped(int cpu)
+{
+	return rings[cpu].dropped_total;
+}
+
+#ifdef CONFIG_ARCH_POSIX
+
+static struct {
+	const char *pathname;
+	FILE *ostream;
+} ctf_output;
+
+static void output_write(int cpu, const u8_t *seg0, u32_t len0,
+			 const u8_t *seg1, u32_t len1)
+{
+	ARG_UNUSED(cpu);
+
+	fwrite(seg0, len0, 1, ctf_output.ostream);
+	if (len1 != 0) {
+		fwrite(seg1, len1, 1, ctf_output.ostream);
+	}
+}
+
+void ctf_bottom_configure(void)
+{
+	if (ctf_output.pathname == NULL) {
+		ctf_output.pathname = "channel0_0";
+	}
+
+	ctf_output.ostream = fopen(ctf_output.pathname, "wb");
+	if (ctf_output.ostream == NULL) {
+		posix_print_error_and_exit("CTF trace: "
+					   "Problem opening file %s.\n",
+					   ctf_output.pathname);
+	}
+}
+
+#else
+
+#define DUMP_SIZE CONFIG_TRACING_CTF_RINGBUF_DUMP_SIZE
+
+BUILD_ASSERT_MSG((DUMP_SIZE & (DUMP_SIZE - 1)) == 0,
+		 "TRACING_CTF_RINGBUF_DUMP_SIZE must be a power of two");
+
+/* Post-mortem buffer. Each drained chunk of complete events is stored as a
+ * record, so that the oldest records can be overwritten without leaving a
+ * partial event at the start of a stream.
+ */
+struct dump_record {
+	u32_t len : 24;
+	u32_t cpu : 8;
+};
+
+static struct {
+	u32_t head;
+	u32_t tail;
+	u8_t data[DUMP_SIZE];
+} dump;
+
+static void ring_copy_out(const u8_t *buf, u32_t size, u32_t pos,
+			  void *dst, u32_t len)
+{
+	u32_t off = pos & (size - 1);
+	u32_t first = MIN(len, size - off);
+
+	memcpy(dst, &buf[off], first);
+	memcpy((u8_t *)dst + first, &buf[0], len - first);
+}
+
+static void output_write(int cpu, const u8_t *seg0, u32_t len0,
+			 const u8_t *seg1, u32_t len1)
+{
+	struct dump_record rec = {
+		.len = len0 + len1,
+		.cpu = cpu,
+	};
+	u32_t need = sizeof(rec) + rec.len;
+
+	if (need > DUMP_SIZE) {
+		return;
+	}
+
+	while (DUMP_SIZE - (dump.head - dump.tail) < need) {
+		struct dump_record old;
+
+		ring_copy_out(dump.data, DUMP_SIZE, dump.tail, &old,
+			      sizeof(old));
+		dump.tail += sizeof(old) + old.len;
+	}
+
+	ring_copy_in(dump.data, DUMP_SIZE, dump.head, &rec, sizeof(rec));
+	dump.head += sizeof(rec);
+	ring_copy_in(dump.data, DUMP_SIZE, dump.head, seg0, len0);
+	dump.head += len0;
+	ring_copy_in(dump.data, DUMP_SIZE, dump.head, seg1, len1);
+	dump.head += len1;
+}
+
+void ctf_bottom_configure(void)
+{
+}
+
+#endif /* CONFIG_ARCH_POSIX */
+
+static void drain_ring(int cpu)
+{
+	struct ctf_ring *ring = &rings[cpu];
+	u32_t head = (u32_t)atomic_get(&ring->head);
+	u32_t tail = (u32_t)atomic_get(&ring->tail);
+	u32_t off = tail & RING_MASK;
+	u32_t len = head - tail;
+	u32_t first = MIN(len, RING_SIZE - off);
+
+	if (len == 0) {
+		return;
+	}
+
+	/* [tail, head) only holds complete events, hand it over at once
+	 * even when it wraps.
+	 */
+	output_write(cpu, &ring->data[off], first,
+		     &ring->data[0], len - first);
+
+	atomic_set(&ring->tail, (atomic_val_t)head);
+}
+
+static void drain_all(void)
+{
+	for (int i = 0; i < CONFIG_MP_NUM_CPUS; i++) {
+		drain_ring(i);
+	}
+}
+
+int ctf_bottom_flush(void)
+{
+	if (!atomic_cas(&draining, 0, 1)) {
+		return -EBUSY;
+	}
+
+	drain_all();
+	atomic_clear(&draining);
+
+	return 0;
+}
+
+#ifndef CONFIG_ARCH_POSIX
+int ctf_bottom_dump(int cpu, ctf_bottom_dump_cb_t cb, void *user_data)
+{
+	u32_t pos;
+	int total = 0;
+
+	if (!atomic_cas(&draining, 0, 1)) {
+		return -EBUSY;
+	}
+
+	drain_all();
+
+	for (pos = dump.tail; pos != dump.head; ) {
+		struct dump_record rec;
+		u32_t off, first;
+
+		ring_copy_out(dump.data, DUMP_SIZE, pos, &rec, sizeof(rec));
+		pos += sizeof(rec);
+
+		if (rec.cpu == cpu) {
+			off = pos & (DUMP_SIZE - 1);
+			first = MIN((u32_t)rec.len, DUMP_SIZE - off);
+
+			cb(&dump.data[off], first, user_data);
+			if (rec.len > first) {
+				cb(&dump.data[0], rec.len - first, user_data);
+			}
+			total += rec.len;
+		}
+
+		pos += rec.len;
+	}
+
+	atomic_clear(&draining);
+
+	return total;
+}
+#endif
+
+void ctf_bottom_start(void)
+{
+}
+
+static void ctf_drain_thread(void *p1, void *p2, void *p3)
+{
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	while (true) {
+		(void)ctf_bottom_flush();
+		k_sleep(CONFIG_TRACING_CTF_RINGBUF_DRAIN_INTERVAL);
+	}
+}
+
+K_THREAD_DEFINE(ctf_drain, CONFIG_TRACING_CTF_RINGBUF_THREAD_STACK_SIZE,
+		ctf_drain_thread, NULL, NULL, NULL,
+		CONFIG_TRACING_CTF_RINGBUF_THREAD_PRIO, 0, K_NO_WAIT);
+
+#ifdef CONFIG_ARCH_POSIX
+/* Write out what is left in the rings when the executable exits */
+static void ctf_cleanup(void)
+{
+	if (ctf_output.ostream != NULL) {
+		drain_all();
+		fclose(ctf_output.ostream);
+		ctf_output.ostream = NULL;
+	}
+}
+NATIVE_TASK(ctf_cleanup, ON_EXIT, 1);
+
+/* command line option to specify ctf output file */
+void add_ctf_option(void)
+{
+	static struct args_struct_t ctf_options[] = {
+		/*
+		 * Fields:
+		 * manual, mandatory, switch,
+		 * option_name, var_name ,type,
+		 * destination, callback,
+		 * description
+		 */
+		{ .manual = false,
+		  .is_mandatory = false,
+		  .is_switch = false,
+		  .option = "ctf-path",
+		  .name = "file_name",
+		  .type = 's',
+		  .dest = (void *)&ctf_output.pathname,
+		  .call_when_found = NULL,
+		  .descript = "File name for CTF tracing output." },
+		ARG_TABLE_ENDMARKER
+	};
+
+	native_add_command_line_opts(ctf_options);
+}
+NATIVE_TASK(add_ctf_option, PRE_BOOT_1, 1);
+#endif /* CONFIG_ARCH_POSIX */
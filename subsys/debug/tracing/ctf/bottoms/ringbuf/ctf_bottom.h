@@ -0,0 +1,88 @@
+/*
+ * Copyright (c) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef SUBSYS_DEBUG_TRACING_BOTTOMS_RINGBUF_CTF_BOTTOM_H
+#define SUBSYS_DEBUG_TRACING_BOTTOMS_RINGBUF_CTF_BOTTOM_H
+
+#include <stddef.h>
+#include <string.h>
+#include <zephyr/types.h>
+#include <ctf_map.h>
+
+
+/* Obtain a field's size at compile-time.
+ * Internal to this bottom-layer.
+ */
+#define CTF_BOTTOM_INTERNAL_FIELD_SIZE(x)      + sizeof(x)
+
+/* Append a field to current event-packet.
+ * Internal to this bottom-layer.
+ */
+#define CTF_BOTTOM_INTERNAL_FIELD_APPEND(x)		 \
+	{						 \
+		memcpy(epacket_cursor, &(x), sizeof(x)); \
+		epacket_cursor += sizeof(x);		 \
+	}
+
+/* Gather fields to a contiguous event-packet, then emit it into the ring
+ * buffer of the current CPU. Used by middle-layer.
+ */
+#define CTF_BOTTOM_FIELDS(...)						    \
+{									    \
+	u8_t epacket[0 MAP(CTF_BOTTOM_INTERNAL_FIELD_SIZE, ##__VA_ARGS__)]; \
+	u8_t *epacket_cursor = &epacket[0];				    \
+									    \
+	MAP(CTF_BOTTOM_INTERNAL_FIELD_APPEND, ##__VA_ARGS__)		    \
+	ctf_bottom_emit(epacket, sizeof(epacket));			    \
+}
+
+/* ctf_bottom_emit() only masks local interrupts while it copies into the
+ * ring of the current CPU, no lock is shared between CPUs.
+ * Used by middle-layer.
+ */
+#define CTF_BOTTOM_LOCK()         { /* empty */ }
+#define CTF_BOTTOM_UNLOCK()       { /* empty */ }
+
+/* The timestamp is not sampled by the middle-layer: ctf_bottom_emit()
+ * samples it once it owns the ring, so that the events of each CPU stream
+ * are in timestamp order even when an interrupt preempts a writer.
+ * Used by middle-layer.
+ */
+#define CTF_BOTTOM_TIMESTAMPED_EXTERNALLY
+
+
+/* Configure initializes the ring buffers and opens the IO channel */
+void ctf_bottom_configure(void);
+
+/* Start a new trace stream */
+void ctf_bottom_start(void);
+
+/* Timestamp and copy an event-packet into the ring of the current CPU */
+void ctf_bottom_emit(const void *ptr, size_t size);
+
+/* Number of events dropped so far by the given CPU because its ring was
+ * full.
+ */
+u32_t ctf_bottom_dropped(int cpu);
+
+/* Move the events buffered by every CPU to the output now. Returns
+ * -EBUSY if the drain thread is doing so already.
+ */
+int ctf_bottom_flush(void);
+
+#ifndef CONFIG_ARCH_POSIX
+typedef void (*ctf_bottom_dump_cb_t)(const void *data, size_t len,
+				     void *user_data);
+
+/* Flush, then hand the post-mortem buffer content recorded for the given
+ * CPU to the callback, oldest events first. Each CPU is a separate CTF
+ * stream, to be stored as channel0_<cpu>. Returns the number of bytes
+ * passed to the callback or -EBUSY.
+ */
+int ctf_bottom_dump(int cpu, ctf_bottom_dump_cb_t cb, void *user_data);
+#endif
+
+#endif /* SUBSYS_DEBUG_TRACING_BOTTOMS_RINGBUF_CTF_BOTTOM_H */
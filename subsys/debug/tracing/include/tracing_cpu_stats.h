@@ -26,6 +26,30 @@ void cpu_stats_get_ns(struct cpu_stats *cpu_stats_ns);
 u32_t cpu_stats_non_idle_and_sched_get_percent(void);
 void cpu_stats_reset_counters(void);
 
+#ifdef CONFIG_TRACING_CPU_STATS_THREADS
+/**
+ * @brief Get the CPU usage statistics of a thread
+ *
+ * The execution cycles of the running thread are brought up to date.
+ *
+ * @param thread Thread to query
+ * @param stats Copy of the statistics of the thread
+ */
+void cpu_stats_thread_get(k_tid_t thread,
+			  struct k_thread_runtime_stats *stats);
+
+/**
+ * @brief Reset the CPU usage statistics of a thread
+ *
+ * @param thread Thread whose statistics are cleared
+ */
+void cpu_stats_thread_reset(k_tid_t thread);
+
+void sys_trace_thread_ready(struct k_thread *thread);
+#else
+#define sys_trace_thread_ready(thread)
+#endif
+
 #define sys_trace_isr_exit_to_scheduler()
 
 #define sys_trace_thread_priority_set(thread)
@@ -34,7 +58,6 @@ void cpu_stats_reset_counters(void);
 #define sys_trace_thread_abort(thread)
 #define sys_trace_thread_suspend(thread)
 #define sys_trace_thread_resume(thread)
-#define sys_trace_thread_ready(thread)
 #define sys_trace_thread_pend(thread)
 
 #define sys_trace_void(id)
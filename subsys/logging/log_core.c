@@ -13,6 +13,8 @@
 #include <init.h>
 #include <assert.h>
 #include <atomic.h>
+#include <spinlock.h>
+#include <kernel_structs.h>
 
 #ifndef CONFIG_LOG_PRINTK_MAX_STRING_LENGTH
 #define CONFIG_LOG_PRINTK_MAX_STRING_LENGTH 1
@@ -51,7 +53,18 @@ struct k_mem_slab log_strdup_pool;
 static u8_t __noinit __aligned(sizeof(u32_t))
 		log_strdup_pool_buf[LOG_STRDUP_POOL_BUFFER_SIZE];
 
-static struct log_list_t list;
+/* Pending messages are kept in one list per CPU, so that producers on
+ * different CPUs never contend. A list lock is only shared between the
+ * producers of its CPU and log_process(), which merges the lists in
+ * timestamp order. Consumers are serialized by proc_lock.
+ */
+struct log_cpu_list {
+	struct k_spinlock lock;
+	struct log_list_t list;
+};
+
+static struct log_cpu_list cpu_lists[CONFIG_MP_NUM_CPUS];
+static struct k_spinlock proc_lock;
 static atomic_t initialized;
 static bool panic_mode;
 static bool backend_attached;
@@ -70,18 +83,27 @@ static u32_t dummy_timestamp(void)
 static inline void msg_finalize(struct log_msg *msg,
 				struct log_msg_ids src_level)
 {
-	unsigned int key;
+	struct log_cpu_list *cpu_list;
+	unsigned int irq_key;
+	k_spinlock_key_t key;
 
 	msg->hdr.ids = src_level;
-	msg->hdr.timestamp = timestamp_func();
 
 	atomic_inc(&buffered_cnt);
 
-	key = irq_lock();
+	/* Stay on this CPU until the message is in its list. irq_lock() is
+	 * a global lock on SMP, use the underlying arch implementation.
+	 */
+	irq_key = _arch_irq_lock();
+	cpu_list = &cpu_lists[_current_cpu->id];
+	key = k_spin_lock(&cpu_list->lock);
 
-	log_list_add_tail(&list, msg);
+	/* Timestamp under the lock, so that each list is in order */
+	msg->hdr.timestamp = timestamp_func();
+	log_list_add_tail(&cpu_list->list, msg);
 
-	irq_unlock(key);
+	k_spin_unlock(&cpu_list->lock, key);
+	_arch_irq_unlock(irq_key);
 
 	if (panic_mode) {
 		(void)log_process(false);
@@ -289,7 +311,9 @@ void log_core_init(void)
 {
 	if (!IS_ENABLED(CONFIG_LOG_IMMEDIATE)) {
 		log_msg_pool_init();
-		log_list_init(&list);
+		for (int i = 0; i < CONFIG_MP_NUM_CPUS; i++) {
+			log_list_init(&cpu_lists[i].list);
+		}
 
 		k_mem_slab_init(&log_strdup_pool, log_strdup_pool_buf,
 					sizeof(struct log_strdup_buf),
@@ -459,17 +483,67 @@ void dropped_notify(void)
 	}
 }
 
+/* Remove the oldest pending message of all CPUs. Must be called with
+ * proc_lock held: only consumers remove messages, so a head seen by this
+ * function stays in place until it takes it.
+ */
+static struct log_msg *oldest_msg_get(void)
+{
+	struct log_cpu_list *oldest = NULL;
+	struct log_msg *head;
+	u32_t oldest_ts = 0U;
+	k_spinlock_key_t key;
+
+	for (int i = 0; i < CONFIG_MP_NUM_CPUS; i++) {
+		key = k_spin_lock(&cpu_lists[i].lock);
+		head = log_list_head_peek(&cpu_lists[i].list);
+		k_spin_unlock(&cpu_lists[i].lock, key);
+
+		if (head == NULL) {
+			continue;
+		}
+
+		if ((oldest == NULL) ||
+		    ((s32_t)(head->hdr.timestamp - oldest_ts) < 0)) {
+			oldest = &cpu_lists[i];
+			oldest_ts = head->hdr.timestamp;
+		}
+	}
+
+	if (oldest == NULL) {
+		return NULL;
+	}
+
+	key = k_spin_lock(&oldest->lock);
+	head = log_list_head_get(&oldest->list);
+	k_spin_unlock(&oldest->lock, key);
+
+	return head;
+}
+
+static bool msg_pending(void)
+{
+	for (int i = 0; i < CONFIG_MP_NUM_CPUS; i++) {
+		if (log_list_head_peek(&cpu_lists[i].list) != NULL) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
 bool log_process(bool bypass)
 {
 	struct log_msg *msg;
+	k_spinlock_key_t key;
 
 	if (!backend_attached && !bypass) {
 		return false;
 	}
-	unsigned int key = irq_lock();
 
-	msg = log_list_head_get(&list);
-	irq_unlock(key);
+	key = k_spin_lock(&proc_lock);
+	msg = oldest_msg_get();
+	k_spin_unlock(&proc_lock, key);
 
 	if (msg != NULL) {
 		atomic_dec(&buffered_cnt);
@@ -480,7 +554,7 @@ bool log_process(bool bypass)
 		dropped_notify();
 	}
 
-	return (log_list_head_peek(&list) != NULL);
+	return msg_pending();
 }
 
 u32_t log_buffered_cnt(void)
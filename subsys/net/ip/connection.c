@@ -13,6 +13,7 @@ LOG_MODULE_REGISTER(net_conn, CONFIG_NET_CONN_LOG_LEVEL);
 
 #include <errno.h>
 #include <misc/util.h>
+#include <spinlock.h>
 
 #include <net/net_core.h>
 #include <net/net_pkt.h>
@@ -326,6 +327,124 @@ static inline void cache_remove(struct net_conn *conn)
 #define cache_remove(...)
 #endif /* CONFIG_NET_CONN_CACHE */
 
+#if defined(CONFIG_NET_CONN_HASH)
+
+/* Every connection handler is linked in exactly one of these lists:
+ *
+ * - conn_tuple_hash, when the protocol, local port, remote port and a
+ *   specific remote address are all set. Only a packet carrying that
+ *   exact tuple can match it.
+ * - conn_port_hash, for the other handlers with a local port, e.g.
+ *   listeners. Only a packet to that port can match it.
+ * - conn_wildcard otherwise.
+ *
+ * So the handlers an incoming packet may match are all found in one
+ * bucket of each table plus the wildcard list. They are then ranked in
+ * index order, like the linear scan does.
+ *
+ * The lists are changed by the threads registering and unregistering
+ * handlers while the RX thread walks them, so conn_lock is held for
+ * both. A handler is unlinked under the lock before it is cleared,
+ * so no walk can be on it any more by then.
+ */
+BUILD_ASSERT_MSG((CONFIG_NET_CONN_HASH_SIZE &
+		  (CONFIG_NET_CONN_HASH_SIZE - 1)) == 0,
+		 "NET_CONN_HASH_SIZE must be a power of two");
+
+static sys_slist_t conn_tuple_hash[CONFIG_NET_CONN_HASH_SIZE];
+static sys_slist_t conn_port_hash[CONFIG_NET_CONN_HASH_SIZE];
+static sys_slist_t conn_wildcard;
+static struct k_spinlock conn_lock;
+
+static inline u32_t hash_mix(u32_t hash, u32_t value)
+{
+	hash = (hash ^ value) * 0x9e3779b1U;
+
+	return hash ^ (hash >> 16);
+}
+
+static inline u32_t hash_bucket(u32_t hash)
+{
+	return hash & (CONFIG_NET_CONN_HASH_SIZE - 1);
+}
+
+/* Ports are in network byte order, as found in the packet */
+static u32_t port_hash(u16_t proto, u16_t local_port)
+{
+	return hash_bucket(hash_mix(proto, local_port));
+}
+
+static u32_t tuple_hash(u16_t proto, u16_t local_port, u16_t remote_port,
+			sa_family_t family, const void *remote_addr)
+{
+	const u8_t *addr = remote_addr;
+	u32_t hash;
+	int i, words;
+
+	hash = hash_mix(proto, ((u32_t)local_port << 16) | remote_port);
+
+	words = (family == AF_INET6) ? sizeof(struct in6_addr) / 4 :
+		sizeof(struct in_addr) / 4;
+	for (i = 0; i < words; i++) {
+		hash = hash_mix(hash, UNALIGNED_GET((u32_t *)addr + i));
+	}
+
+	return hash_bucket(hash);
+}
+
+static const void *conn_remote_addr(struct net_conn *conn)
+{
+	if (IS_ENABLED(CONFIG_NET_IPV6) &&
+	    conn->remote_addr.sa_family == AF_INET6) {
+		return &net_sin6(&conn->remote_addr)->sin6_addr;
+	}
+
+	return &net_sin(&conn->remote_addr)->sin_addr;
+}
+
+static sys_slist_t *conn_hash_list(struct net_conn *conn)
+{
+	u16_t local_port = net_sin(&conn->local_addr)->sin_port;
+	u8_t tuple = NET_RANK_LOCAL_PORT | NET_RANK_REMOTE_PORT |
+		NET_RANK_REMOTE_SPEC_ADDR;
+
+	if ((conn->rank & tuple) == tuple) {
+		return &conn_tuple_hash[tuple_hash(
+				conn->proto, local_port,
+				net_sin(&conn->remote_addr)->sin_port,
+				conn->remote_addr.sa_family,
+				conn_remote_addr(conn))];
+	}
+
+	if (conn->rank & NET_RANK_LOCAL_PORT) {
+		return &conn_port_hash[port_hash(conn->proto, local_port)];
+	}
+
+	return &conn_wildcard;
+}
+
+static void conn_hash_add(struct net_conn *conn)
+{
+	k_spinlock_key_t key = k_spin_lock(&conn_lock);
+
+	sys_slist_append(conn_hash_list(conn), &conn->node);
+
+	k_spin_unlock(&conn_lock, key);
+}
+
+static void conn_hash_remove(struct net_conn *conn)
+{
+	k_spinlock_key_t key = k_spin_lock(&conn_lock);
+
+	sys_slist_find_and_remove(conn_hash_list(conn), &conn->node);
+
+	k_spin_unlock(&conn_lock, key);
+}
+#else
+#define conn_hash_add(...)
+#define conn_hash_remove(...)
+#endif /* CONFIG_NET_CONN_HASH */
+
 int net_conn_unregister(struct net_conn_handle *handle)
 {
 	struct net_conn *conn = (struct net_conn *)handle;
@@ -339,6 +458,7 @@ int net_conn_unregister(struct net_conn_handle *handle)
 	}
 
 	cache_remove(conn);
+	conn_hash_remove(conn);
 
 	NET_DBG("[%zu] connection handler %p removed",
 		conn - conns, conn);
@@ -659,6 +779,8 @@ int net_conn_register(u16_t proto, u8_t family,
 		conns[i].proto = proto;
 		conns[i].family = family;
 
+		conn_hash_add(&conns[i]);
+
 		/* Cache needs to be cleared if new entries are added. */
 		cache_clear();
 
@@ -797,14 +919,172 @@ static bool is_invalid_packet(struct net_pkt *pkt,
 	return true;
 }
 
+/* Check if a connection handler accepts the packet */
+static bool conn_match(struct net_conn *conn,
+		       struct net_pkt *pkt,
+		       union net_ip_header *ip_hdr,
+		       u8_t proto,
+		       u16_t src_port,
+		       u16_t dst_port)
+{
+	if (!(conn->flags & NET_CONN_IN_USE)) {
+		return false;
+	}
+
+	if (conn->proto != proto) {
+		return false;
+	}
+
+	if (conn->family != AF_UNSPEC &&
+	    conn->family != net_pkt_family(pkt)) {
+		return false;
+	}
+
+	if (IS_ENABLED(CONFIG_NET_UDP) || IS_ENABLED(CONFIG_NET_TCP)) {
+		if (net_sin(&conn->remote_addr)->sin_port) {
+			if (net_sin(&conn->remote_addr)->sin_port !=
+			    src_port) {
+				return false;
+			}
+		}
+
+		if (net_sin(&conn->local_addr)->sin_port) {
+			if (net_sin(&conn->local_addr)->sin_port !=
+			    dst_port) {
+				return false;
+			}
+		}
+
+		if (conn->flags & NET_CONN_REMOTE_ADDR_SET) {
+			if (!check_addr(pkt, ip_hdr, &conn->remote_addr,
+					true)) {
+				return false;
+			}
+		}
+
+		if (conn->flags & NET_CONN_LOCAL_ADDR_SET) {
+			if (!check_addr(pkt, ip_hdr, &conn->local_addr,
+					false)) {
+				return false;
+			}
+		}
+	}
+
+	return true;
+}
+
+/* Update the best match with the matching handler at index i. Handlers
+ * must be passed in index order.
+ */
+static void conn_rank(int i, int *best_match, s16_t *best_rank)
+{
+	if (IS_ENABLED(CONFIG_NET_UDP) || IS_ENABLED(CONFIG_NET_TCP)) {
+		/* If we have an existing best_match, and that one
+		 * specifies a remote port, then we've matched to a
+		 * LISTENING connection that should not override.
+		 */
+		if (*best_match >= 0 &&
+		    net_sin(&conns[*best_match].remote_addr)->sin_port) {
+			return;
+		}
+
+		if (*best_rank < conns[i].rank) {
+			*best_rank = conns[i].rank;
+			*best_match = i;
+		}
+	} else if (IS_ENABLED(CONFIG_NET_SOCKETS_PACKET)) {
+		*best_rank = 0;
+		*best_match = i;
+	} else if (IS_ENABLED(CONFIG_NET_SOCKETS_CAN)) {
+		*best_rank = 0;
+		*best_match = i;
+	}
+}
+
+#if defined(CONFIG_NET_CONN_HASH)
+static void conn_list_match(sys_slist_t *list, u32_t *matches,
+			    struct net_pkt *pkt,
+			    union net_ip_header *ip_hdr,
+			    u8_t proto,
+			    u16_t src_port,
+			    u16_t dst_port)
+{
+	struct net_conn *conn;
+
+	SYS_SLIST_FOR_EACH_CONTAINER(list, conn, node) {
+		if (conn_match(conn, pkt, ip_hdr, proto, src_port, dst_port)) {
+			int i = conn - conns;
+
+			matches[i / 32] |= BIT(i % 32);
+		}
+	}
+}
+
+/* Return the index of the best handler for the packet, or -1 */
+static int conn_hash_lookup(struct net_pkt *pkt,
+			    union net_ip_header *ip_hdr,
+			    u8_t proto,
+			    u16_t src_port,
+			    u16_t dst_port)
+{
+	u32_t matches[(CONFIG_NET_MAX_CONN + 31) / 32] = { 0 };
+	int best_match = -1;
+	s16_t best_rank = -1;
+	const void *src = NULL;
+	k_spinlock_key_t key;
+	int i;
+
+	if (IS_ENABLED(CONFIG_NET_IPV4) && net_pkt_family(pkt) == AF_INET) {
+		src = &ip_hdr->ipv4->src;
+	} else if (IS_ENABLED(CONFIG_NET_IPV6) &&
+		   net_pkt_family(pkt) == AF_INET6) {
+		src = &ip_hdr->ipv6->src;
+	}
+
+	key = k_spin_lock(&conn_lock);
+
+	if (src != NULL) {
+		conn_list_match(&conn_tuple_hash[tuple_hash(
+					proto, dst_port, src_port,
+					net_pkt_family(pkt), src)],
+				matches, pkt, ip_hdr, proto,
+				src_port, dst_port);
+	}
+
+	conn_list_match(&conn_port_hash[port_hash(proto, dst_port)],
+			matches, pkt, ip_hdr, proto, src_port, dst_port);
+	conn_list_match(&conn_wildcard, matches, pkt, ip_hdr, proto,
+			src_port, dst_port);
+
+	k_spin_unlock(&conn_lock, key);
+
+	/* Rank the candidates in index order, as the linear scan does */
+	for (i = 0; i < ARRAY_SIZE(matches); i++) {
+		u32_t word = matches[i];
+
+		while (word) {
+			int bit = find_lsb_set(word) - 1;
+
+			word &= ~BIT(bit);
+			conn_rank(i * 32 + bit, &best_match, &best_rank);
+		}
+	}
+
+	return best_match;
+}
+#endif /* CONFIG_NET_CONN_HASH */
+
 enum net_verdict net_conn_input(struct net_pkt *pkt,
 				union net_ip_header *ip_hdr,
 				u8_t proto,
 				union net_proto_header *proto_hdr)
 {
 	struct net_if *pkt_iface = net_pkt_iface(pkt);
-	int i, best_match = -1;
+	int best_match = -1;
+#if !defined(CONFIG_NET_CONN_HASH)
 	s16_t best_rank = -1;
+	int i;
+#endif
 	u16_t src_port;
 	u16_t dst_port;
 #if defined(CONFIG_NET_CONN_CACHE)
@@ -859,73 +1139,16 @@ enum net_verdict net_conn_input(struct net_pkt *pkt,
 		" family %d", net_proto2str(net_pkt_family(pkt), proto), pkt,
 		ntohs(src_port), ntohs(dst_port), net_pkt_family(pkt));
 
+#if defined(CONFIG_NET_CONN_HASH)
+	best_match = conn_hash_lookup(pkt, ip_hdr, proto, src_port, dst_port);
+#else
 	for (i = 0; i < CONFIG_NET_MAX_CONN; i++) {
-		if (!(conns[i].flags & NET_CONN_IN_USE)) {
-			continue;
-		}
-
-		if (conns[i].proto != proto) {
-			continue;
-		}
-
-		if (conns[i].family != AF_UNSPEC &&
-		    conns[i].family != net_pkt_family(pkt)) {
-			continue;
-		}
-
-		if (IS_ENABLED(CONFIG_NET_UDP) ||
-		    IS_ENABLED(CONFIG_NET_TCP)) {
-			if (net_sin(&conns[i].remote_addr)->sin_port) {
-				if (net_sin(&conns[i].remote_addr)->sin_port !=
-				    src_port) {
-					continue;
-				}
-			}
-
-			if (net_sin(&conns[i].local_addr)->sin_port) {
-				if (net_sin(&conns[i].local_addr)->sin_port !=
-				    dst_port) {
-					continue;
-				}
-			}
-
-			if (conns[i].flags & NET_CONN_REMOTE_ADDR_SET) {
-				if (!check_addr(pkt, ip_hdr,
-						&conns[i].remote_addr,
-						true)) {
-					continue;
-				}
-			}
-
-			if (conns[i].flags & NET_CONN_LOCAL_ADDR_SET) {
-				if (!check_addr(pkt, ip_hdr,
-						&conns[i].local_addr,
-						false)) {
-					continue;
-				}
-			}
-
-			/* If we have an existing best_match, and that one
-			 * specifies a remote port, then we've matched to a
-			 * LISTENING connection that should not override.
-			 */
-			if (best_match >= 0 &&
-			    net_sin(&conns[best_match].remote_addr)->sin_port) {
-				continue;
-			}
-
-			if (best_rank < conns[i].rank) {
-				best_rank = conns[i].rank;
-				best_match = i;
-			}
-		} else if (IS_ENABLED(CONFIG_NET_SOCKETS_PACKET)) {
-			best_rank = 0;
-			best_match = i;
-		} else if (IS_ENABLED(CONFIG_NET_SOCKETS_CAN)) {
-			best_rank = 0;
-			best_match = i;
+		if (conn_match(&conns[i], pkt, ip_hdr, proto,
+			       src_port, dst_port)) {
+			conn_rank(i, &best_match, &best_rank);
 		}
 	}
+#endif
 
 	if (best_match >= 0) {
 #if defined(CONFIG_NET_CONN_CACHE)
@@ -1458,10 +1458,35 @@ int net_context_sendto(struct net_pkt *pkt,
 	return ret;
 }
 
+static int context_write_data(struct net_pkt *pkt, const void *buf,
+			      size_t buf_len, const struct msghdr *msghdr)
+{
+	size_t i;
+	int ret;
+
+	if (!msghdr) {
+		return net_pkt_write_new(pkt, buf, buf_len);
+	}
+
+	for (i = 0; i < msghdr->msg_iovlen && buf_len; i++) {
+		size_t len = MIN(msghdr->msg_iov[i].iov_len, buf_len);
+
+		ret = net_pkt_write_new(pkt, msghdr->msg_iov[i].iov_base, len);
+		if (ret < 0) {
+			return ret;
+		}
+
+		buf_len -= len;
+	}
+
+	return 0;
+}
+
 static int context_setup_udp_packet(struct net_context *context,
 				    struct net_pkt *pkt,
 				    const void *buf,
 				    size_t len,
+				    const struct msghdr *msghdr,
 				    const struct sockaddr *dst_addr,
 				    socklen_t addrlen)
 {
@@ -1503,7 +1528,7 @@ static int context_setup_udp_packet(struct net_context *context,
 		return ret;
 	}
 
-	ret = net_pkt_write_new(pkt, buf, len);
+	ret = context_write_data(pkt, buf, len, msghdr);
 	if (ret) {
 		return ret;
 	}
@@ -1529,9 +1554,68 @@ static void context_finalize_packet(struct net_context *context,
 	}
 }
 
+static struct net_pkt *context_alloc_pkt(struct net_context *context,
+					 size_t len, struct net_buf *frags)
+{
+	struct net_if *iface = net_context_get_iface(context);
+	struct net_pkt *pkt;
+
+	if (!frags) {
+		return net_pkt_alloc_with_buffer(iface, len,
+					net_context_get_family(context),
+					net_context_get_ip_proto(context),
+					PKT_WAIT_TIME);
+	}
+
+	/* The payload is already there, TCP allocates its own header
+	 * buffer when the segment is prepared and UDP only needs room
+	 * for the headers.
+	 */
+	if (IS_ENABLED(CONFIG_NET_TCP) &&
+	    net_context_get_ip_proto(context) == IPPROTO_TCP) {
+		pkt = net_pkt_alloc_on_iface(iface, PKT_WAIT_TIME);
+		if (pkt) {
+			net_pkt_set_family(pkt,
+					   net_context_get_family(context));
+		}
+
+		return pkt;
+	}
+
+	return net_pkt_alloc_with_buffer(iface, 0,
+					 net_context_get_family(context),
+					 net_context_get_ip_proto(context),
+					 PKT_WAIT_TIME);
+}
+
+static bool context_frags_fit(struct net_context *context,
+			      struct net_pkt *pkt, size_t len)
+{
+	size_t max_len = net_if_get_mtu(net_pkt_iface(pkt));
+
+#if defined(CONFIG_NET_TCP)
+	if (net_context_get_ip_proto(context) == IPPROTO_TCP) {
+		return len <= context->tcp->send_mss;
+	}
+#endif /* CONFIG_NET_TCP */
+
+	if (IS_ENABLED(CONFIG_NET_IPV6) &&
+	    net_context_get_family(context) == AF_INET6) {
+		max_len = MAX(max_len, NET_IPV6_MTU);
+	} else if (IS_ENABLED(CONFIG_NET_IPV4) &&
+		   net_context_get_family(context) == AF_INET) {
+		max_len = MAX(max_len, NET_IPV4_MTU);
+	}
+
+	/* Headers have been written by now */
+	return net_pkt_get_len(pkt) + len <= max_len;
+}
+
 static int context_sendto_new(struct net_context *context,
 			      const void *buf,
 			      size_t len,
+			      struct net_buf *frags,
+			      const struct msghdr *msghdr,
 			      const struct sockaddr *dst_addr,
 			      socklen_t addrlen,
 			      net_context_send_cb_t cb,
@@ -1627,18 +1711,28 @@ static int context_sendto_new(struct net_context *context,
 		return -EINVAL;
 	}
 
-	pkt = net_pkt_alloc_with_buffer(net_context_get_iface(context), len,
-					net_context_get_family(context),
-					net_context_get_ip_proto(context),
-					PKT_WAIT_TIME);
+	if (frags) {
+		if (net_context_get_ip_proto(context) != IPPROTO_UDP &&
+		    net_context_get_ip_proto(context) != IPPROTO_TCP) {
+			return -EOPNOTSUPP;
+		}
+
+		len = net_buf_frags_len(frags);
+	} else if (msghdr) {
+		len = net_msghdr_len(msghdr);
+	}
+
+	pkt = context_alloc_pkt(context, len, frags);
 	if (!pkt) {
 		return -ENOMEM;
 	}
 
-	tmp_len = net_pkt_available_payload_buffer(
+	if (!frags) {
+		tmp_len = net_pkt_available_payload_buffer(
 				pkt, net_context_get_ip_proto(context));
-	if (tmp_len < len) {
-		len = tmp_len;
+		if (tmp_len < len) {
+			len = tmp_len;
+		}
 	}
 
 	net_pkt_set_context(pkt, context);
@@ -1648,20 +1742,39 @@ static int context_sendto_new(struct net_context *context,
 
 	if (IS_ENABLED(CONFIG_NET_UDP) &&
 	    net_context_get_ip_proto(context) == IPPROTO_UDP) {
-		ret = context_setup_udp_packet(context, pkt, buf, len,
+		ret = context_setup_udp_packet(context, pkt, buf,
+					       frags ? 0 : len, msghdr,
 					       dst_addr, addrlen);
 		if (ret < 0) {
 			goto fail;
 		}
 
+		if (frags) {
+			if (!context_frags_fit(context, pkt, len)) {
+				ret = -EMSGSIZE;
+				goto fail;
+			}
+
+			net_pkt_append_buffer(pkt, net_buf_ref(frags));
+		}
+
 		context_finalize_packet(context, pkt);
 
 		ret = net_send_data(pkt);
 	} else if (IS_ENABLED(CONFIG_NET_TCP) &&
 		   net_context_get_ip_proto(context) == IPPROTO_TCP) {
-		ret = net_pkt_write_new(pkt, buf, len);
-		if (ret < 0) {
-			goto fail;
+		if (frags) {
+			if (!context_frags_fit(context, pkt, len)) {
+				ret = -EMSGSIZE;
+				goto fail;
+			}
+
+			net_pkt_append_buffer(pkt, net_buf_ref(frags));
+		} else {
+			ret = context_write_data(pkt, buf, len, msghdr);
+			if (ret < 0) {
+				goto fail;
+			}
 		}
 
 		net_pkt_cursor_init(pkt);
@@ -1673,7 +1786,7 @@ static int context_sendto_new(struct net_context *context,
 		ret = net_tcp_send_data(context, cb, token, user_data);
 	} else if (IS_ENABLED(CONFIG_NET_SOCKETS_PACKET) &&
 		   net_context_get_family(context) == AF_PACKET) {
-		ret = net_pkt_write_new(pkt, buf, len);
+		ret = context_write_data(pkt, buf, len, msghdr);
 		if (ret < 0) {
 			goto fail;
 		}
@@ -1684,7 +1797,7 @@ static int context_sendto_new(struct net_context *context,
 	} else if (IS_ENABLED(CONFIG_NET_SOCKETS_CAN) &&
 		   net_context_get_family(context) == AF_CAN &&
 		   net_context_get_ip_proto(context) == CAN_RAW) {
-		ret = net_pkt_write_new(pkt, buf, len);
+		ret = context_write_data(pkt, buf, len, msghdr);
 		if (ret < 0) {
 			goto fail;
 		}
@@ -1702,24 +1815,42 @@ static int context_sendto_new(struct net_context *context,
 		goto fail;
 	}
 
+	if (frags) {
+		/* The packet holds its own reference now, drop the one
+		 * handed over by the caller.
+		 */
+		net_buf_unref(frags);
+	}
+
 	return len;
 fail:
+	/* Releases only our reference to frags, the caller keeps it */
 	net_pkt_unref(pkt);
 
 	return ret;
 }
 
-int net_context_send_new(struct net_context *context,
-			 const void *buf,
-			 size_t len,
-			 net_context_send_cb_t cb,
-			 s32_t timeout,
-			 void *token,
-			 void *user_data)
+static int context_send(struct net_context *context,
+			const void *buf,
+			size_t len,
+			struct net_buf *frags,
+			const struct msghdr *msghdr,
+			net_context_send_cb_t cb,
+			s32_t timeout,
+			void *token,
+			void *user_data)
 {
 	socklen_t addrlen;
 	int ret = 0;
 
+	/* Wait without the lock, the ACKs that free space need it */
+	if (net_context_get_ip_proto(context) == IPPROTO_TCP) {
+		ret = net_tcp_wait_send_space(context, timeout);
+		if (ret < 0) {
+			return ret;
+		}
+	}
+
 	k_mutex_lock(&context->lock, K_FOREVER);
 
 	if (!(context->flags & NET_CONTEXT_REMOTE_ADDR_SET) ||
@@ -1745,14 +1876,72 @@ int net_context_send_new(struct net_context *context,
 		addrlen = 0;
 	}
 
-	ret = context_sendto_new(context, buf, len, &context->remote,
-				 addrlen, cb, timeout, token, user_data);
+	ret = context_sendto_new(context, buf, len, frags, msghdr,
+				 &context->remote, addrlen, cb, timeout, token,
+				 user_data);
 unlock:
 	k_mutex_unlock(&context->lock);
 
 	return ret;
 }
 
+int net_context_send_new(struct net_context *context,
+			 const void *buf,
+			 size_t len,
+			 net_context_send_cb_t cb,
+			 s32_t timeout,
+			 void *token,
+			 void *user_data)
+{
+	return context_send(context, buf, len, NULL, NULL, cb, timeout, token,
+			    user_data);
+}
+
+int net_context_send_buf(struct net_context *context,
+			 struct net_buf *frags,
+			 net_context_send_cb_t cb,
+			 s32_t timeout,
+			 void *token,
+			 void *user_data)
+{
+	if (!frags) {
+		return -EINVAL;
+	}
+
+	return context_send(context, NULL, 0, frags, NULL, cb, timeout, token,
+			    user_data);
+}
+
+static int context_sendto(struct net_context *context,
+			  const void *buf,
+			  size_t len,
+			  struct net_buf *frags,
+			  const struct msghdr *msghdr,
+			  const struct sockaddr *dst_addr,
+			  socklen_t addrlen,
+			  net_context_send_cb_t cb,
+			  s32_t timeout,
+			  void *token,
+			  void *user_data)
+{
+	int ret;
+
+	if (net_context_get_ip_proto(context) == IPPROTO_TCP) {
+		ret = net_tcp_wait_send_space(context, timeout);
+		if (ret < 0) {
+			return ret;
+		}
+	}
+
+	k_mutex_lock(&context->lock, K_FOREVER);
+
+	ret = context_sendto_new(context, buf, len, frags, msghdr, dst_addr,
+				 addrlen, cb, timeout, token, user_data);
+
+	k_mutex_unlock(&context->lock);
+
+	return ret;
+}
 
 int net_context_sendto_new(struct net_context *context,
 			   const void *buf,
@@ -1764,16 +1953,46 @@ int net_context_sendto_new(struct net_context *context,
 			   void *token,
 			   void *user_data)
 {
-	int ret;
+	return context_sendto(context, buf, len, NULL, NULL, dst_addr, addrlen,
+			      cb, timeout, token, user_data);
+}
 
-	k_mutex_lock(&context->lock, K_FOREVER);
+int net_context_sendto_buf(struct net_context *context,
+			   struct net_buf *frags,
+			   const struct sockaddr *dst_addr,
+			   socklen_t addrlen,
+			   net_context_send_cb_t cb,
+			   s32_t timeout,
+			   void *token,
+			   void *user_data)
+{
+	if (!frags) {
+		return -EINVAL;
+	}
 
-	ret = context_sendto_new(context, buf, len, dst_addr, addrlen,
-				 cb, timeout, token, user_data);
+	return context_sendto(context, NULL, 0, frags, NULL, dst_addr, addrlen,
+			      cb, timeout, token, user_data);
+}
 
-	k_mutex_unlock(&context->lock);
+int net_context_sendmsg(struct net_context *context,
+			const struct msghdr *msghdr,
+			net_context_send_cb_t cb,
+			s32_t timeout,
+			void *token,
+			void *user_data)
+{
+	if (!msghdr) {
+		return -EINVAL;
+	}
 
-	return ret;
+	if (msghdr->msg_name) {
+		return context_sendto(context, NULL, 0, NULL, msghdr,
+				      msghdr->msg_name, msghdr->msg_namelen,
+				      cb, timeout, token, user_data);
+	}
+
+	return context_send(context, NULL, 0, NULL, msghdr, cb, timeout,
+			    token, user_data);
 }
 
 enum net_verdict net_context_packet_received(struct net_conn *conn,
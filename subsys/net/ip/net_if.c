@@ -182,6 +182,7 @@ static bool net_if_tx(struct net_if *iface, struct net_pkt *pkt)
 		if (IS_ENABLED(CONFIG_NET_TCP)
 		    && net_pkt_family(pkt) != AF_UNSPEC) {
 			net_pkt_set_sent(pkt, false);
+			net_pkt_set_queued(pkt, false);
 		}
 
 		net_pkt_unref(pkt);
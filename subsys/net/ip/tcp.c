@@ -52,6 +52,9 @@ static struct tcp_backlog_entry {
 	struct k_delayed_work ack_timer;
 	struct sockaddr remote;
 	u16_t send_mss;
+	u8_t send_wscale;
+	u8_t wscale_ok : 1;
+	u8_t sack_permitted : 1;
 } tcp_backlog[CONFIG_NET_TCP_BACKLOG_SIZE];
 
 #if defined(CONFIG_NET_TCP_ACK_TIMEOUT)
@@ -62,6 +65,15 @@ static struct tcp_backlog_entry {
 
 #define FIN_TIMEOUT K_SECONDS(1)
 
+/* Upper bound of the retransmission timeout, RFC 6298 2.5 */
+#define MAX_RTO K_SECONDS(60)
+
+/* Clock granularity G of RFC 6298 */
+#define RTT_GRANULARITY ((u32_t)MAX(__ticks_to_ms(1), 1))
+
+/* Number of duplicate ACKs that trigger a fast retransmit */
+#define DUP_ACK_THRESHOLD 3
+
 /* Declares a wrapper function for a net_conn callback that refs the
  * context around the invocation (to protect it from premature
  * deletion).  Long term would be nice to see this feature be part of
@@ -163,10 +175,242 @@ static void net_tcp_trace(struct net_pkt *pkt,
 
 static inline u32_t retry_timeout(const struct net_tcp *tcp)
 {
-	return ((u32_t)1 << tcp->retry_timeout_shift) *
-				CONFIG_NET_TCP_INIT_RETRANSMISSION_TIMEOUT;
+	return tcp->rto << tcp->retry_timeout_shift;
+}
+
+/* RFC 6298 2.2 and 2.3. srtt and rttvar are kept scaled by 8 and 4, so
+ * that the gains of 1/8 and 1/4 are plain shifts.
+ */
+static void tcp_rtt_update(struct net_tcp *tcp, u32_t rtt)
+{
+	s32_t delta;
+
+	if (tcp->srtt == 0U) {
+		tcp->srtt = rtt << 3;
+		tcp->rttvar = rtt << 1;
+	} else {
+		delta = (s32_t)rtt - (s32_t)(tcp->srtt >> 3);
+		tcp->srtt += delta;
+
+		if (delta < 0) {
+			delta = -delta;
+		}
+
+		delta -= tcp->rttvar >> 2;
+		tcp->rttvar += delta;
+	}
+
+	tcp->rto = (tcp->srtt >> 3) + MAX(RTT_GRANULARITY, tcp->rttvar);
+	tcp->rto = MAX(tcp->rto, CONFIG_NET_TCP_MIN_RETRANSMISSION_TIMEOUT);
+	tcp->rto = MIN(tcp->rto, MAX_RTO);
+
+	NET_DBG("[%p] rtt %u srtt %u rttvar %u rto %u", tcp, rtt,
+		tcp->srtt >> 3, tcp->rttvar >> 2, tcp->rto);
+}
+
+/* Initial window, RFC 5681 3.1 */
+static u32_t tcp_initial_cwnd(u16_t mss)
+{
+	if (mss > 2190) {
+		return 2 * mss;
+	} else if (mss > 1095) {
+		return 3 * mss;
+	}
+
+	return 4 * mss;
+}
+
+/* Smallest shift that lets the receive window fit the window field */
+static u8_t tcp_recv_wscale(void)
+{
+	u8_t shift = 0U;
+
+	while (shift < NET_TCP_MAX_WINDOW_SHIFT &&
+	       (NET_TCP_BUF_MAX_LEN >> shift) > UINT16_MAX) {
+		shift++;
+	}
+
+	return shift;
+}
+
+static inline u32_t tcp_flight_size(const struct net_tcp *tcp)
+{
+	return tcp->send_max - tcp->send_una;
+}
+
+/* Apply the options of the SYN or SYN-ACK sent by the peer */
+static void tcp_set_peer_opts(struct net_tcp *tcp,
+			      const struct net_tcp_options *opts)
+{
+	if (opts->mss) {
+		tcp->send_mss = opts->mss;
+	}
+
+	if (IS_ENABLED(CONFIG_NET_TCP_WINDOW_SCALE) && opts->wscale_ok) {
+		tcp->flags |= NET_TCP_WSCALE;
+		tcp->send_wscale = opts->wscale;
+		tcp->recv_wscale = tcp_recv_wscale();
+	}
+
+	if (IS_ENABLED(CONFIG_NET_TCP_SACK) && opts->sack_permitted) {
+		tcp->flags |= NET_TCP_SACK_PERMITTED;
+	}
+}
+
+/* Start sending on an established connection, once the MSS and the
+ * window of the peer are known.  wnd is the window field of the peer's
+ * segment, to be shifted by wscale.
+ */
+static void tcp_send_init(struct net_tcp *tcp, u16_t wnd, u8_t wscale)
+{
+	tcp->send_una = tcp->send_seq;
+	tcp->send_max = tcp->send_seq;
+	tcp->recover = tcp->send_seq - 1;
+	tcp->high_rxt = tcp->send_seq;
+	tcp->send_wnd = (u32_t)wnd << wscale;
+	tcp->peer_wnd = wnd;
+	tcp->cwnd = tcp_initial_cwnd(tcp->send_mss);
+	tcp->ssthresh = UINT32_MAX;
+}
+
+#if defined(CONFIG_NET_TCP_SACK)
+static void tcp_sack_reset(struct net_tcp *tcp)
+{
+	tcp->sack_count = 0U;
 }
 
+/* Add a block to the scoreboard, merging it with the blocks it overlaps
+ * or touches. When the scoreboard is full the lowest block is dropped.
+ */
+static void tcp_sack_add(struct net_tcp *tcp, u32_t left, u32_t right)
+{
+	struct net_tcp_sack_block *blk;
+	int i, lowest;
+
+	for (i = 0; i < tcp->sack_count; ) {
+		blk = &tcp->sack[i];
+
+		if (net_tcp_seq_greater(left, blk->right) ||
+		    net_tcp_seq_greater(blk->left, right)) {
+			i++;
+			continue;
+		}
+
+		if (net_tcp_seq_greater(left, blk->left)) {
+			left = blk->left;
+		}
+
+		if (net_tcp_seq_greater(blk->right, right)) {
+			right = blk->right;
+		}
+
+		tcp->sack[i] = tcp->sack[--tcp->sack_count];
+	}
+
+	if (tcp->sack_count == NET_TCP_MAX_SACK_BLOCKS) {
+		lowest = 0;
+
+		for (i = 1; i < tcp->sack_count; i++) {
+			if (net_tcp_seq_greater(tcp->sack[lowest].left,
+						tcp->sack[i].left)) {
+				lowest = i;
+			}
+		}
+
+		if (net_tcp_seq_greater(tcp->sack[lowest].left, left)) {
+			return;
+		}
+
+		tcp->sack[lowest] = tcp->sack[--tcp->sack_count];
+	}
+
+	tcp->sack[tcp->sack_count].left = left;
+	tcp->sack[tcp->sack_count].right = right;
+	tcp->sack_count++;
+}
+
+static void tcp_sack_update(struct net_tcp *tcp,
+			    const struct net_tcp_options *opts)
+{
+	const struct net_tcp_sack_block *blk;
+	int i;
+
+	if (!(tcp->flags & NET_TCP_SACK_PERMITTED)) {
+		return;
+	}
+
+	for (i = 0; i < opts->sack_count; i++) {
+		blk = &opts->sack[i];
+
+		/* Ignore blocks that are stale or cover unsent data */
+		if (!net_tcp_seq_greater(blk->right, blk->left) ||
+		    !net_tcp_seq_greater(blk->right, tcp->send_una) ||
+		    net_tcp_seq_greater(blk->right, tcp->send_max)) {
+			continue;
+		}
+
+		tcp_sack_add(tcp, blk->left, blk->right);
+	}
+}
+
+/* Forget what the cumulative acknowledgment now covers */
+static void tcp_sack_prune(struct net_tcp *tcp)
+{
+	struct net_tcp_sack_block *blk;
+	int i;
+
+	for (i = 0; i < tcp->sack_count; ) {
+		blk = &tcp->sack[i];
+
+		if (!net_tcp_seq_greater(blk->right, tcp->send_una)) {
+			tcp->sack[i] = tcp->sack[--tcp->sack_count];
+			continue;
+		}
+
+		if (net_tcp_seq_greater(tcp->send_una, blk->left)) {
+			blk->left = tcp->send_una;
+		}
+
+		i++;
+	}
+}
+
+static bool tcp_sacked(const struct net_tcp *tcp, u32_t seq, u32_t end)
+{
+	int i;
+
+	for (i = 0; i < tcp->sack_count; i++) {
+		if (!net_tcp_seq_greater(tcp->sack[i].left, seq) &&
+		    !net_tcp_seq_greater(end, tcp->sack[i].right)) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
+/* End of the highest data SACKed by the peer, send_una if none */
+static u32_t tcp_sack_highest(const struct net_tcp *tcp)
+{
+	u32_t highest = tcp->send_una;
+	int i;
+
+	for (i = 0; i < tcp->sack_count; i++) {
+		if (net_tcp_seq_greater(tcp->sack[i].right, highest)) {
+			highest = tcp->sack[i].right;
+		}
+	}
+
+	return highest;
+}
+#else
+#define tcp_sack_reset(...)
+#define tcp_sack_update(...)
+#define tcp_sack_prune(...)
+#define tcp_sacked(...) false
+#define tcp_sack_highest(tcp) ((tcp)->send_una)
+#endif /* CONFIG_NET_TCP_SACK */
+
 #define is_6lo_technology(pkt)						\
 	(IS_ENABLED(CONFIG_NET_IPV6) &&	net_pkt_family(pkt) == AF_INET6 &&  \
 	 ((IS_ENABLED(CONFIG_NET_L2_BT) &&				\
@@ -208,20 +452,350 @@ static void abort_connection(struct net_tcp *tcp)
 	net_context_unref(ctx);
 }
 
+/* A packet of the sent list handed to the interface stays queued until
+ * the driver has sent it. It must not be handed over again meanwhile.
+ */
+static inline bool sent_pkt_in_tx_queue(struct net_pkt *pkt)
+{
+	return net_pkt_queued(pkt) && !net_pkt_sent(pkt) &&
+		!is_6lo_technology(pkt);
+}
+
+static inline bool sent_pkt_transmitted(struct net_pkt *pkt)
+{
+	return net_pkt_queued(pkt) || net_pkt_sent(pkt);
+}
+
+/* Get the TCP header of a packet of the sent list, and the amount of
+ * sequence space it uses.
+ */
+static struct net_tcp_hdr *sent_pkt_hdr(struct net_pkt *pkt,
+					struct net_pkt_data_access *tcp_access,
+					u32_t *seq_len)
+{
+	struct net_tcp_hdr *tcp_hdr;
+
+	net_pkt_cursor_init(pkt);
+	net_pkt_set_overwrite(pkt, true);
+
+	if (net_pkt_skip(pkt, net_pkt_ip_hdr_len(pkt) +
+			 net_pkt_ipv6_ext_len(pkt))) {
+		return NULL;
+	}
+
+	tcp_hdr = (struct net_tcp_hdr *)net_pkt_get_data_new(pkt, tcp_access);
+	if (!tcp_hdr) {
+		return NULL;
+	}
+
+	*seq_len = net_pkt_appdatalen(pkt);
+
+	/* Each of SYN and FIN flags are counted
+	 * as one sequence number.
+	 */
+	if (tcp_hdr->flags & NET_TCP_SYN) {
+		*seq_len += 1U;
+	}
+	if (tcp_hdr->flags & NET_TCP_FIN) {
+		*seq_len += 1U;
+	}
+
+	return tcp_hdr;
+}
+
+/* Hand a packet of the sent list over to the interface. The reference
+ * taken here is released by the driver once the packet is sent, the
+ * sent list keeps its own.
+ */
+static int tcp_xmit(struct net_tcp *tcp, struct net_pkt *pkt)
+{
+	int ret;
+
+	do_ref_if_needed(tcp, pkt);
+	net_pkt_set_sent(pkt, false);
+	net_pkt_set_queued(pkt, true);
+
+	NET_DBG("[%p] Sending pkt %p (%zd bytes)", tcp, pkt,
+		net_pkt_get_len(pkt));
+
+	ret = net_tcp_send_pkt(pkt);
+	if (ret < 0) {
+		NET_DBG("[%p] pkt %p not sent (%d)", tcp, pkt, ret);
+
+		if (!is_6lo_technology(pkt)) {
+			net_pkt_unref(pkt);
+		}
+
+		net_pkt_set_queued(pkt, false);
+	}
+
+	return ret;
+}
+
+static void tcp_retransmit(struct net_tcp *tcp, struct net_pkt *pkt)
+{
+	/* Karn's algorithm: an acknowledgment of retransmitted data is
+	 * ambiguous, so it gives no round-trip time sample.
+	 */
+	tcp->flags &= ~NET_TCP_RTT_PENDING;
+
+	if (tcp_xmit(tcp, pkt) < 0) {
+		return;
+	}
+
+	NET_DBG("retry %u: [%p] sent pkt %p", tcp->retry_timeout_shift,
+		tcp, pkt);
+
+	if (IS_ENABLED(CONFIG_NET_STATISTICS_TCP) &&
+	    !is_6lo_technology(pkt)) {
+		net_stats_update_tcp_seg_rexmit(net_pkt_iface(pkt));
+	}
+}
+
+/* Send the queued data that fits in both the congestion window and the
+ * send window. The first unacknowledged segment is always allowed out,
+ * so that a zero window gets probed by the retransmission timer.
+ */
+static void tcp_send_queued(struct net_tcp *tcp)
+{
+	u32_t wnd = MIN(tcp->cwnd, tcp->send_wnd);
+	struct net_pkt *pkt;
+
+	SYS_SLIST_FOR_EACH_CONTAINER(&tcp->sent_list, pkt, sent_list) {
+		NET_PKT_DATA_ACCESS_DEFINE(tcp_access, struct net_tcp_hdr);
+		struct net_tcp_hdr *tcp_hdr;
+		u32_t seq, end, seq_len;
+
+		if (sent_pkt_transmitted(pkt)) {
+			continue;
+		}
+
+		tcp_hdr = sent_pkt_hdr(pkt, &tcp_access, &seq_len);
+		if (!tcp_hdr) {
+			continue;
+		}
+
+		seq = sys_get_be32(tcp_hdr->seq);
+		end = seq + seq_len;
+
+		if (seq != tcp->send_una && end - tcp->send_una > wnd) {
+			break;
+		}
+
+		if (!net_tcp_seq_greater(end, tcp->send_max)) {
+			/* Sent before a retransmission timeout */
+			tcp_retransmit(tcp, pkt);
+			continue;
+		}
+
+		if (!(tcp->flags & NET_TCP_RTT_PENDING)) {
+			tcp->flags |= NET_TCP_RTT_PENDING;
+			tcp->rtt_seq = end;
+			tcp->rtt_start = k_uptime_get_32();
+		}
+
+		tcp->send_max = end;
+
+		(void)tcp_xmit(tcp, pkt);
+	}
+}
+
+/* Retransmit the first segment at or above high_rxt that the peer did
+ * not SACK. Without SACK information only the first unacknowledged
+ * segment is a candidate (RFC 6582), with it any hole below the highest
+ * SACKed data is (RFC 6675, NextSeg() rule 1).
+ */
+static void tcp_retransmit_hole(struct net_tcp *tcp)
+{
+	u32_t highest = tcp_sack_highest(tcp);
+	struct net_pkt *pkt;
+
+	SYS_SLIST_FOR_EACH_CONTAINER(&tcp->sent_list, pkt, sent_list) {
+		NET_PKT_DATA_ACCESS_DEFINE(tcp_access, struct net_tcp_hdr);
+		struct net_tcp_hdr *tcp_hdr;
+		u32_t seq, seq_len;
+
+		if (!sent_pkt_transmitted(pkt)) {
+			return;
+		}
+
+		tcp_hdr = sent_pkt_hdr(pkt, &tcp_access, &seq_len);
+		if (!tcp_hdr) {
+			return;
+		}
+
+		seq = sys_get_be32(tcp_hdr->seq);
+
+		if (seq != tcp->send_una &&
+		    !net_tcp_seq_greater(highest, seq)) {
+			return;
+		}
+
+		if (net_tcp_seq_greater(tcp->high_rxt, seq) ||
+		    tcp_sacked(tcp, seq, seq + seq_len) ||
+		    sent_pkt_in_tx_queue(pkt)) {
+			continue;
+		}
+
+		tcp->high_rxt = seq + seq_len;
+		tcp_retransmit(tcp, pkt);
+
+		return;
+	}
+}
+
+/* RFC 5681 3.2 and RFC 6582 3.2: fast retransmit on the third duplicate
+ * ACK, then inflate the window for each further one while recovering.
+ */
+static void tcp_dup_ack(struct net_tcp *tcp)
+{
+	u32_t mss = tcp->send_mss;
+
+	if (tcp->flags & NET_TCP_FAST_RECOVERY) {
+		tcp->cwnd += mss;
+		tcp_retransmit_hole(tcp);
+		return;
+	}
+
+	if (tcp->dup_acks >= DUP_ACK_THRESHOLD ||
+	    ++tcp->dup_acks < DUP_ACK_THRESHOLD) {
+		return;
+	}
+
+	/* Losses of data sent before the last recovery are not new
+	 * congestion signals.
+	 */
+	if (!net_tcp_seq_greater(tcp->send_una, tcp->recover)) {
+		return;
+	}
+
+	NET_DBG("[%p] fast retransmit at %u", tcp, tcp->send_una);
+
+	tcp->ssthresh = MAX(tcp_flight_size(tcp) / 2, 2 * mss);
+	tcp->recover = tcp->send_max;
+	tcp->high_rxt = tcp->send_una;
+	tcp->flags |= NET_TCP_FAST_RECOVERY;
+
+	tcp_retransmit_hole(tcp);
+
+	tcp->cwnd = tcp->ssthresh + DUP_ACK_THRESHOLD * mss;
+}
+
+/* Update the state of the sender once ack acknowledges new data */
+/* Wakes up all the senders in net_tcp_wait_send_space(), called with
+ * the context lock held
+ */
+static void tcp_send_wake(struct net_tcp *tcp)
+{
+	for (; tcp->send_waiters > 0U; tcp->send_waiters--) {
+		k_sem_give(&tcp->send_wait);
+	}
+}
+
+static void tcp_new_ack(struct net_tcp *tcp, u32_t ack)
+{
+	u32_t acked = ack - tcp->send_una;
+	u32_t mss = tcp->send_mss;
+
+	tcp->send_una = ack;
+	tcp->dup_acks = 0U;
+
+	if ((tcp->flags & NET_TCP_RTT_PENDING) &&
+	    !net_tcp_seq_greater(tcp->rtt_seq, ack)) {
+		tcp->flags &= ~NET_TCP_RTT_PENDING;
+		tcp_rtt_update(tcp, k_uptime_get_32() - tcp->rtt_start);
+	}
+
+	tcp_sack_prune(tcp);
+
+	if (tcp->flags & NET_TCP_FAST_RECOVERY) {
+		if (!net_tcp_seq_greater(tcp->recover, ack)) {
+			/* Full acknowledgment, RFC 6582 3.2 step 3 */
+			tcp->cwnd = MIN(tcp->ssthresh,
+					MAX(tcp_flight_size(tcp), mss) + mss);
+			tcp->flags &= ~NET_TCP_FAST_RECOVERY;
+		} else {
+			/* Partial acknowledgment, the next segment was lost
+			 * too. Deflate the window by the amount of new data
+			 * acknowledged, RFC 6582 3.2 step 3.
+			 */
+			tcp_retransmit_hole(tcp);
+
+			tcp->cwnd -= MIN(acked, tcp->cwnd);
+			if (acked >= mss) {
+				tcp->cwnd += mss;
+			}
+
+			tcp->cwnd = MAX(tcp->cwnd, mss);
+		}
+
+		return;
+	}
+
+	/* Slow start below ssthresh, congestion avoidance above */
+	if (tcp->cwnd < tcp->ssthresh) {
+		tcp->cwnd += MIN(acked, mss);
+	} else {
+		tcp->cwnd += MAX(mss * mss / tcp->cwnd, 1U);
+	}
+
+	tcp->cwnd = MIN(tcp->cwnd, NET_TCP_MAX_WIN);
+}
+
+/* RFC 5681 3.1 and 5.1 of RFC 6298: on a retransmission timeout, restart
+ * slow start from one segment and send again everything that follows the
+ * lost segment.
+ */
+static void tcp_timeout_loss(struct net_tcp *tcp)
+{
+	struct net_pkt *pkt;
+
+	if (tcp->retry_timeout_shift == 1U) {
+		tcp->ssthresh = MAX(tcp_flight_size(tcp) / 2,
+				    2U * tcp->send_mss);
+	}
+
+	tcp->cwnd = tcp->send_mss;
+	tcp->recover = tcp->send_max;
+	tcp->dup_acks = 0U;
+	tcp->flags &= ~(NET_TCP_FAST_RECOVERY | NET_TCP_RTT_PENDING);
+	tcp_sack_reset(tcp);
+
+	SYS_SLIST_FOR_EACH_CONTAINER(&tcp->sent_list, pkt, sent_list) {
+		if (!sent_pkt_in_tx_queue(pkt)) {
+			net_pkt_set_sent(pkt, false);
+			net_pkt_set_queued(pkt, false);
+		}
+	}
+}
+
 static void tcp_retry_expired(struct k_work *work)
 {
 	struct net_tcp *tcp = CONTAINER_OF(work, struct net_tcp, retry_timer);
+	struct net_context *ctx = tcp->context;
 	struct net_pkt *pkt;
 
+	if (ctx == NULL) {
+		return;
+	}
+
+	k_mutex_lock(&ctx->lock, K_FOREVER);
+
+	/* The connection may have been released while we waited */
+	if (tcp->context != ctx || !net_context_is_used(ctx) ||
+	    !net_tcp_is_used(tcp)) {
+		goto unlock;
+	}
+
 	/* Double the retry period for exponential backoff and resend
-	 * the first (only the first!) unack'd packet.
+	 * from the first unack'd packet.
 	 */
 	if (!sys_slist_is_empty(&tcp->sent_list)) {
 		tcp->retry_timeout_shift++;
 
 		if (tcp->retry_timeout_shift > CONFIG_NET_TCP_RETRY_COUNT) {
 			abort_connection(tcp);
-			return;
+			goto unlock;
 		}
 
 		k_delayed_work_submit(&tcp->retry_timer, retry_timeout(tcp));
@@ -229,33 +803,24 @@ static void tcp_retry_expired(struct k_work *work)
 		pkt = CONTAINER_OF(sys_slist_peek_head(&tcp->sent_list),
 				   struct net_pkt, sent_list);
 
-		if (net_pkt_sent(pkt)) {
-			do_ref_if_needed(tcp, pkt);
-			net_pkt_set_sent(pkt, false);
-		}
-
-		net_pkt_set_queued(pkt, true);
-
-		if (net_tcp_send_pkt(pkt) < 0 && !is_6lo_technology(pkt)) {
-			NET_DBG("retry %u: [%p] pkt %p send failed",
+		if (sent_pkt_in_tx_queue(pkt)) {
+			NET_DBG("retry %u: [%p] pkt %p still queued",
 				tcp->retry_timeout_shift, tcp, pkt);
-			net_pkt_unref(pkt);
-		} else {
-			NET_DBG("retry %u: [%p] sent pkt %p",
-				tcp->retry_timeout_shift, tcp, pkt);
-			if (IS_ENABLED(CONFIG_NET_STATISTICS_TCP) &&
-			    !is_6lo_technology(pkt)) {
-				net_stats_update_tcp_seg_rexmit(
-							net_pkt_iface(pkt));
-			}
+			goto unlock;
 		}
+
+		tcp_timeout_loss(tcp);
+		tcp_send_queued(tcp);
 	} else if (CONFIG_NET_TCP_TIME_WAIT_DELAY != 0) {
 		if (tcp->fin_sent && tcp->fin_rcvd) {
 			NET_DBG("[%p] Closing connection (context %p)",
-				tcp, tcp->context);
-			net_context_unref(tcp->context);
+				tcp, ctx);
+			net_context_unref(ctx);
 		}
 	}
+
+unlock:
+	k_mutex_unlock(&ctx->lock);
 }
 
 struct net_tcp *net_tcp_alloc(struct net_context *context)
@@ -284,11 +849,15 @@ struct net_tcp *net_tcp_alloc(struct net_context *context)
 	tcp_context[i].send_seq = tcp_init_isn();
 	tcp_context[i].recv_wnd = MIN(NET_TCP_MAX_WIN, NET_TCP_BUF_MAX_LEN);
 	tcp_context[i].send_mss = NET_TCP_DEFAULT_MSS;
+	tcp_context[i].rto = CONFIG_NET_TCP_INIT_RETRANSMISSION_TIMEOUT;
+
+	tcp_send_init(&tcp_context[i], 0, 0);
 
 	tcp_context[i].accept_cb = NULL;
 
 	k_delayed_work_init(&tcp_context[i].retry_timer, tcp_retry_expired);
 	k_sem_init(&tcp_context[i].connect_wait, 0, UINT_MAX);
+	k_sem_init(&tcp_context[i].send_wait, 0, UINT_MAX);
 
 	return &tcp_context[i];
 }
@@ -339,8 +908,11 @@ int net_tcp_release(struct net_tcp *tcp)
 	net_tcp_change_state(tcp, NET_TCP_CLOSED);
 	tcp->context = NULL;
 
+	/* Wake up senders waiting for space, they see the connection gone */
+	tcp_send_wake(tcp);
+
 	key = irq_lock();
-	tcp->flags &= ~(NET_TCP_IN_USE | NET_TCP_RECV_MSS_SET);
+	tcp->flags &= ~NET_TCP_IN_USE;
 	irq_unlock(key);
 
 	NET_DBG("[%p] Disposed of TCP connection state", tcp);
@@ -518,7 +1090,7 @@ int net_tcp_prepare_segment(struct net_tcp *tcp, u8_t flags,
 {
 	struct tcp_segment segment = { 0 };
 	u32_t seq;
-	u16_t wnd;
+	u32_t wnd;
 	int status;
 
 	if (!local) {
@@ -565,6 +1137,13 @@ int net_tcp_prepare_segment(struct net_tcp *tcp, u8_t flags,
 
 	wnd = net_tcp_get_recv_wnd(tcp);
 
+	/* The window of SYN segments is never scaled, RFC 7323 2.2 */
+	if (!(flags & NET_TCP_SYN)) {
+		wnd >>= tcp->recv_wscale;
+	}
+
+	wnd = MIN(wnd, UINT16_MAX);
+
 	segment.src_addr = (struct sockaddr_ptr *)local;
 	segment.dst_addr = remote;
 	segment.seq = tcp->send_seq;
@@ -656,31 +1235,42 @@ u16_t net_tcp_get_recv_mss(const struct net_tcp *tcp)
 	return 0;
 }
 
+/* Options of SYN segments. A SYN-ACK only carries the window scale and
+ * SACK-permitted options if the SYN did, RFC 7323 1.3 and RFC 2018 2.
+ */
 static void net_tcp_set_syn_opt(struct net_tcp *tcp, u8_t *options,
-				u8_t *optionlen)
+				u8_t *optionlen, bool wscale, bool sack)
 {
 	u32_t recv_mss;
 
 	*optionlen = 0U;
 
-	if (!(tcp->flags & NET_TCP_RECV_MSS_SET)) {
-		recv_mss = net_tcp_get_recv_mss(tcp);
-		tcp->flags |= NET_TCP_RECV_MSS_SET;
-	} else {
-		recv_mss = 0U;
-	}
-
+	recv_mss = net_tcp_get_recv_mss(tcp);
 	recv_mss |= (NET_TCP_MSS_OPT << 24) | (NET_TCP_MSS_SIZE << 16);
 	UNALIGNED_PUT(htonl(recv_mss),
 		      (u32_t *)(options + *optionlen));
 
 	*optionlen += NET_TCP_MSS_SIZE;
+
+	if (IS_ENABLED(CONFIG_NET_TCP_WINDOW_SCALE) && wscale) {
+		options[(*optionlen)++] = NET_TCP_NOP_OPT;
+		options[(*optionlen)++] = NET_TCP_WINDOW_SCALE_OPT;
+		options[(*optionlen)++] = NET_TCP_WINDOW_SCALE_SIZE;
+		options[(*optionlen)++] = tcp_recv_wscale();
+	}
+
+	if (IS_ENABLED(CONFIG_NET_TCP_SACK) && sack) {
+		options[(*optionlen)++] = NET_TCP_NOP_OPT;
+		options[(*optionlen)++] = NET_TCP_NOP_OPT;
+		options[(*optionlen)++] = NET_TCP_SACK_PERM_OPT;
+		options[(*optionlen)++] = NET_TCP_SACK_PERM_SIZE;
+	}
 }
 
 int net_tcp_prepare_ack(struct net_tcp *tcp, const struct sockaddr *remote,
 			struct net_pkt **pkt)
 {
-	u8_t options[NET_TCP_MAX_OPT_SIZE];
+	u8_t options[NET_TCP_MAX_SYN_OPT_SIZE];
 	u8_t optionlen;
 
 	switch (net_tcp_get_state(tcp)) {
@@ -688,7 +1278,9 @@ int net_tcp_prepare_ack(struct net_tcp *tcp, const struct sockaddr *remote,
 		/* In the SYN_RCVD state acknowledgment must be with the
 		 * SYN flag.
 		 */
-		net_tcp_set_syn_opt(tcp, options, &optionlen);
+		net_tcp_set_syn_opt(tcp, options, &optionlen,
+				    tcp->flags & NET_TCP_WSCALE,
+				    tcp->flags & NET_TCP_SACK_PERMITTED);
 
 		return net_tcp_prepare_segment(tcp, NET_TCP_SYN | NET_TCP_ACK,
 					       options, optionlen, NULL, remote,
@@ -850,11 +1442,69 @@ static int net_tcp_queue_pkt(struct net_context *context, struct net_pkt *pkt)
 				      retry_timeout(context->tcp));
 	}
 
-	do_ref_if_needed(context->tcp, pkt);
-
 	return 0;
 }
 
+/*
+ * Any number of senders may wait here.  They check the space and count
+ * themselves in send_waiters under the context lock, which the receive
+ * path holds when it frees space and wakes them all, so no wakeup is
+ * lost.  A give left over by a sender that timed out at the same time
+ * only causes a spurious wakeup.
+ */
+int net_tcp_wait_send_space(struct net_context *context, s32_t timeout)
+{
+	struct net_tcp *tcp;
+	u32_t start = k_uptime_get_32();
+	s32_t remaining = timeout;
+	int ret = 0;
+
+	k_mutex_lock(&context->lock, K_FOREVER);
+
+	while ((tcp = context->tcp) != NULL &&
+	       (net_tcp_get_state(tcp) == NET_TCP_ESTABLISHED ||
+		net_tcp_get_state(tcp) == NET_TCP_CLOSE_WAIT)) {
+		if (tcp->send_seq - tcp->send_una <
+		    MAX(tcp->send_wnd, tcp->send_mss)) {
+			break;
+		}
+
+		if (timeout != K_FOREVER) {
+			remaining = timeout - (s32_t)(k_uptime_get_32() - start);
+			if (remaining <= 0) {
+				ret = -EAGAIN;
+				break;
+			}
+		}
+
+		tcp->send_waiters++;
+		k_mutex_unlock(&context->lock);
+
+		ret = k_sem_take(&tcp->send_wait, remaining);
+
+		k_mutex_lock(&context->lock, K_FOREVER);
+
+		if (ret < 0) {
+			/* Unless a wakeup raced with the timeout, we are
+			 * still counted
+			 */
+			if (context->tcp == tcp &&
+			    k_sem_take(&tcp->send_wait, K_NO_WAIT) < 0 &&
+			    tcp->send_waiters > 0U) {
+				tcp->send_waiters--;
+			}
+
+			ret = -EAGAIN;
+			break;
+		}
+	}
+
+	k_mutex_unlock(&context->lock);
+
+	/* Otherwise let the send path report the state of the connection */
+	return ret;
+}
+
 int net_tcp_send_pkt(struct net_pkt *pkt)
 {
 	NET_PKT_DATA_ACCESS_DEFINE(tcp_access, struct net_tcp_hdr);
@@ -996,35 +1646,10 @@ static void restart_timer(struct net_tcp *tcp)
 int net_tcp_send_data(struct net_context *context, net_context_send_cb_t cb,
 		      void *token, void *user_data)
 {
-	struct net_pkt *pkt;
-
-	/* For now, just send all queued data synchronously.  Need to
-	 * add window handling and retry/ACK logic.
+	/* Queued data that does not fit in the windows yet goes out as
+	 * ACKs arrive.
 	 */
-	SYS_SLIST_FOR_EACH_CONTAINER(&context->tcp->sent_list, pkt, sent_list) {
-		/* Do not resend packets that were sent by expire timer */
-		if (net_pkt_queued(pkt)) {
-			NET_DBG("[%p] Skipping pkt %p because it was already "
-				"sent.", context->tcp, pkt);
-			continue;
-		}
-
-		if (!net_pkt_sent(pkt)) {
-			int ret;
-
-			NET_DBG("[%p] Sending pkt %p (%zd bytes)", context->tcp,
-				pkt, net_pkt_get_len(pkt));
-
-			ret = net_tcp_send_pkt(pkt);
-			if (ret < 0 && !is_6lo_technology(pkt)) {
-				NET_DBG("[%p] pkt %p not sent (%d)",
-					context->tcp, pkt, ret);
-				net_pkt_unref(pkt);
-			}
-
-			net_pkt_set_queued(pkt, true);
-		}
-	}
+	tcp_send_queued(context->tcp);
 
 	/* Just make the callback synchronously even if it didn't
 	 * go over the wire.  In theory it would be nice to track
@@ -1066,18 +1691,7 @@ bool net_tcp_ack_received(struct net_context *ctx, u32_t ack)
 		head = sys_slist_peek_head(list);
 		pkt = CONTAINER_OF(head, struct net_pkt, sent_list);
 
-		net_pkt_cursor_init(pkt);
-		net_pkt_set_overwrite(pkt, true);
-
-		if (net_pkt_skip(pkt, net_pkt_ip_hdr_len(pkt) +
-			 net_pkt_ipv6_ext_len(pkt))) {
-			sys_slist_remove(list, NULL, head);
-			net_pkt_unref(pkt);
-			continue;
-		}
-
-		tcp_hdr = (struct net_tcp_hdr *)net_pkt_get_data_new(
-							pkt, &tcp_access);
+		tcp_hdr = sent_pkt_hdr(pkt, &tcp_access, &seq_len);
 		if (!tcp_hdr) {
 			/* The pkt does not contain TCP header, this should
 			 * not happen.
@@ -1088,18 +1702,6 @@ bool net_tcp_ack_received(struct net_context *ctx, u32_t ack)
 			continue;
 		}
 
-		seq_len = net_pkt_appdatalen(pkt);
-
-		/* Each of SYN and FIN flags are counted
-		 * as one sequence number.
-		 */
-		if (tcp_hdr->flags & NET_TCP_SYN) {
-			seq_len += 1;
-		}
-		if (tcp_hdr->flags & NET_TCP_FIN) {
-			seq_len += 1;
-		}
-
 		/* Last sequence number in this packet. */
 		last_seq = sys_get_be32(tcp_hdr->seq) + seq_len - 1;
 
@@ -1136,6 +1738,10 @@ bool net_tcp_ack_received(struct net_context *ctx, u32_t ack)
 		restart_timer(ctx->tcp);
 	}
 
+	if (net_tcp_seq_greater(ack, tcp->send_una)) {
+		tcp_new_ack(tcp, ack);
+	}
+
 	return true;
 }
 
@@ -1284,7 +1890,9 @@ int net_tcp_finalize(struct net_pkt *pkt)
 int net_tcp_parse_opts(struct net_pkt *pkt, int opt_totlen,
 		       struct net_tcp_options *opts)
 {
+	struct net_tcp_sack_block blk;
 	u8_t opt, optlen;
+	int i;
 
 	while (opt_totlen) {
 		if (net_pkt_read_u8_new(pkt, &opt)) {
@@ -1335,6 +1943,46 @@ int net_tcp_parse_opts(struct net_pkt *pkt, int opt_totlen,
 				goto error;
 			}
 
+			break;
+		case NET_TCP_WINDOW_SCALE_OPT:
+			if (optlen != 1) {
+				goto error;
+			}
+
+			if (net_pkt_read_u8_new(pkt, &opts->wscale)) {
+				goto error;
+			}
+
+			/* RFC 7323 2.3, larger shifts are used as 14 */
+			opts->wscale = MIN(opts->wscale,
+					   NET_TCP_MAX_WINDOW_SHIFT);
+			opts->wscale_ok = 1U;
+
+			break;
+		case NET_TCP_SACK_PERM_OPT:
+			if (optlen != 0) {
+				goto error;
+			}
+
+			opts->sack_permitted = 1U;
+
+			break;
+		case NET_TCP_SACK_OPT:
+			if (optlen % NET_TCP_SACK_BLOCK_SIZE) {
+				goto error;
+			}
+
+			for (i = 0; i < optlen / NET_TCP_SACK_BLOCK_SIZE; i++) {
+				if (net_pkt_read_be32_new(pkt, &blk.left) ||
+				    net_pkt_read_be32_new(pkt, &blk.right)) {
+					goto error;
+				}
+
+				if (opts->sack_count < NET_TCP_MAX_SACK_BLOCKS) {
+					opts->sack[opts->sack_count++] = blk;
+				}
+			}
+
 			break;
 		default:
 			if (net_pkt_skip(pkt, optlen)) {
@@ -1384,10 +2032,8 @@ static void queue_fin(struct net_context *ctx)
 
 	net_tcp_queue_pkt(ctx, pkt);
 
-	ret = net_tcp_send_pkt(pkt);
-	if (ret < 0) {
-		net_pkt_unref(pkt);
-	}
+	/* The FIN goes out after the queued data */
+	tcp_send_queued(ctx->tcp);
 }
 
 int net_tcp_put(struct net_context *context)
@@ -1432,7 +2078,7 @@ int net_tcp_update_recv_wnd(struct net_context *context, s32_t delta)
 	}
 
 	new_win = context->tcp->recv_wnd + delta;
-	if (new_win < 0 || new_win > UINT16_MAX) {
+	if (new_win < 0 || new_win > NET_TCP_MAX_WIN) {
 		return -EINVAL;
 	}
 
@@ -1559,7 +2205,7 @@ static int tcp_backlog_syn(struct net_pkt *pkt,
 			   union net_ip_header *ip_hdr,
 			   struct net_tcp_hdr *tcp_hdr,
 			   struct net_context *context,
-			   u16_t send_mss)
+			   const struct net_tcp_options *opts)
 {
 	int empty_slot = -1;
 
@@ -1578,7 +2224,10 @@ static int tcp_backlog_syn(struct net_pkt *pkt,
 
 	tcp_backlog[empty_slot].send_seq = context->tcp->send_seq;
 	tcp_backlog[empty_slot].send_ack = context->tcp->send_ack;
-	tcp_backlog[empty_slot].send_mss = send_mss;
+	tcp_backlog[empty_slot].send_mss = opts->mss;
+	tcp_backlog[empty_slot].send_wscale = opts->wscale;
+	tcp_backlog[empty_slot].wscale_ok = opts->wscale_ok;
+	tcp_backlog[empty_slot].sack_permitted = opts->sack_permitted;
 
 	k_delayed_work_init(&tcp_backlog[empty_slot].ack_timer,
 			    backlog_ack_timeout);
@@ -1592,6 +2241,7 @@ static int tcp_backlog_ack(struct net_pkt *pkt,
 			   struct net_tcp_hdr *tcp_hdr,
 			   struct net_context *context)
 {
+	struct net_tcp_options opts = { 0 };
 	int r;
 
 	r = tcp_backlog_find(pkt, ip_hdr, tcp_hdr, NULL);
@@ -1608,7 +2258,15 @@ static int tcp_backlog_ack(struct net_pkt *pkt,
 		sizeof(struct sockaddr));
 	context->tcp->send_seq = tcp_backlog[r].send_seq + 1;
 	context->tcp->send_ack = tcp_backlog[r].send_ack;
-	context->tcp->send_mss = tcp_backlog[r].send_mss;
+
+	opts.mss = tcp_backlog[r].send_mss;
+	opts.wscale = tcp_backlog[r].send_wscale;
+	opts.wscale_ok = tcp_backlog[r].wscale_ok;
+	opts.sack_permitted = tcp_backlog[r].sack_permitted;
+	tcp_set_peer_opts(context->tcp, &opts);
+
+	tcp_send_init(context->tcp, sys_get_be16(tcp_hdr->wnd),
+		      context->tcp->send_wscale);
 
 	k_delayed_work_cancel(&tcp_backlog[r].ack_timer);
 	(void)memset(&tcp_backlog[r], 0, sizeof(struct tcp_backlog_entry));
@@ -1787,20 +2445,23 @@ static void print_send_info(struct net_pkt *pkt,
 	}
 }
 
-/* Send SYN or SYN/ACK. */
+/* Send SYN or SYN/ACK. peer holds the options of the SYN being
+ * acknowledged, NULL when sending a SYN.
+ */
 static inline int send_syn_segment(struct net_context *context,
 				       const struct sockaddr_ptr *local,
 				       const struct sockaddr *remote,
+				       const struct net_tcp_options *peer,
 				       int flags, const char *msg)
 {
 	struct net_pkt *pkt = NULL;
 	int ret;
-	u8_t options[NET_TCP_MAX_OPT_SIZE];
+	u8_t options[NET_TCP_MAX_SYN_OPT_SIZE];
 	u8_t optionlen = 0U;
 
-	if (flags == NET_TCP_SYN) {
-		net_tcp_set_syn_opt(context->tcp, options, &optionlen);
-	}
+	net_tcp_set_syn_opt(context->tcp, options, &optionlen,
+			    !peer || peer->wscale_ok,
+			    !peer || peer->sack_permitted);
 
 	ret = net_tcp_prepare_segment(context->tcp, flags, options, optionlen,
 				      local, remote, &pkt);
@@ -1826,14 +2487,16 @@ static inline int send_syn(struct net_context *context,
 {
 	net_tcp_change_state(context->tcp, NET_TCP_SYN_SENT);
 
-	return send_syn_segment(context, NULL, remote, NET_TCP_SYN, "SYN");
+	return send_syn_segment(context, NULL, remote, NULL, NET_TCP_SYN,
+				"SYN");
 }
 
 static inline int send_syn_ack(struct net_context *context,
 			       struct sockaddr_ptr *local,
-			       struct sockaddr *remote)
+			       struct sockaddr *remote,
+			       const struct net_tcp_options *peer)
 {
-	return send_syn_segment(context, local, remote,
+	return send_syn_segment(context, local, remote, peer,
 				    NET_TCP_SYN | NET_TCP_ACK,
 				    "SYN_ACK");
 }
@@ -1902,7 +2565,9 @@ NET_CONN_CB(tcp_established)
 {
 	struct net_context *context = (struct net_context *)user_data;
 	struct net_tcp_hdr *tcp_hdr = proto_hdr->tcp;
+	struct net_tcp_options tcp_opts = { 0 };
 	enum net_verdict ret = NET_OK;
+	int opt_totlen;
 	u8_t tcp_flags;
 	u16_t data_len;
 
@@ -1940,10 +2605,10 @@ resend_ack:
 			    context->tcp->send_ack) > 0) {
 		/* Don't try to reorder packets.  If it doesn't
 		 * match the next segment exactly, drop and wait for
-		 * retransmit
+		 * retransmit. The immediate duplicate ACK lets the peer
+		 * detect the loss without a timeout, RFC 5681 4.2.
 		 */
-		ret = NET_DROP;
-		goto unlock;
+		goto resend_ack;
 	}
 
 	/*
@@ -1973,14 +2638,56 @@ resend_ack:
 		goto unlock;
 	}
 
+	opt_totlen = NET_TCP_HDR_LEN(tcp_hdr) - sizeof(struct net_tcp_hdr);
+	if (opt_totlen > 0 &&
+	    net_tcp_parse_opts(pkt, opt_totlen, &tcp_opts) < 0) {
+		ret = NET_DROP;
+		goto unlock;
+	}
+
+	net_pkt_set_appdatalen(pkt, net_pkt_get_len(pkt) -
+			       net_pkt_ip_hdr_len(pkt) -
+			       net_pkt_ipv6_ext_len(pkt) -
+			       NET_TCP_HDR_LEN(tcp_hdr));
+
+	net_pkt_set_appdata(pkt, net_pkt_cursor_get_pos(pkt));
+
+	data_len = net_pkt_appdatalen(pkt);
+
 	/* Handle TCP state transition */
 	if (tcp_flags & NET_TCP_ACK) {
-		if (!net_tcp_ack_received(context,
-					  sys_get_be32(tcp_hdr->ack))) {
+		struct net_tcp *tcp = context->tcp;
+		u32_t ack = sys_get_be32(tcp_hdr->ack);
+		u16_t wnd = sys_get_be16(tcp_hdr->wnd);
+		bool dup_ack;
+
+		tcp_sack_update(tcp, &tcp_opts);
+
+		/* RFC 5681 section 2: a window update is not a duplicate */
+		dup_ack = ack == tcp->send_una && data_len == 0U &&
+			!(tcp_flags & (NET_TCP_SYN | NET_TCP_FIN)) &&
+			tcp->send_max != tcp->send_una &&
+			wnd == tcp->peer_wnd;
+
+		if (!net_tcp_ack_received(context, ack)) {
 			ret = NET_DROP;
 			goto unlock;
 		}
 
+		if (!net_tcp_seq_greater(tcp->send_una, ack)) {
+			tcp->send_wnd = (u32_t)wnd << tcp->send_wscale;
+			tcp->peer_wnd = wnd;
+
+			/* Acknowledged data or a window update may have
+			 * made room
+			 */
+			tcp_send_wake(tcp);
+		}
+
+		if (dup_ack) {
+			tcp_dup_ack(tcp);
+		}
+
 		/* TCP state might be changed after maintaining the sent pkt
 		 * list, e.g., an ack of FIN is received.
 		 */
@@ -2022,14 +2729,6 @@ resend_ack:
 		context->tcp->fin_rcvd = 1;
 	}
 
-	net_pkt_set_appdatalen(pkt, net_pkt_get_len(pkt) -
-			       net_pkt_ip_hdr_len(pkt) -
-			       net_pkt_ipv6_ext_len(pkt) -
-			       NET_TCP_HDR_LEN(tcp_hdr));
-
-	net_pkt_set_appdata(pkt, net_pkt_cursor_get_pos(pkt));
-
-	data_len = net_pkt_appdatalen(pkt);
 	if (data_len > net_tcp_get_recv_wnd(context->tcp)) {
 		/* In case we have zero window, we should still accept
 		 * Zero Window Probes from peer, which per convention
@@ -2066,6 +2765,9 @@ resend_ack:
 		context->tcp->send_ack += 1;
 	}
 
+	/* Data that the ACK let in carries the acknowledgment */
+	tcp_send_queued(context->tcp);
+
 	send_ack(context, &conn->remote_addr, false);
 
 clean_up:
@@ -2149,9 +2851,18 @@ NET_CONN_CB(tcp_synack_received)
 		/* Remove the temporary connection handler and register
 		 * a proper now as we have an established connection.
 		 */
+		struct net_tcp_options tcp_opts = {
+			.mss = NET_TCP_DEFAULT_MSS,
+		};
 		struct sockaddr local_addr;
 		struct sockaddr remote_addr;
 
+		if (net_tcp_parse_opts(pkt, NET_TCP_HDR_LEN(tcp_hdr) -
+				       sizeof(struct net_tcp_hdr),
+				       &tcp_opts) < 0) {
+			return NET_DROP;
+		}
+
 		tcp_copy_ip_addr_from_hdr(net_pkt_family(pkt), ip_hdr, tcp_hdr,
 					  &remote_addr, true);
 		tcp_copy_ip_addr_from_hdr(net_pkt_family(pkt), ip_hdr, tcp_hdr,
@@ -2173,6 +2884,10 @@ NET_CONN_CB(tcp_synack_received)
 			return NET_DROP;
 		}
 
+		tcp_set_peer_opts(context->tcp, &tcp_opts);
+		/* The window of a SYN is never scaled */
+		tcp_send_init(context->tcp, sys_get_be16(tcp_hdr->wnd), 0);
+
 		net_tcp_change_state(context->tcp, NET_TCP_ESTABLISHED);
 		net_context_set_state(context, NET_CONTEXT_CONNECTED);
 
@@ -2300,10 +3015,9 @@ NET_CONN_CB(tcp_syn_rcvd)
 		context->tcp->send_ack =
 			sys_get_be32(tcp_hdr->seq) + 1;
 
-		/* Get MSS from TCP options here*/
-
+		/* Keep the options until the handshake completes */
 		r = tcp_backlog_syn(pkt, ip_hdr, tcp_hdr,
-				    context, tcp_opts.mss);
+				    context, &tcp_opts);
 		if (r < 0) {
 			if (r == -EADDRINUSE) {
 				NET_DBG("TCP connection already exists");
@@ -2317,7 +3031,7 @@ NET_CONN_CB(tcp_syn_rcvd)
 		get_sockaddr_ptr(ip_hdr, tcp_hdr,
 				 net_context_get_family(context),
 				 &pkt_src_addr);
-		send_syn_ack(context, &pkt_src_addr, &remote_addr);
+		send_syn_ack(context, &pkt_src_addr, &remote_addr, &tcp_opts);
 		net_pkt_unref(pkt);
 		return NET_OK;
 	}
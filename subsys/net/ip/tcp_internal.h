@@ -29,7 +29,11 @@ extern "C" {
 /** Is this TCP context/socket used or not */
 #define NET_TCP_IN_USE BIT(0)
 
-/* BIT(1), BIT(2) are unused and available */
+/** Window scaling is in use on this connection (RFC 7323) */
+#define NET_TCP_WSCALE BIT(1)
+
+/** The peer accepts SACK options (RFC 2018) */
+#define NET_TCP_SACK_PERMITTED BIT(2)
 
 /** Is the socket shutdown for read/write */
 #define NET_TCP_IS_SHUTDOWN BIT(3)
@@ -37,8 +41,11 @@ extern "C" {
 /** A retransmitted packet has been sent and not yet ack'd */
 #define NET_TCP_RETRYING BIT(4)
 
-/** MSS option has been set already */
-#define NET_TCP_RECV_MSS_SET BIT(5)
+/** Fast recovery is in progress (RFC 6582) */
+#define NET_TCP_FAST_RECOVERY BIT(5)
+
+/** A segment is being timed for a round-trip time sample */
+#define NET_TCP_RTT_PENDING BIT(6)
 
 /*
  * TCP connection states
@@ -77,33 +84,63 @@ enum net_tcp_state {
  */
 #define NET_TCP_DEFAULT_MSS   536
 
+/* Largest window shift allowed by RFC 7323 */
+#define NET_TCP_MAX_WINDOW_SHIFT 14
+
 /* TCP max window size */
-#define NET_TCP_MAX_WIN   (4 * 1024)
+#if defined(CONFIG_NET_TCP_WINDOW_SCALE)
+#define NET_TCP_MAX_WIN   ((u32_t)UINT16_MAX << NET_TCP_MAX_WINDOW_SHIFT)
+#else
+#define NET_TCP_MAX_WIN   UINT16_MAX
+#endif
 
 /* Maximal value of the sequence number */
 #define NET_TCP_MAX_SEQ   0xffffffff
 
 #define NET_TCP_MAX_OPT_SIZE  8
 
+/* MSS, window scale and SACK-permitted, each padded to 4 bytes */
+#define NET_TCP_MAX_SYN_OPT_SIZE 12
+
 /* TCP Option codes */
 #define NET_TCP_END_OPT          0
 #define NET_TCP_NOP_OPT          1
 #define NET_TCP_MSS_OPT          2
 #define NET_TCP_WINDOW_SCALE_OPT 3
+#define NET_TCP_SACK_PERM_OPT    4
+#define NET_TCP_SACK_OPT         5
 
 /* TCP Option sizes */
 #define NET_TCP_END_SIZE          1
 #define NET_TCP_NOP_SIZE          1
 #define NET_TCP_MSS_SIZE          4
 #define NET_TCP_WINDOW_SCALE_SIZE 3
+#define NET_TCP_SACK_PERM_SIZE    2
+#define NET_TCP_SACK_BLOCK_SIZE   8
+
+/* Max number of SACK blocks kept from the peer */
+#define NET_TCP_MAX_SACK_BLOCKS 4
+
+/** A block of data received by the peer, [left, right) */
+struct net_tcp_sack_block {
+	u32_t left;
+	u32_t right;
+};
 
 /** Parsed TCP option values for net_tcp_parse_opts()  */
 struct net_tcp_options {
 	u16_t mss;
+	/** Window scale option value, valid if wscale_ok is set */
+	u8_t wscale;
+	u8_t wscale_ok : 1;
+	u8_t sack_permitted : 1;
+	/** Number of valid entries in sack */
+	u8_t sack_count;
+	struct net_tcp_sack_block sack[NET_TCP_MAX_SACK_BLOCKS];
 };
 
 /* Max received bytes to buffer internally */
-#define NET_TCP_BUF_MAX_LEN 1280
+#define NET_TCP_BUF_MAX_LEN CONFIG_NET_TCP_MAX_RECV_WINDOW_SIZE
 
 /* Max segment lifetime, in seconds */
 #define NET_TCP_MAX_SEG_LIFETIME 60
@@ -141,6 +178,55 @@ struct net_tcp {
 	/** Last ACK value sent */
 	u32_t sent_ack;
 
+	/** Oldest unacknowledged sequence number */
+	u32_t send_una;
+
+	/** Highest sequence number sent so far */
+	u32_t send_max;
+
+	/** Send window advertised by the peer, scaled */
+	u32_t send_wnd;
+
+	/** Window field of the segment send_wnd was taken from, as sent
+	 * by the peer, to tell duplicate ACKs from window updates
+	 */
+	u16_t peer_wnd;
+
+	/** Congestion window (RFC 5681) */
+	u32_t cwnd;
+
+	/** Slow start threshold (RFC 5681) */
+	u32_t ssthresh;
+
+	/** Highest sequence number sent when fast recovery started */
+	u32_t recover;
+
+	/** Highest sequence number retransmitted during fast recovery */
+	u32_t high_rxt;
+
+	/** End of the segment being timed for a round-trip time sample */
+	u32_t rtt_seq;
+
+	/** Uptime when the timed segment was sent, in milliseconds */
+	u32_t rtt_start;
+
+	/** Smoothed round-trip time, in 1/8 milliseconds (RFC 6298) */
+	u32_t srtt;
+
+	/** Round-trip time variation, in 1/4 milliseconds (RFC 6298) */
+	u32_t rttvar;
+
+	/** Retransmission timeout before backoff, in milliseconds */
+	u32_t rto;
+
+#if defined(CONFIG_NET_TCP_SACK)
+	/** Data received by the peer above send_una, as SACKed by it */
+	struct net_tcp_sack_block sack[NET_TCP_MAX_SACK_BLOCKS];
+
+	/** Number of valid entries in sack */
+	u8_t sack_count;
+#endif
+
 	/** Accept callback to be called when the connection has been
 	 * established.
 	 */
@@ -151,16 +237,33 @@ struct net_tcp {
 	 */
 	struct k_sem connect_wait;
 
+	/**
+	 * Semaphore to wake up senders once acknowledged data or a window
+	 * update may have freed send space, or the connection went away
+	 */
+	struct k_sem send_wait;
+
+	/** Number of senders waiting on send_wait */
+	u32_t send_waiters;
+
 	/**
 	 * Current TCP receive window for our side
 	 */
-	u16_t recv_wnd;
+	u32_t recv_wnd;
 
 	/**
 	 * Send MSS for the peer
 	 */
 	u16_t send_mss;
 
+	/** Number of duplicate ACKs received in a row */
+	u8_t dup_acks;
+
+	/** Window shift applied to the windows advertised by the peer */
+	u8_t send_wscale : 4;
+	/** Window shift applied to the windows we advertise */
+	u8_t recv_wscale : 4;
+
 	/** Current retransmit period */
 	u32_t retry_timeout_shift : 5;
 	/** Flags for the TCP */
@@ -435,6 +538,29 @@ static inline int net_tcp_queue_data(struct net_context *context,
 }
 #endif
 
+/**
+ * @brief Wait until the connection can queue more data
+ *
+ * Data is queued until it fits in the send window, this bounds the
+ * amount of queued data to the window advertised by the peer.
+ *
+ * @param context TCP context
+ * @param timeout Time to wait for acknowledgments that free space
+ *
+ * @return 0 if data can be queued, -EAGAIN if the timeout expired
+ */
+#if defined(CONFIG_NET_TCP)
+int net_tcp_wait_send_space(struct net_context *context, s32_t timeout);
+#else
+static inline int net_tcp_wait_send_space(struct net_context *context,
+					  s32_t timeout)
+{
+	ARG_UNUSED(context);
+	ARG_UNUSED(timeout);
+	return 0;
+}
+#endif
+
 /**
  * @brief Sends one TCP packet initialized with the _prepare_*()
  *        family of functions.
@@ -561,8 +687,8 @@ static inline int net_tcp_finalize(struct net_pkt *pkt)
 /**
  * @brief Parse TCP options from network packet.
  *
- * Parse TCP options, returning MSS value (as that the only one we
- * handle so far).
+ * Parse TCP options, returning the MSS, window scale, SACK-permitted
+ * and SACK values.
  *
  * @param pkt Network packet
  * @param opt_totlen Total length of options to parse
@@ -102,6 +102,10 @@ int zsock_socket_internal(int family, int type, int proto)
 	/* recv_q and accept_q are in union */
 	k_fifo_init(&ctx->recv_q);
 
+#if defined(CONFIG_NET_SOCKETS_EPOLL)
+	sys_slist_init(&ctx->epoll_items);
+#endif
+
 #ifdef CONFIG_USERSPACE
 	/* Set net context object as initialized and grant access to the
 	 * calling thread (and only the calling thread)
@@ -164,8 +168,17 @@ int zsock_close_ctx(struct net_context *ctx)
 		(void)net_context_recv(ctx, NULL, K_NO_WAIT, NULL);
 	}
 
+	sock_epoll_release(ctx);
+
 	zsock_flush_queue(ctx);
 
+#if defined(CONFIG_NET_SOCKETS_ZERO_COPY)
+	/* Packets still lent out must not reopen the window of whatever
+	 * socket reuses this context next.
+	 */
+	ctx->zc_gen++;
+#endif
+
 	SET_ERRNO(net_context_put(ctx));
 
 	return 0;
@@ -225,8 +238,12 @@ static void zsock_accepted_cb(struct net_context *new_ctx,
 		(void)net_context_recv(new_ctx, zsock_received_cb, K_NO_WAIT,
 				       NULL);
 		k_fifo_init(&new_ctx->recv_q);
+#if defined(CONFIG_NET_SOCKETS_EPOLL)
+		sys_slist_init(&new_ctx->epoll_items);
+#endif
 
 		k_fifo_put(&parent->accept_q, new_ctx);
+		sock_epoll_notify(parent);
 	}
 }
 
@@ -251,6 +268,7 @@ static void zsock_received_cb(struct net_context *ctx,
 			 */
 			sock_set_eof(ctx);
 			k_fifo_cancel_wait(&ctx->recv_q);
+			sock_epoll_notify(ctx);
 			NET_DBG("Marked socket %p as peer-closed", ctx);
 		} else {
 			net_pkt_set_eof(last_pkt, true);
@@ -267,6 +285,7 @@ static void zsock_received_cb(struct net_context *ctx,
 	}
 
 	k_fifo_put(&ctx->recv_q, pkt);
+	sock_epoll_notify(ctx);
 }
 
 int zsock_bind_ctx(struct net_context *ctx, const struct sockaddr *addr,
@@ -586,17 +605,32 @@ error:
 	return ret;
 }
 
+int sock_pkt_read_msg(struct net_pkt *pkt, struct msghdr *msg, size_t len)
+{
+	size_t i;
+
+	for (i = 0; i < msg->msg_iovlen && len; i++) {
+		size_t chunk = MIN(msg->msg_iov[i].iov_len, len);
+
+		if (net_pkt_read_new(pkt, msg->msg_iov[i].iov_base, chunk)) {
+			return -ENOBUFS;
+		}
+
+		len -= chunk;
+	}
+
+	return 0;
+}
+
 static inline ssize_t zsock_recv_dgram(struct net_context *ctx,
-				       void *buf,
-				       size_t max_len,
-				       int flags,
-				       struct sockaddr *src_addr,
-				       socklen_t *addrlen)
+				       struct msghdr *msg,
+				       int flags)
 {
 	s32_t timeout = K_FOREVER;
 	size_t recv_len = 0;
 	struct net_pkt_cursor backup;
 	struct net_pkt *pkt;
+	size_t max_len;
 
 	if ((flags & ZSOCK_MSG_DONTWAIT) || sock_is_nonblock(ctx)) {
 		timeout = K_NO_WAIT;
@@ -624,35 +658,40 @@ static inline ssize_t zsock_recv_dgram(struct net_context *ctx,
 
 	net_pkt_cursor_backup(pkt, &backup);
 
-	if (src_addr && addrlen) {
+	if (msg->msg_name) {
+		struct sockaddr *src_addr = msg->msg_name;
 		int rv;
 
 		rv = sock_get_pkt_src_addr(pkt, net_context_get_ip_proto(ctx),
-					   src_addr, *addrlen);
+					   src_addr, msg->msg_namelen);
 		if (rv < 0) {
 			errno = -rv;
 			return -1;
 		}
 
-		/* addrlen is a value-result argument, set to actual
+		/* msg_namelen is a value-result argument, set to actual
 		 * size of source address
 		 */
 		if (src_addr->sa_family == AF_INET) {
-			*addrlen = sizeof(struct sockaddr_in);
+			msg->msg_namelen = sizeof(struct sockaddr_in);
 		} else if (src_addr->sa_family == AF_INET6) {
-			*addrlen = sizeof(struct sockaddr_in6);
+			msg->msg_namelen = sizeof(struct sockaddr_in6);
 		} else {
 			errno = ENOTSUP;
 			return -1;
 		}
 	}
 
+	msg->msg_flags = 0;
+	max_len = net_msghdr_len(msg);
+
 	recv_len = net_pkt_remaining_data(pkt);
 	if (recv_len > max_len) {
 		recv_len = max_len;
+		msg->msg_flags |= ZSOCK_MSG_TRUNC;
 	}
 
-	if (net_pkt_read_new(pkt, buf, recv_len)) {
+	if (sock_pkt_read_msg(pkt, msg, recv_len)) {
 		errno = ENOBUFS;
 		return -1;
 	}
@@ -754,7 +793,27 @@ ssize_t zsock_recvfrom_ctx(struct net_context *ctx, void *buf, size_t max_len,
 	enum net_sock_type sock_type = net_context_get_type(ctx);
 
 	if (sock_type == SOCK_DGRAM) {
-		return zsock_recv_dgram(ctx, buf, max_len, flags, src_addr, addrlen);
+		struct iovec iov = {
+			.iov_base = buf,
+			.iov_len = max_len,
+		};
+		struct msghdr msg = {
+			.msg_iov = &iov,
+			.msg_iovlen = 1,
+		};
+		ssize_t ret;
+
+		if (src_addr && addrlen) {
+			msg.msg_name = src_addr;
+			msg.msg_namelen = *addrlen;
+		}
+
+		ret = zsock_recv_dgram(ctx, &msg, flags);
+		if (ret >= 0 && msg.msg_name) {
+			*addrlen = msg.msg_namelen;
+		}
+
+		return ret;
 	} else if (sock_type == SOCK_STREAM) {
 		return zsock_recv_stream(ctx, buf, max_len, flags);
 	} else {
@@ -803,6 +862,645 @@ Z_SYSCALL_HANDLER(zsock_recvfrom, sock, buf, max_len, flags, src_addr,
 }
 #endif /* CONFIG_USERSPACE */
 
+ssize_t sock_sendmsg_stream(void *obj, const struct socket_op_vtable *vtable,
+			    const struct msghdr *msg, int flags)
+{
+	ssize_t total = 0;
+	size_t i;
+
+	for (i = 0; i < msg->msg_iovlen; i++) {
+		const struct iovec *iov = &msg->msg_iov[i];
+		ssize_t len;
+
+		if (!iov->iov_len) {
+			continue;
+		}
+
+		len = vtable->sendto(obj, iov->iov_base, iov->iov_len, flags,
+				     NULL, 0);
+		if (len < 0) {
+			/* Report what was sent so far, if anything */
+			return total ? total : -1;
+		}
+
+		total += len;
+		if (len < iov->iov_len) {
+			break;
+		}
+	}
+
+	return total;
+}
+
+ssize_t sock_recvmsg_stream(void *obj, const struct socket_op_vtable *vtable,
+			    struct msghdr *msg, int flags)
+{
+	ssize_t total = 0;
+	size_t i;
+
+	msg->msg_flags = 0;
+	msg->msg_controllen = 0;
+
+	for (i = 0; i < msg->msg_iovlen; i++) {
+		const struct iovec *iov = &msg->msg_iov[i];
+		ssize_t len;
+
+		if (!iov->iov_len) {
+			continue;
+		}
+
+		len = vtable->recvfrom(obj, iov->iov_base, iov->iov_len, flags,
+				       NULL, NULL);
+		if (len < 0) {
+			return total ? total : -1;
+		}
+
+		total += len;
+
+		/* Peeking would read the same data into every buffer */
+		if (len < iov->iov_len || (flags & ZSOCK_MSG_PEEK)) {
+			break;
+		}
+
+		/* Only wait for the first data, then take what is there */
+		flags |= ZSOCK_MSG_DONTWAIT;
+	}
+
+	return total;
+}
+
+ssize_t zsock_sendmsg_ctx(struct net_context *ctx, const struct msghdr *msg,
+			  int flags)
+{
+	s32_t timeout = K_FOREVER;
+	int status;
+
+	if ((flags & ZSOCK_MSG_DONTWAIT) || sock_is_nonblock(ctx)) {
+		timeout = K_NO_WAIT;
+	}
+
+	/* Register the callback before sending in order to receive the response
+	 * from the peer.
+	 */
+	status = net_context_recv(ctx, zsock_received_cb,
+				  K_NO_WAIT, ctx->user_data);
+	if (status < 0) {
+		errno = -status;
+		return -1;
+	}
+
+	status = net_context_sendmsg(ctx, msg, NULL, timeout, NULL,
+				     ctx->user_data);
+	if (status < 0) {
+		errno = -status;
+		return -1;
+	}
+
+	return status;
+}
+
+ssize_t zsock_recvmsg_ctx(struct net_context *ctx, struct msghdr *msg,
+			  int flags)
+{
+	enum net_sock_type sock_type = net_context_get_type(ctx);
+
+	/* No socket option enables ancillary data yet */
+	msg->msg_controllen = 0;
+
+	if (sock_type == SOCK_DGRAM) {
+		return zsock_recv_dgram(ctx, msg, flags);
+	} else if (sock_type == SOCK_STREAM) {
+		return sock_recvmsg_stream(ctx, &sock_fd_op_vtable, msg, flags);
+	} else {
+		__ASSERT(0, "Unknown socket type");
+	}
+
+	return 0;
+}
+
+ssize_t _impl_zsock_sendmsg(int sock, const struct msghdr *msg, int flags)
+{
+	VTABLE_CALL(sendmsg, sock, msg, flags);
+}
+
+ssize_t _impl_zsock_recvmsg(int sock, struct msghdr *msg, int flags)
+{
+	VTABLE_CALL(recvmsg, sock, msg, flags);
+}
+
+int _impl_zsock_sendmmsg(int sock, struct zsock_mmsghdr *msgvec,
+			 unsigned int vlen, int flags)
+{
+	const struct socket_op_vtable *vtable;
+	unsigned int i;
+	void *ctx;
+
+	ctx = get_sock_vtable(sock, &vtable);
+	if (ctx == NULL) {
+		return -1;
+	}
+
+	for (i = 0; i < vlen; i++) {
+		ssize_t len = vtable->sendmsg(ctx, &msgvec[i].msg_hdr, flags);
+
+		if (len < 0) {
+			/* Only an error if nothing was sent */
+			return i ? i : -1;
+		}
+
+		msgvec[i].msg_len = len;
+	}
+
+	return i;
+}
+
+int _impl_zsock_recvmmsg(int sock, struct zsock_mmsghdr *msgvec,
+			 unsigned int vlen, int flags,
+			 struct zsock_timeval *timeout)
+{
+	const struct socket_op_vtable *vtable;
+	u32_t start = k_uptime_get_32();
+	u32_t timeout_ms = 0U;
+	unsigned int i;
+	void *ctx;
+
+	ctx = get_sock_vtable(sock, &vtable);
+	if (ctx == NULL) {
+		return -1;
+	}
+
+	if (timeout) {
+		timeout_ms = timeout->tv_sec * 1000 + timeout->tv_usec / 1000;
+	}
+
+	for (i = 0; i < vlen; i++) {
+		ssize_t len = vtable->recvmsg(ctx, &msgvec[i].msg_hdr, flags);
+
+		if (len < 0) {
+			/* Only an error if nothing was received */
+			return i ? i : -1;
+		}
+
+		msgvec[i].msg_len = len;
+
+		if (flags & ZSOCK_MSG_WAITFORONE) {
+			flags |= ZSOCK_MSG_DONTWAIT;
+		}
+
+		if (timeout && k_uptime_get_32() - start >= timeout_ms) {
+			return i + 1;
+		}
+	}
+
+	return i;
+}
+
+#ifdef CONFIG_USERSPACE
+struct sock_msg_copy {
+	/* msg_name of the caller */
+	void *name;
+	/* Kernel copy of msg_name */
+	struct sockaddr_storage name_copy;
+};
+
+/* Copy a message header from user mode. msg_name is copied into copy and
+ * the iovec array into memory from the thread's resource pool, the data
+ * buffers are only checked for access. Ancillary data is not passed on.
+ */
+static int sock_msg_from_user(struct msghdr *kmsg, const struct msghdr *umsg,
+			      struct sock_msg_copy *copy, bool write)
+{
+	struct iovec *iov;
+	size_t iov_size;
+	size_t i;
+
+	if (z_user_from_copy(kmsg, (void *)umsg, sizeof(*kmsg))) {
+		return -EFAULT;
+	}
+
+	kmsg->msg_control = NULL;
+	kmsg->msg_controllen = 0;
+
+	copy->name = kmsg->msg_name;
+	if (kmsg->msg_name) {
+		if (write) {
+			/* Never hand back stale kernel stack */
+			(void)memset(&copy->name_copy, 0,
+				     sizeof(copy->name_copy));
+			kmsg->msg_namelen = MIN(kmsg->msg_namelen,
+						sizeof(copy->name_copy));
+			if (Z_SYSCALL_MEMORY_WRITE(kmsg->msg_name,
+						   kmsg->msg_namelen)) {
+				return -EFAULT;
+			}
+		} else {
+			if (kmsg->msg_namelen > sizeof(copy->name_copy)) {
+				return -EINVAL;
+			}
+
+			if (z_user_from_copy(&copy->name_copy, kmsg->msg_name,
+					     kmsg->msg_namelen)) {
+				return -EFAULT;
+			}
+		}
+
+		kmsg->msg_name = &copy->name_copy;
+	}
+
+	if (!kmsg->msg_iovlen) {
+		kmsg->msg_iov = NULL;
+		return 0;
+	}
+
+	if (__builtin_mul_overflow(kmsg->msg_iovlen, sizeof(struct iovec),
+				   &iov_size)) {
+		return -EINVAL;
+	}
+
+	iov = z_user_alloc_from_copy(kmsg->msg_iov, iov_size);
+	if (!iov) {
+		return -ENOMEM;
+	}
+
+	for (i = 0; i < kmsg->msg_iovlen; i++) {
+		if (Z_SYSCALL_MEMORY(iov[i].iov_base, iov[i].iov_len, write)) {
+			k_free(iov);
+			return -EFAULT;
+		}
+	}
+
+	kmsg->msg_iov = iov;
+
+	return 0;
+}
+
+/* Hand the results of a receive back to the caller */
+static int sock_msg_to_user(struct msghdr *umsg, struct msghdr *kmsg,
+			    struct sock_msg_copy *copy)
+{
+	if (copy->name && z_user_to_copy(copy->name, &copy->name_copy,
+					 kmsg->msg_namelen)) {
+		return -EFAULT;
+	}
+
+	if (z_user_to_copy(&umsg->msg_namelen, &kmsg->msg_namelen,
+			   sizeof(kmsg->msg_namelen)) ||
+	    z_user_to_copy(&umsg->msg_controllen, &kmsg->msg_controllen,
+			   sizeof(kmsg->msg_controllen)) ||
+	    z_user_to_copy(&umsg->msg_flags, &kmsg->msg_flags,
+			   sizeof(kmsg->msg_flags))) {
+		return -EFAULT;
+	}
+
+	return 0;
+}
+
+static void sock_mmsg_free(struct zsock_mmsghdr *msgvec, unsigned int vlen)
+{
+	unsigned int i;
+
+	for (i = 0; i < vlen; i++) {
+		k_free(msgvec[i].msg_hdr.msg_iov);
+	}
+
+	k_free(msgvec);
+}
+
+/* Copy a message vector from user mode, with one allocation holding the
+ * kernel message headers followed by their sock_msg_copy.
+ */
+static int sock_mmsg_from_user(struct zsock_mmsghdr **kmsgvec,
+			       struct sock_msg_copy **copies,
+			       struct zsock_mmsghdr *umsgvec,
+			       unsigned int vlen, bool write)
+{
+	struct zsock_mmsghdr *msgvec;
+	size_t size;
+	unsigned int i;
+	int ret;
+
+	*kmsgvec = NULL;
+	*copies = NULL;
+
+	if (!vlen) {
+		return 0;
+	}
+
+	if (__builtin_mul_overflow(vlen, sizeof(struct zsock_mmsghdr) +
+				   sizeof(struct sock_msg_copy), &size)) {
+		return -EINVAL;
+	}
+
+	msgvec = z_thread_malloc(size);
+	if (!msgvec) {
+		return -ENOMEM;
+	}
+
+	for (i = 0; i < vlen; i++) {
+		ret = sock_msg_from_user(&msgvec[i].msg_hdr,
+					 &umsgvec[i].msg_hdr,
+					 (struct sock_msg_copy *)(msgvec + vlen) + i,
+					 write);
+		if (ret < 0) {
+			sock_mmsg_free(msgvec, i);
+			return ret;
+		}
+	}
+
+	*kmsgvec = msgvec;
+	*copies = (struct sock_msg_copy *)(msgvec + vlen);
+
+	return 0;
+}
+
+Z_SYSCALL_HANDLER(zsock_sendmsg, sock, msg, flags)
+{
+	struct sock_msg_copy copy;
+	struct msghdr msg_copy;
+	ssize_t ret;
+
+	ret = sock_msg_from_user(&msg_copy, (struct msghdr *)msg, &copy,
+				 false);
+	if (ret < 0) {
+		errno = -ret;
+		return -1;
+	}
+
+	ret = _impl_zsock_sendmsg(sock, &msg_copy, flags);
+
+	k_free(msg_copy.msg_iov);
+
+	return ret;
+}
+
+Z_SYSCALL_HANDLER(zsock_recvmsg, sock, msg, flags)
+{
+	struct sock_msg_copy copy;
+	struct msghdr msg_copy;
+	ssize_t ret;
+
+	ret = sock_msg_from_user(&msg_copy, (struct msghdr *)msg, &copy,
+				 true);
+	if (ret < 0) {
+		errno = -ret;
+		return -1;
+	}
+
+	ret = _impl_zsock_recvmsg(sock, &msg_copy, flags);
+	if (ret >= 0 &&
+	    sock_msg_to_user((struct msghdr *)msg, &msg_copy, &copy)) {
+		errno = EFAULT;
+		ret = -1;
+	}
+
+	k_free(msg_copy.msg_iov);
+
+	return ret;
+}
+
+Z_SYSCALL_HANDLER(zsock_sendmmsg, sock, msgvec, vlen, flags)
+{
+	struct zsock_mmsghdr *umsgvec = (struct zsock_mmsghdr *)msgvec;
+	struct zsock_mmsghdr *kmsgvec;
+	struct sock_msg_copy *copies;
+	int ret, i;
+
+	ret = sock_mmsg_from_user(&kmsgvec, &copies, umsgvec, vlen, false);
+	if (ret < 0) {
+		errno = -ret;
+		return -1;
+	}
+
+	ret = _impl_zsock_sendmmsg(sock, kmsgvec, vlen, flags);
+
+	for (i = 0; i < ret; i++) {
+		if (z_user_to_copy(&umsgvec[i].msg_len, &kmsgvec[i].msg_len,
+				   sizeof(kmsgvec[i].msg_len))) {
+			errno = EFAULT;
+			ret = -1;
+		}
+	}
+
+	sock_mmsg_free(kmsgvec, vlen);
+
+	return ret;
+}
+
+Z_SYSCALL_HANDLER(zsock_recvmmsg, sock, msgvec, vlen, flags, timeout)
+{
+	struct zsock_mmsghdr *umsgvec = (struct zsock_mmsghdr *)msgvec;
+	struct zsock_timeval timeout_copy;
+	struct zsock_mmsghdr *kmsgvec;
+	struct sock_msg_copy *copies;
+	int ret, i;
+
+	if (timeout && z_user_from_copy(&timeout_copy, (void *)timeout,
+					sizeof(timeout_copy))) {
+		errno = EFAULT;
+		return -1;
+	}
+
+	ret = sock_mmsg_from_user(&kmsgvec, &copies, umsgvec, vlen, true);
+	if (ret < 0) {
+		errno = -ret;
+		return -1;
+	}
+
+	ret = _impl_zsock_recvmmsg(sock, kmsgvec, vlen, flags,
+				   timeout ? &timeout_copy : NULL);
+
+	for (i = 0; i < ret; i++) {
+		if (sock_msg_to_user(&umsgvec[i].msg_hdr,
+				     &kmsgvec[i].msg_hdr, &copies[i]) ||
+		    z_user_to_copy(&umsgvec[i].msg_len, &kmsgvec[i].msg_len,
+				   sizeof(kmsgvec[i].msg_len))) {
+			errno = EFAULT;
+			ret = -1;
+		}
+	}
+
+	sock_mmsg_free(kmsgvec, vlen);
+
+	return ret;
+}
+#endif /* CONFIG_USERSPACE */
+
+#if defined(CONFIG_NET_SOCKETS_ZERO_COPY)
+static struct net_context *zsock_zc_get_ctx(int sock)
+{
+	struct net_context *ctx;
+
+#ifdef CONFIG_USERSPACE
+	/* Packets live in kernel memory, never lend them to user mode */
+	if (_is_user_context()) {
+		errno = EPERM;
+		return NULL;
+	}
+#endif
+
+	ctx = z_get_fd_obj(sock,
+			   (const struct fd_op_vtable *)&sock_fd_op_vtable,
+			   EOPNOTSUPP);
+	if (!ctx) {
+		return NULL;
+	}
+
+	if (net_context_get_ip_proto(ctx) != IPPROTO_UDP &&
+	    net_context_get_ip_proto(ctx) != IPPROTO_TCP) {
+		errno = EOPNOTSUPP;
+		return NULL;
+	}
+
+	return ctx;
+}
+
+ssize_t zsock_recvfrom_zc(int sock, struct net_pkt **pkt, int flags,
+			  struct sockaddr *src_addr, socklen_t *addrlen)
+{
+	struct net_context *ctx;
+	s32_t timeout = K_FOREVER;
+	struct net_pkt *head;
+	size_t recv_len;
+	bool stream;
+
+	ctx = zsock_zc_get_ctx(sock);
+	if (!ctx) {
+		return -1;
+	}
+
+	if (!pkt || (flags & ZSOCK_MSG_PEEK)) {
+		errno = EINVAL;
+		return -1;
+	}
+
+	*pkt = NULL;
+
+	if ((flags & ZSOCK_MSG_DONTWAIT) || sock_is_nonblock(ctx)) {
+		timeout = K_NO_WAIT;
+	}
+
+	stream = net_context_get_type(ctx) == SOCK_STREAM;
+
+	if (stream && sock_is_eof(ctx)) {
+		return 0;
+	}
+
+	/* The wait is cancelled when the peer closes the connection */
+	head = k_fifo_get(&ctx->recv_q, timeout);
+	if (!head) {
+		if (stream && sock_is_eof(ctx)) {
+			return 0;
+		}
+
+		errno = EAGAIN;
+		return -1;
+	}
+
+	if (stream && net_pkt_eof(head)) {
+		sock_set_eof(ctx);
+	}
+
+	if (!stream && src_addr && addrlen) {
+		int rv;
+
+		rv = sock_get_pkt_src_addr(head, net_context_get_ip_proto(ctx),
+					   src_addr, *addrlen);
+		if (rv < 0) {
+			net_pkt_unref(head);
+			errno = -rv;
+			return -1;
+		}
+
+		if (src_addr->sa_family == AF_INET) {
+			*addrlen = sizeof(struct sockaddr_in);
+		} else {
+			*addrlen = sizeof(struct sockaddr_in6);
+		}
+	}
+
+	/* Remember how much was lent, the window is reopened by that
+	 * amount on release whatever the caller did with the cursor.
+	 */
+	recv_len = net_pkt_remaining_data(head);
+	net_pkt_set_appdatalen(head, recv_len);
+	net_pkt_set_token(head, UINT_TO_POINTER(ctx->zc_gen));
+
+	*pkt = head;
+
+	return recv_len;
+}
+
+void zsock_recv_zc_release(int sock, struct net_pkt *pkt)
+{
+	struct net_context *ctx;
+
+	if (!pkt) {
+		return;
+	}
+
+	ctx = zsock_zc_get_ctx(sock);
+
+	/* The socket may be gone already, or its context reused by another
+	 * socket, the buffers are freed anyway.
+	 */
+	if (ctx && net_pkt_context(pkt) == ctx &&
+	    net_pkt_token(pkt) == UINT_TO_POINTER(ctx->zc_gen) &&
+	    net_context_get_type(ctx) == SOCK_STREAM) {
+		net_context_update_recv_wnd(ctx, net_pkt_appdatalen(pkt));
+	}
+
+	net_pkt_unref(pkt);
+}
+
+ssize_t zsock_sendto_zc(int sock, struct net_buf *buf, int flags,
+			const struct sockaddr *dest_addr, socklen_t addrlen)
+{
+	struct net_context *ctx;
+	s32_t timeout = K_FOREVER;
+	int status;
+
+	ctx = zsock_zc_get_ctx(sock);
+	if (!ctx) {
+		return -1;
+	}
+
+	if (!buf) {
+		errno = EINVAL;
+		return -1;
+	}
+
+	if ((flags & ZSOCK_MSG_DONTWAIT) || sock_is_nonblock(ctx)) {
+		timeout = K_NO_WAIT;
+	}
+
+	/* Register the callback before sending in order to receive the response
+	 * from the peer.
+	 */
+	status = net_context_recv(ctx, zsock_received_cb,
+				  K_NO_WAIT, ctx->user_data);
+	if (status < 0) {
+		errno = -status;
+		return -1;
+	}
+
+	if (dest_addr) {
+		status = net_context_sendto_buf(ctx, buf, dest_addr, addrlen,
+						NULL, timeout, NULL,
+						ctx->user_data);
+	} else {
+		status = net_context_send_buf(ctx, buf, NULL, timeout, NULL,
+					      ctx->user_data);
+	}
+
+	if (status < 0) {
+		errno = -status;
+		return -1;
+	}
+
+	return status;
+}
+#endif /* CONFIG_NET_SOCKETS_ZERO_COPY */
+
 /* As this is limited function, we don't follow POSIX signature, with
  * "..." instead of last arg.
  */
@@ -1197,6 +1895,17 @@ static ssize_t sock_recvfrom_vmeth(void *obj, void *buf, size_t max_len,
 				  src_addr, addrlen);
 }
 
+static ssize_t sock_sendmsg_vmeth(void *obj, const struct msghdr *msg,
+				  int flags)
+{
+	return zsock_sendmsg_ctx(obj, msg, flags);
+}
+
+static ssize_t sock_recvmsg_vmeth(void *obj, struct msghdr *msg, int flags)
+{
+	return zsock_recvmsg_ctx(obj, msg, flags);
+}
+
 static int sock_getsockopt_vmeth(void *obj, int level, int optname,
 				 void *optval, socklen_t *optlen)
 {
@@ -1222,6 +1931,8 @@ const struct socket_op_vtable sock_fd_op_vtable = {
 	.accept = sock_accept_vmeth,
 	.sendto = sock_sendto_vmeth,
 	.recvfrom = sock_recvfrom_vmeth,
+	.sendmsg = sock_sendmsg_vmeth,
+	.recvmsg = sock_recvmsg_vmeth,
 	.getsockopt = sock_getsockopt_vmeth,
 	.setsockopt = sock_setsockopt_vmeth,
 };
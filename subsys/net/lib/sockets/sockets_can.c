@@ -64,6 +64,10 @@ int zcan_socket(int family, int type, int proto)
 
 	k_fifo_init(&ctx->recv_q);
 
+#if defined(CONFIG_NET_SOCKETS_EPOLL)
+	sys_slist_init(&ctx->epoll_items);
+#endif
+
 #ifdef CONFIG_USERSPACE
 	/* Set net context object as initialized and grant access to the
 	 * calling thread (and only the calling thread)
@@ -188,14 +192,46 @@ ssize_t zcan_sendto_ctx(struct net_context *ctx, const void *buf, size_t len,
 	return len;
 }
 
-static ssize_t zcan_recvfrom_ctx(struct net_context *ctx, void *buf,
-				 size_t max_len, int flags,
-				 struct sockaddr *src_addr,
-				 socklen_t *addrlen)
+static ssize_t zcan_sendmsg_ctx(struct net_context *ctx,
+				const struct msghdr *msg, int flags)
+{
+	struct sockaddr_can can_addr;
+	struct msghdr can_msg = *msg;
+	s32_t timeout = K_FOREVER;
+	int ret;
+
+	/* As with sendto(), the destination address is ignored and the
+	 * interface set by bind() is used.
+	 */
+	if ((flags & ZSOCK_MSG_DONTWAIT) || sock_is_nonblock(ctx)) {
+		timeout = K_NO_WAIT;
+	}
+
+	memset(&can_addr, 0, sizeof(can_addr));
+
+	can_addr.can_ifindex = -1;
+	can_addr.can_family = AF_CAN;
+
+	can_msg.msg_name = &can_addr;
+	can_msg.msg_namelen = sizeof(can_addr);
+
+	ret = net_context_sendmsg(ctx, &can_msg, NULL, timeout, NULL,
+				  ctx->user_data);
+	if (ret < 0) {
+		errno = -ret;
+		return -1;
+	}
+
+	return net_msghdr_len(msg);
+}
+
+static ssize_t zcan_recvmsg_ctx(struct net_context *ctx, struct msghdr *msg,
+				int flags)
 {
 	size_t recv_len = 0;
 	s32_t timeout = K_FOREVER;
 	struct net_pkt *pkt;
+	size_t max_len;
 
 	if ((flags & ZSOCK_MSG_DONTWAIT) || sock_is_nonblock(ctx)) {
 		timeout = K_NO_WAIT;
@@ -224,12 +260,18 @@ static ssize_t zcan_recvfrom_ctx(struct net_context *ctx, void *buf,
 	/* We do not handle any headers here, just pass the whole packet to
 	 * the caller.
 	 */
+	msg->msg_namelen = 0;
+	msg->msg_flags = 0;
+	msg->msg_controllen = 0;
+	max_len = net_msghdr_len(msg);
+
 	recv_len = net_pkt_get_len(pkt);
 	if (recv_len > max_len) {
 		recv_len = max_len;
+		msg->msg_flags |= ZSOCK_MSG_TRUNC;
 	}
 
-	if (net_pkt_read_new(pkt, buf, recv_len)) {
+	if (sock_pkt_read_msg(pkt, msg, recv_len)) {
 		errno = EIO;
 		return -1;
 	}
@@ -243,6 +285,23 @@ static ssize_t zcan_recvfrom_ctx(struct net_context *ctx, void *buf,
 	return recv_len;
 }
 
+static ssize_t zcan_recvfrom_ctx(struct net_context *ctx, void *buf,
+				 size_t max_len, int flags,
+				 struct sockaddr *src_addr,
+				 socklen_t *addrlen)
+{
+	struct iovec iov = {
+		.iov_base = buf,
+		.iov_len = max_len,
+	};
+	struct msghdr msg = {
+		.msg_iov = &iov,
+		.msg_iovlen = 1,
+	};
+
+	return zcan_recvmsg_ctx(ctx, &msg, flags);
+}
+
 static int zcan_getsockopt_ctx(struct net_context *ctx, int level, int optname,
 			       void *optval, socklen_t *optlen)
 {
@@ -326,6 +385,18 @@ static ssize_t can_sock_recvfrom_vmeth(void *obj, void *buf, size_t max_len,
 				 src_addr, addrlen);
 }
 
+static ssize_t can_sock_sendmsg_vmeth(void *obj, const struct msghdr *msg,
+				      int flags)
+{
+	return zcan_sendmsg_ctx(obj, msg, flags);
+}
+
+static ssize_t can_sock_recvmsg_vmeth(void *obj, struct msghdr *msg,
+				      int flags)
+{
+	return zcan_recvmsg_ctx(obj, msg, flags);
+}
+
 static int can_sock_getsockopt_vmeth(void *obj, int level, int optname,
 				     void *optval, socklen_t *optlen)
 {
@@ -396,6 +467,8 @@ static const struct socket_op_vtable can_sock_fd_op_vtable = {
 	.accept = can_sock_accept_vmeth,
 	.sendto = can_sock_sendto_vmeth,
 	.recvfrom = can_sock_recvfrom_vmeth,
+	.sendmsg = can_sock_sendmsg_vmeth,
+	.recvmsg = can_sock_recvmsg_vmeth,
 	.getsockopt = can_sock_getsockopt_vmeth,
 	.setsockopt = can_sock_setsockopt_vmeth,
 };
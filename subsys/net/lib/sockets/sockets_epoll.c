@@ -0,0 +1,597 @@
+/*
+ * Copyright (c) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/* Epoll-like readiness notification for sockets.
+ *
+ * An epoll instance keeps its interest list across calls. Each entry is
+ * linked both to the instance and to the watched socket, so the socket
+ * receive and accept callbacks can queue it on the ready list of the
+ * instance directly. zsock_epoll_wait() then only visits ready entries,
+ * instead of re-arming every socket like zsock_poll() does.
+ */
+
+#include <logging/log.h>
+LOG_MODULE_REGISTER(net_sock_epoll, CONFIG_NET_SOCKETS_LOG_LEVEL);
+
+#include <kernel.h>
+#include <init.h>
+#include <spinlock.h>
+#include <misc/dlist.h>
+#include <misc/slist.h>
+#include <net/net_context.h>
+#include <net/socket.h>
+#include <syscall_handler.h>
+#include <misc/fdtable.h>
+
+#include "sockets_internal.h"
+
+extern const struct socket_op_vtable sock_fd_op_vtable;
+
+struct epoll_instance;
+
+struct epoll_item {
+	/** Entry in the list of the watched socket */
+	sys_snode_t ctx_node;
+	/** Entry in the interest list of the instance */
+	sys_snode_t ep_node;
+	/** Entry in the ready list of the instance, linked while queued */
+	sys_dnode_t ready_node;
+	struct epoll_instance *ep;
+	struct net_context *ctx;
+	u32_t events;
+	zsock_epoll_data_t data;
+};
+
+struct epoll_instance {
+	sys_slist_t items;
+	sys_dlist_t ready;
+	/** Given once per waiter when an entry is queued on the ready list
+	 * or the instance is closed.  Initialized once, as a thread of a
+	 * closed instance may still be on its way out of it.
+	 */
+	struct k_sem ready_sem;
+	/** Number of threads waiting on ready_sem */
+	u32_t waiters;
+	/** Bumped on close, so that waiters notice even if the slot is
+	 * already in use again
+	 */
+	u32_t gen;
+	bool in_use;
+};
+
+static struct epoll_instance epoll_instances[CONFIG_NET_SOCKETS_EPOLL_MAX];
+
+K_MEM_SLAB_DEFINE(epoll_item_slab, sizeof(struct epoll_item),
+		  CONFIG_NET_SOCKETS_EPOLL_MAX_ITEMS, 4);
+
+static int epoll_init(struct device *dev)
+{
+	ARG_UNUSED(dev);
+
+	for (int i = 0; i < ARRAY_SIZE(epoll_instances); i++) {
+		k_sem_init(&epoll_instances[i].ready_sem, 0, UINT_MAX);
+	}
+
+	return 0;
+}
+
+SYS_INIT(epoll_init, APPLICATION, CONFIG_KERNEL_INIT_PRIORITY_DEFAULT);
+
+static const struct fd_op_vtable epoll_fd_op_vtable;
+
+/* The instances, their ready lists and the per-socket lists are updated
+ * from the network receive path, so they are protected with a spinlock.
+ */
+static struct k_spinlock epoll_lock;
+
+/* Called with epoll_lock held */
+static void epoll_wake_all(struct epoll_instance *ep)
+{
+	for (; ep->waiters > 0U; ep->waiters--) {
+		k_sem_give(&ep->ready_sem);
+	}
+}
+
+/* Called with epoll_lock held */
+static void epoll_item_queue(struct epoll_item *item)
+{
+	if (!sys_dnode_is_linked(&item->ready_node)) {
+		sys_dlist_append(&item->ep->ready, &item->ready_node);
+		epoll_wake_all(item->ep);
+	}
+}
+
+/* Called with epoll_lock held, the caller frees the item once unlocked */
+static void epoll_item_unlink(struct epoll_item *item)
+{
+	sys_slist_find_and_remove(&item->ctx->epoll_items, &item->ctx_node);
+	sys_slist_find_and_remove(&item->ep->items, &item->ep_node);
+	if (sys_dnode_is_linked(&item->ready_node)) {
+		sys_dlist_remove(&item->ready_node);
+	}
+}
+
+static u32_t epoll_item_revents(struct epoll_item *item)
+{
+	u32_t revents = 0U;
+
+	if ((item->events & ZSOCK_EPOLLIN) &&
+	    (!k_fifo_is_empty(&item->ctx->recv_q) || sock_is_eof(item->ctx))) {
+		revents |= ZSOCK_EPOLLIN;
+	}
+
+	/* As with poll(), assume that socket is always writable */
+	if (item->events & ZSOCK_EPOLLOUT) {
+		revents |= ZSOCK_EPOLLOUT;
+	}
+
+	return revents;
+}
+
+void sock_epoll_notify(struct net_context *ctx)
+{
+	struct epoll_item *item;
+	k_spinlock_key_t key = k_spin_lock(&epoll_lock);
+
+	SYS_SLIST_FOR_EACH_CONTAINER(&ctx->epoll_items, item, ctx_node) {
+		if (item->events & ZSOCK_EPOLLIN) {
+			epoll_item_queue(item);
+		}
+	}
+
+	k_spin_unlock(&epoll_lock, key);
+}
+
+void sock_epoll_release(struct net_context *ctx)
+{
+	struct epoll_item *item;
+	sys_snode_t *node;
+	k_spinlock_key_t key;
+
+	/* Closing a socket removes it from all the interest lists */
+	for (;;) {
+		key = k_spin_lock(&epoll_lock);
+
+		node = sys_slist_peek_head(&ctx->epoll_items);
+		if (node != NULL) {
+			item = CONTAINER_OF(node, struct epoll_item, ctx_node);
+			epoll_item_unlink(item);
+		}
+
+		k_spin_unlock(&epoll_lock, key);
+
+		if (node == NULL) {
+			break;
+		}
+
+		k_mem_slab_free(&epoll_item_slab, (void **)&item);
+	}
+}
+
+static struct epoll_item *epoll_item_find(struct epoll_instance *ep,
+					  struct net_context *ctx)
+{
+	struct epoll_item *item;
+
+	SYS_SLIST_FOR_EACH_CONTAINER(&ctx->epoll_items, item, ctx_node) {
+		if (item->ep == ep) {
+			return item;
+		}
+	}
+
+	return NULL;
+}
+
+static int epoll_close(struct epoll_instance *ep)
+{
+	struct epoll_item *item;
+	sys_snode_t *node;
+	k_spinlock_key_t key;
+
+	for (;;) {
+		key = k_spin_lock(&epoll_lock);
+
+		node = sys_slist_peek_head(&ep->items);
+		if (node != NULL) {
+			item = CONTAINER_OF(node, struct epoll_item, ep_node);
+			epoll_item_unlink(item);
+		}
+
+		k_spin_unlock(&epoll_lock, key);
+
+		if (node == NULL) {
+			break;
+		}
+
+		k_mem_slab_free(&epoll_item_slab, (void **)&item);
+	}
+
+	/* Wake up the threads still waiting, they see the instance gone */
+	key = k_spin_lock(&epoll_lock);
+	ep->in_use = false;
+	ep->gen++;
+	epoll_wake_all(ep);
+	k_spin_unlock(&epoll_lock, key);
+
+	return 0;
+}
+
+static ssize_t epoll_read_vmeth(void *obj, void *buffer, size_t count)
+{
+	ARG_UNUSED(obj);
+	ARG_UNUSED(buffer);
+	ARG_UNUSED(count);
+
+	errno = EINVAL;
+	return -1;
+}
+
+static ssize_t epoll_write_vmeth(void *obj, const void *buffer, size_t count)
+{
+	ARG_UNUSED(obj);
+	ARG_UNUSED(buffer);
+	ARG_UNUSED(count);
+
+	errno = EINVAL;
+	return -1;
+}
+
+static int epoll_ioctl_vmeth(void *obj, unsigned int request, va_list args)
+{
+	ARG_UNUSED(args);
+
+	switch (request) {
+	case ZFD_IOCTL_CLOSE:
+		return epoll_close(obj);
+
+	default:
+		errno = EOPNOTSUPP;
+		return -1;
+	}
+}
+
+static const struct fd_op_vtable epoll_fd_op_vtable = {
+	.read = epoll_read_vmeth,
+	.write = epoll_write_vmeth,
+	.ioctl = epoll_ioctl_vmeth,
+};
+
+int _impl_zsock_epoll_create1(int flags)
+{
+	struct epoll_instance *ep = NULL;
+	k_spinlock_key_t key;
+	int fd;
+	int i;
+
+	if (flags != 0) {
+		errno = EINVAL;
+		return -1;
+	}
+
+	fd = z_reserve_fd();
+	if (fd < 0) {
+		return -1;
+	}
+
+	key = k_spin_lock(&epoll_lock);
+
+	for (i = 0; i < ARRAY_SIZE(epoll_instances); i++) {
+		if (!epoll_instances[i].in_use) {
+			ep = &epoll_instances[i];
+			ep->in_use = true;
+			sys_slist_init(&ep->items);
+			sys_dlist_init(&ep->ready);
+			break;
+		}
+	}
+
+	k_spin_unlock(&epoll_lock, key);
+
+	if (ep == NULL) {
+		z_free_fd(fd);
+		errno = ENOMEM;
+		return -1;
+	}
+
+	z_finalize_fd(fd, ep, &epoll_fd_op_vtable);
+
+	return fd;
+}
+
+#ifdef CONFIG_USERSPACE
+Z_SYSCALL_HANDLER(zsock_epoll_create1, flags)
+{
+	return _impl_zsock_epoll_create1(flags);
+}
+#endif /* CONFIG_USERSPACE */
+
+static int epoll_add(struct epoll_instance *ep, struct net_context *ctx,
+		     const struct zsock_epoll_event *event)
+{
+	struct epoll_item *item;
+	k_spinlock_key_t key;
+
+	if (k_mem_slab_alloc(&epoll_item_slab, (void **)&item, K_NO_WAIT)) {
+		errno = ENOMEM;
+		return -1;
+	}
+
+	item->ep = ep;
+	item->ctx = ctx;
+	item->events = event->events;
+	item->data = event->data;
+	sys_dnode_init(&item->ready_node);
+
+	key = k_spin_lock(&epoll_lock);
+
+	if (epoll_item_find(ep, ctx) != NULL) {
+		k_spin_unlock(&epoll_lock, key);
+		k_mem_slab_free(&epoll_item_slab, (void **)&item);
+		errno = EEXIST;
+		return -1;
+	}
+
+	sys_slist_append(&ctx->epoll_items, &item->ctx_node);
+	sys_slist_append(&ep->items, &item->ep_node);
+
+	/* Report the current state, later changes come from the callbacks */
+	if (epoll_item_revents(item)) {
+		epoll_item_queue(item);
+	}
+
+	k_spin_unlock(&epoll_lock, key);
+
+	return 0;
+}
+
+static int epoll_mod(struct epoll_instance *ep, struct net_context *ctx,
+		     const struct zsock_epoll_event *event)
+{
+	struct epoll_item *item;
+	k_spinlock_key_t key = k_spin_lock(&epoll_lock);
+
+	item = epoll_item_find(ep, ctx);
+	if (item == NULL) {
+		k_spin_unlock(&epoll_lock, key);
+		errno = ENOENT;
+		return -1;
+	}
+
+	item->events = event->events;
+	item->data = event->data;
+
+	if (epoll_item_revents(item)) {
+		epoll_item_queue(item);
+	}
+
+	k_spin_unlock(&epoll_lock, key);
+
+	return 0;
+}
+
+static int epoll_del(struct epoll_instance *ep, struct net_context *ctx)
+{
+	struct epoll_item *item;
+	k_spinlock_key_t key = k_spin_lock(&epoll_lock);
+
+	item = epoll_item_find(ep, ctx);
+	if (item != NULL) {
+		epoll_item_unlink(item);
+	}
+
+	k_spin_unlock(&epoll_lock, key);
+
+	if (item == NULL) {
+		errno = ENOENT;
+		return -1;
+	}
+
+	k_mem_slab_free(&epoll_item_slab, (void **)&item);
+
+	return 0;
+}
+
+int _impl_zsock_epoll_ctl(int epfd, int op, int fd,
+			  struct zsock_epoll_event *event)
+{
+	struct epoll_instance *ep;
+	struct net_context *ctx;
+
+	ep = z_get_fd_obj(epfd, &epoll_fd_op_vtable, EINVAL);
+	if (ep == NULL) {
+		return -1;
+	}
+
+	/* Readiness is tracked for native sockets only */
+	ctx = z_get_fd_obj(fd, (const struct fd_op_vtable *)&sock_fd_op_vtable,
+			   EPERM);
+	if (ctx == NULL) {
+		return -1;
+	}
+
+	if (op != ZSOCK_EPOLL_CTL_DEL && event == NULL) {
+		errno = EFAULT;
+		return -1;
+	}
+
+	switch (op) {
+	case ZSOCK_EPOLL_CTL_ADD:
+		return epoll_add(ep, ctx, event);
+
+	case ZSOCK_EPOLL_CTL_MOD:
+		return epoll_mod(ep, ctx, event);
+
+	case ZSOCK_EPOLL_CTL_DEL:
+		return epoll_del(ep, ctx);
+
+	default:
+		errno = EINVAL;
+		return -1;
+	}
+}
+
+#ifdef CONFIG_USERSPACE
+Z_SYSCALL_HANDLER(zsock_epoll_ctl, epfd, op, fd, event)
+{
+	struct zsock_epoll_event event_copy;
+
+	if (op == ZSOCK_EPOLL_CTL_DEL || !event) {
+		return _impl_zsock_epoll_ctl(epfd, op, fd, NULL);
+	}
+
+	Z_OOPS(z_user_from_copy(&event_copy, (void *)event,
+				sizeof(event_copy)));
+
+	return _impl_zsock_epoll_ctl(epfd, op, fd, &event_copy);
+}
+#endif /* CONFIG_USERSPACE */
+
+static int epoll_collect(struct epoll_instance *ep,
+			 struct zsock_epoll_event *events, int maxevents)
+{
+	sys_dlist_t requeue;
+	sys_dnode_t *node;
+	k_spinlock_key_t key;
+	int count = 0;
+
+	sys_dlist_init(&requeue);
+
+	key = k_spin_lock(&epoll_lock);
+
+	while (count < maxevents && (node = sys_dlist_get(&ep->ready))) {
+		struct epoll_item *item = CONTAINER_OF(node, struct epoll_item,
+						       ready_node);
+		u32_t revents = epoll_item_revents(item);
+
+		/* Already drained, it is queued again on new data */
+		if (!revents) {
+			continue;
+		}
+
+		events[count].events = revents;
+		events[count].data = item->data;
+		count++;
+
+		if (item->events & ZSOCK_EPOLLONESHOT) {
+			/* Disabled until rearmed with ZSOCK_EPOLL_CTL_MOD */
+			item->events &= ~(ZSOCK_EPOLLIN | ZSOCK_EPOLLOUT);
+		} else if (!(item->events & ZSOCK_EPOLLET)) {
+			/* Level-triggered entries stay ready until drained,
+			 * move them behind the others for fairness.
+			 */
+			sys_dlist_append(&requeue, node);
+		}
+	}
+
+	while ((node = sys_dlist_get(&requeue)) != NULL) {
+		sys_dlist_append(&ep->ready, node);
+	}
+
+	k_spin_unlock(&epoll_lock, key);
+
+	return count;
+}
+
+int _impl_zsock_epoll_wait(int epfd, struct zsock_epoll_event *events,
+			   int maxevents, int timeout)
+{
+	struct epoll_instance *ep;
+	u32_t start = k_uptime_get_32();
+	s32_t remaining = timeout;
+	k_spinlock_key_t key;
+	u32_t gen;
+	int count;
+	int ret;
+
+	ep = z_get_fd_obj(epfd, &epoll_fd_op_vtable, EINVAL);
+	if (ep == NULL) {
+		return -1;
+	}
+
+	key = k_spin_lock(&epoll_lock);
+	gen = ep->gen;
+	k_spin_unlock(&epoll_lock, key);
+
+	if (maxevents <= 0) {
+		errno = EINVAL;
+		return -1;
+	}
+
+	if (timeout < 0) {
+		timeout = K_FOREVER;
+		remaining = K_FOREVER;
+	}
+
+	for (;;) {
+		count = epoll_collect(ep, events, maxevents);
+		if (count > 0 || timeout == K_NO_WAIT) {
+			return count;
+		}
+
+		key = k_spin_lock(&epoll_lock);
+
+		if (ep->gen != gen) {
+			k_spin_unlock(&epoll_lock, key);
+			errno = EBADF;
+			return -1;
+		}
+
+		/* Queued since it was collected, no need to wait */
+		if (!sys_dlist_is_empty(&ep->ready)) {
+			k_spin_unlock(&epoll_lock, key);
+			continue;
+		}
+
+		ep->waiters++;
+		k_spin_unlock(&epoll_lock, key);
+
+		ret = k_sem_take(&ep->ready_sem, remaining);
+
+		key = k_spin_lock(&epoll_lock);
+
+		if (ep->gen != gen) {
+			k_spin_unlock(&epoll_lock, key);
+			errno = EBADF;
+			return -1;
+		}
+
+		if (ret != 0) {
+			/* Unless a wakeup raced with the timeout, we are
+			 * still counted.  A give left over only causes a
+			 * spurious wakeup.
+			 */
+			if (k_sem_take(&ep->ready_sem, K_NO_WAIT) != 0 &&
+			    ep->waiters > 0U) {
+				ep->waiters--;
+			}
+
+			k_spin_unlock(&epoll_lock, key);
+			return 0;
+		}
+
+		k_spin_unlock(&epoll_lock, key);
+
+		if (timeout != K_FOREVER) {
+			remaining = timeout - (s32_t)(k_uptime_get_32() - start);
+			if (remaining <= 0) {
+				remaining = K_NO_WAIT;
+			}
+		}
+	}
+}
+
+#ifdef CONFIG_USERSPACE
+Z_SYSCALL_HANDLER(zsock_epoll_wait, epfd, events, maxevents, timeout)
+{
+	if (maxevents > 0) {
+		Z_OOPS(Z_SYSCALL_MEMORY_ARRAY_WRITE(events, maxevents,
+					sizeof(struct zsock_epoll_event)));
+	}
+
+	return _impl_zsock_epoll_wait(epfd, (struct zsock_epoll_event *)events,
+				      maxevents, timeout);
+}
+#endif /* CONFIG_USERSPACE */
@@ -41,12 +41,42 @@ struct socket_op_vtable {
 			  const struct sockaddr *dest_addr, socklen_t addrlen);
 	ssize_t (*recvfrom)(void *obj, void *buf, size_t max_len, int flags,
 			    struct sockaddr *src_addr, socklen_t *addrlen);
+	ssize_t (*sendmsg)(void *obj, const struct msghdr *msg, int flags);
+	ssize_t (*recvmsg)(void *obj, struct msghdr *msg, int flags);
 	int (*getsockopt)(void *obj, int level, int optname,
 			  void *optval, socklen_t *optlen);
 	int (*setsockopt)(void *obj, int level, int optname,
 			  const void *optval, socklen_t optlen);
 };
 
+/* Helpers for implementing sendmsg() and recvmsg() on top of sendto()
+ * and recvfrom() of a stream socket, one buffer at a time.
+ */
+ssize_t sock_sendmsg_stream(void *obj, const struct socket_op_vtable *vtable,
+			    const struct msghdr *msg, int flags);
+ssize_t sock_recvmsg_stream(void *obj, const struct socket_op_vtable *vtable,
+			    struct msghdr *msg, int flags);
+
+/* Copy up to len bytes from the cursor of pkt into the buffers of msg */
+int sock_pkt_read_msg(struct net_pkt *pkt, struct msghdr *msg, size_t len);
+
+#if defined(CONFIG_NET_SOCKETS_EPOLL)
+/* Queue the epoll entries watching ctx, called when it becomes readable */
+void sock_epoll_notify(struct net_context *ctx);
+/* Drop ctx from all the epoll interest lists, called when it is closed */
+void sock_epoll_release(struct net_context *ctx);
+#else
+static inline void sock_epoll_notify(struct net_context *ctx)
+{
+	ARG_UNUSED(ctx);
+}
+
+static inline void sock_epoll_release(struct net_context *ctx)
+{
+	ARG_UNUSED(ctx);
+}
+#endif /* CONFIG_NET_SOCKETS_EPOLL */
+
 int ztls_socket(int family, int type, int proto);
 
 int zpacket_socket(int family, int type, int proto);
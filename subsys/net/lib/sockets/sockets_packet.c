@@ -65,6 +65,10 @@ int zpacket_socket(int family, int type, int proto)
 	/* recv_q and accept_q are in union */
 	k_fifo_init(&ctx->recv_q);
 
+#if defined(CONFIG_NET_SOCKETS_EPOLL)
+	sys_slist_init(&ctx->epoll_items);
+#endif
+
 #ifdef CONFIG_USERSPACE
 	/* Set net context object as initialized and grant access to the
 	 * calling thread (and only the calling thread)
@@ -177,13 +181,45 @@ ssize_t zpacket_sendto_ctx(struct net_context *ctx, const void *buf, size_t len,
 	return status;
 }
 
-ssize_t zpacket_recvfrom_ctx(struct net_context *ctx, void *buf, size_t max_len,
-			     int flags, struct sockaddr *src_addr,
-			     socklen_t *addrlen)
+ssize_t zpacket_sendmsg_ctx(struct net_context *ctx, const struct msghdr *msg,
+			    int flags)
+{
+	s32_t timeout = K_FOREVER;
+	int status;
+
+	if (!msg->msg_name) {
+		errno = EDESTADDRREQ;
+		return -1;
+	}
+
+	if ((flags & ZSOCK_MSG_DONTWAIT) || sock_is_nonblock(ctx)) {
+		timeout = K_NO_WAIT;
+	}
+
+	status = net_context_recv(ctx, zpacket_received_cb, K_NO_WAIT,
+				  ctx->user_data);
+	if (status < 0) {
+		errno = -status;
+		return -1;
+	}
+
+	status = net_context_sendmsg(ctx, msg, NULL, timeout, NULL,
+				     ctx->user_data);
+	if (status < 0) {
+		errno = -status;
+		return -1;
+	}
+
+	return status;
+}
+
+ssize_t zpacket_recvmsg_ctx(struct net_context *ctx, struct msghdr *msg,
+			    int flags)
 {
 	size_t recv_len = 0;
 	s32_t timeout = K_FOREVER;
 	struct net_pkt *pkt;
+	size_t max_len;
 
 	if ((flags & ZSOCK_MSG_DONTWAIT) || sock_is_nonblock(ctx)) {
 		timeout = K_NO_WAIT;
@@ -212,12 +248,18 @@ ssize_t zpacket_recvfrom_ctx(struct net_context *ctx, void *buf, size_t max_len,
 	/* We do not handle any headers here,
 	 * just pass the whole packet to caller.
 	 */
+	msg->msg_namelen = 0;
+	msg->msg_flags = 0;
+	msg->msg_controllen = 0;
+	max_len = net_msghdr_len(msg);
+
 	recv_len = net_pkt_get_len(pkt);
 	if (recv_len > max_len) {
 		recv_len = max_len;
+		msg->msg_flags |= ZSOCK_MSG_TRUNC;
 	}
 
-	if (net_pkt_read_new(pkt, buf, recv_len)) {
+	if (sock_pkt_read_msg(pkt, msg, recv_len)) {
 		errno = ENOBUFS;
 		return -1;
 	}
@@ -231,6 +273,22 @@ ssize_t zpacket_recvfrom_ctx(struct net_context *ctx, void *buf, size_t max_len,
 	return recv_len;
 }
 
+ssize_t zpacket_recvfrom_ctx(struct net_context *ctx, void *buf, size_t max_len,
+			     int flags, struct sockaddr *src_addr,
+			     socklen_t *addrlen)
+{
+	struct iovec iov = {
+		.iov_base = buf,
+		.iov_len = max_len,
+	};
+	struct msghdr msg = {
+		.msg_iov = &iov,
+		.msg_iovlen = 1,
+	};
+
+	return zpacket_recvmsg_ctx(ctx, &msg, flags);
+}
+
 int zpacket_getsockopt_ctx(struct net_context *ctx, int level, int optname,
 			   void *optval, socklen_t *optlen)
 {
@@ -315,6 +373,18 @@ static ssize_t packet_sock_recvfrom_vmeth(void *obj, void *buf, size_t max_len,
 				    src_addr, addrlen);
 }
 
+static ssize_t packet_sock_sendmsg_vmeth(void *obj, const struct msghdr *msg,
+					 int flags)
+{
+	return zpacket_sendmsg_ctx(obj, msg, flags);
+}
+
+static ssize_t packet_sock_recvmsg_vmeth(void *obj, struct msghdr *msg,
+					 int flags)
+{
+	return zpacket_recvmsg_ctx(obj, msg, flags);
+}
+
 static int packet_sock_getsockopt_vmeth(void *obj, int level, int optname,
 					void *optval, socklen_t *optlen)
 {
@@ -339,6 +409,8 @@ static const struct socket_op_vtable packet_sock_fd_op_vtable = {
 	.accept = packet_sock_accept_vmeth,
 	.sendto = packet_sock_sendto_vmeth,
 	.recvfrom = packet_sock_recvfrom_vmeth,
+	.sendmsg = packet_sock_sendmsg_vmeth,
+	.recvmsg = packet_sock_recvmsg_vmeth,
 	.getsockopt = packet_sock_getsockopt_vmeth,
 	.setsockopt = packet_sock_setsockopt_vmeth,
 };
@@ -1139,6 +1139,10 @@ int ztls_socket(int family, int type, int proto)
 	/* recv_q and accept_q are in union */
 	k_fifo_init(&ctx->recv_q);
 
+#if defined(CONFIG_NET_SOCKETS_EPOLL)
+	sys_slist_init(&ctx->epoll_items);
+#endif
+
 #ifdef CONFIG_USERSPACE
 	/* Set net context object as initialized and grant access to the
 	 * calling thread (and only the calling thread)
@@ -1838,6 +1842,52 @@ int ztls_setsockopt_ctx(struct net_context *ctx, int level, int optname,
 	return 0;
 }
 
+ssize_t ztls_sendmsg_ctx(struct net_context *ctx, const struct msghdr *msg,
+			 int flags)
+{
+	/* TLS */
+	if (net_context_get_type(ctx) == SOCK_STREAM) {
+		return sock_sendmsg_stream(ctx, &tls_sock_fd_op_vtable, msg,
+					   flags);
+	}
+
+	/* DTLS, a record has to be written at once and cannot be gathered
+	 * from several buffers.
+	 */
+	if (msg->msg_iovlen != 1) {
+		errno = EMSGSIZE;
+		return -1;
+	}
+
+	return ztls_sendto_ctx(ctx, msg->msg_iov[0].iov_base,
+			       msg->msg_iov[0].iov_len, flags,
+			       msg->msg_name, msg->msg_namelen);
+}
+
+ssize_t ztls_recvmsg_ctx(struct net_context *ctx, struct msghdr *msg,
+			 int flags)
+{
+	/* TLS */
+	if (net_context_get_type(ctx) == SOCK_STREAM) {
+		return sock_recvmsg_stream(ctx, &tls_sock_fd_op_vtable, msg,
+					   flags);
+	}
+
+	/* DTLS, a record is decrypted into a single buffer */
+	if (msg->msg_iovlen != 1) {
+		errno = EINVAL;
+		return -1;
+	}
+
+	msg->msg_flags = 0;
+	msg->msg_controllen = 0;
+
+	return ztls_recvfrom_ctx(ctx, msg->msg_iov[0].iov_base,
+				 msg->msg_iov[0].iov_len, flags,
+				 msg->msg_name,
+				 msg->msg_name ? &msg->msg_namelen : NULL);
+}
+
 static ssize_t tls_sock_read_vmeth(void *obj, void *buffer, size_t count)
 {
 	return ztls_recvfrom_ctx(obj, buffer, count, 0, NULL, 0);
@@ -1929,6 +1979,18 @@ static ssize_t tls_sock_recvfrom_vmeth(void *obj, void *buf, size_t max_len,
 				 src_addr, addrlen);
 }
 
+static ssize_t tls_sock_sendmsg_vmeth(void *obj, const struct msghdr *msg,
+				      int flags)
+{
+	return ztls_sendmsg_ctx(obj, msg, flags);
+}
+
+static ssize_t tls_sock_recvmsg_vmeth(void *obj, struct msghdr *msg,
+				      int flags)
+{
+	return ztls_recvmsg_ctx(obj, msg, flags);
+}
+
 static int tls_sock_getsockopt_vmeth(void *obj, int level, int optname,
 				     void *optval, socklen_t *optlen)
 {
@@ -1954,6 +2016,8 @@ static const struct socket_op_vtable tls_sock_fd_op_vtable = {
 	.accept = tls_sock_accept_vmeth,
 	.sendto = tls_sock_sendto_vmeth,
 	.recvfrom = tls_sock_recvfrom_vmeth,
+	.sendmsg = tls_sock_sendmsg_vmeth,
+	.recvmsg = tls_sock_recvmsg_vmeth,
 	.getsockopt = tls_sock_getsockopt_vmeth,
 	.setsockopt = tls_sock_setsockopt_vmeth,
 };
@@ -13,6 +13,9 @@
 #include <misc/stack.h>
 #include <string.h>
 #include <device.h>
+#ifdef CONFIG_TRACING_CPU_STATS_THREADS
+#include <tracing_cpu_stats.h>
+#endif
 
 static int cmd_kernel_version(const struct shell *shell,
 			      size_t argc, char **argv)
@@ -51,16 +54,29 @@ static int cmd_kernel_cycles(const struct shell *shell,
 	return 0;
 }
 
-#if defined(CONFIG_INIT_STACKS) && defined(CONFIG_THREAD_MONITOR) \
-				&& defined(CONFIG_THREAD_STACK_INFO)
+#if (defined(CONFIG_INIT_STACKS) || defined(CONFIG_STACK_USAGE_MONITOR)) \
+	&& defined(CONFIG_THREAD_MONITOR) && defined(CONFIG_THREAD_STACK_INFO)
+/* Unused stack space, exact when stacks are painted, otherwise derived
+ * from the sampled high-water mark.
+ */
+static unsigned int shell_stack_unused(const struct k_thread *thread)
+{
+#if defined(CONFIG_INIT_STACKS)
+	return stack_unused_space_get((char *)thread->stack_info.start,
+				      thread->stack_info.size);
+#else
+	return thread->stack_info.size -
+		k_thread_stack_usage_get((k_tid_t)thread);
+#endif
+}
+
 static void shell_tdata_dump(const struct k_thread *thread, void *user_data)
 {
 	unsigned int pcnt, unused = 0U;
 	unsigned int size = thread->stack_info.size;
 	const char *tname;
 
-	unused = stack_unused_space_get((char *)thread->stack_info.start,
-					size);
+	unused = shell_stack_unused(thread);
 
 	/* Calculate the real size reserved for the stack */
 	pcnt = ((size - unused) * 100) / size;
@@ -100,8 +116,7 @@ static void shell_stack_dump(const struct k_thread *thread, void *user_data)
 	const char *tname;
 
 	tname = k_thread_name_get((struct k_thread *)thread);
-	unused = stack_unused_space_get((char *)thread->stack_info.start,
-					size);
+	unused = shell_stack_unused(thread);
 
 	/* Calculate the real size reserved for the stack */
 	pcnt = ((size - unused) * 100) / size;
@@ -111,6 +126,11 @@ static void shell_stack_dump(const struct k_thread *thread, void *user_data)
 		      (u32_t)thread,
 		      tname ? tname : "NA",
 		      size, unused, size - unused, size, pcnt);
+#if defined(CONFIG_INIT_STACKS) && defined(CONFIG_STACK_USAGE_MONITOR)
+	shell_fprintf((const struct shell *)user_data, SHELL_NORMAL,
+		      "\tsampled usage %u\n",
+		      (unsigned int)k_thread_stack_usage_get((k_tid_t)thread));
+#endif
 }
 
 static int cmd_kernel_stacks(const struct shell *shell,
@@ -119,6 +139,72 @@ static int cmd_kernel_stacks(const struct shell *shell,
 	ARG_UNUSED(argc);
 	ARG_UNUSED(argv);
 	k_thread_foreach(shell_stack_dump, (void *)shell);
+#if defined(CONFIG_STACK_USAGE_MONITOR)
+	for (int i = 0; i < CONFIG_MP_NUM_CPUS; i++) {
+		unsigned int used = k_isr_stack_usage_get(i);
+
+		shell_fprintf(shell, SHELL_NORMAL,
+			"ISR stack %d (real size %u):\tsampled usage %u / %u "
+			"(%u %%)\n", i, CONFIG_ISR_STACK_SIZE, used,
+			CONFIG_ISR_STACK_SIZE,
+			(used * 100U) / CONFIG_ISR_STACK_SIZE);
+	}
+#endif
+	return 0;
+}
+#endif
+
+#if defined(CONFIG_TRACING_CPU_STATS_THREADS)
+static void shell_runtime_dump(const struct k_thread *thread, void *user_data)
+{
+	const struct shell *shell = (const struct shell *)user_data;
+	struct k_thread_runtime_stats stats;
+	const char *tname;
+	int i;
+
+	tname = k_thread_name_get((struct k_thread *)thread);
+	cpu_stats_thread_get((k_tid_t)thread, &stats);
+
+	shell_fprintf(shell, SHELL_NORMAL, "%s%p %-10s\n",
+		      (thread == k_current_get()) ? "*" : " ",
+		      thread, tname ? tname : "NA");
+	shell_fprintf(shell, SHELL_NORMAL,
+		      "\truntime %u us, switched in %u times\n",
+		      (u32_t)(SYS_CLOCK_HW_CYCLES_TO_NS64(stats.cycles) /
+			      1000),
+		      stats.switches);
+	shell_fprintf(shell, SHELL_NORMAL, "\tready latency (us):");
+	for (i = 0; i < K_THREAD_LATENCY_BUCKETS; i++) {
+		if (stats.latency[i] != 0U) {
+			shell_fprintf(shell, SHELL_NORMAL, " %s%u:%u",
+				      i == K_THREAD_LATENCY_BUCKETS - 1 ?
+				      ">=" : "<",
+				      i == K_THREAD_LATENCY_BUCKETS - 1 ?
+				      1U << i : 2U << i,
+				      stats.latency[i]);
+		}
+	}
+	shell_fprintf(shell, SHELL_NORMAL, "\n\n");
+}
+
+static void shell_runtime_reset(const struct k_thread *thread,
+				void *user_data)
+{
+	ARG_UNUSED(user_data);
+
+	cpu_stats_thread_reset((k_tid_t)thread);
+}
+
+static int cmd_kernel_runtime(const struct shell *shell,
+			      size_t argc, char **argv)
+{
+	if (argc > 1 && strcmp(argv[1], "reset") == 0) {
+		k_thread_foreach(shell_runtime_reset, NULL);
+		return 0;
+	}
+
+	shell_fprintf(shell, SHELL_NORMAL, "Threads:\n");
+	k_thread_foreach(shell_runtime_dump, (void *)shell);
 	return 0;
 }
 #endif
@@ -158,8 +244,13 @@ SHELL_CREATE_STATIC_SUBCMD_SET(sub_kernel)
 #if defined(CONFIG_REBOOT)
 	SHELL_CMD(reboot, &sub_kernel_reboot, "Reboot.", NULL),
 #endif
-#if defined(CONFIG_INIT_STACKS) && defined(CONFIG_THREAD_MONITOR) \
-				&& defined(CONFIG_THREAD_STACK_INFO)
+#if defined(CONFIG_TRACING_CPU_STATS_THREADS)
+	SHELL_CMD(runtime, NULL,
+		  "List threads CPU usage, or \"reset\" it.",
+		  cmd_kernel_runtime),
+#endif
+#if (defined(CONFIG_INIT_STACKS) || defined(CONFIG_STACK_USAGE_MONITOR)) \
+	&& defined(CONFIG_THREAD_MONITOR) && defined(CONFIG_THREAD_STACK_INFO)
 	SHELL_CMD(stacks, NULL, "List threads stack usage.", cmd_kernel_stacks),
 	SHELL_CMD(threads, NULL, "List kernel threads.", cmd_kernel_threads),
 #endif
@@ -14,9 +14,11 @@
  *  2. From __start to main()
  *  3. From __start to task
  *  4. From __start to idle
+ *  5. Time taken by the initialization of each device
  */
 
 #include <zephyr.h>
+#include <device.h>
 
 #include <tc_util.h>
 
@@ -24,6 +26,32 @@
 extern u64_t __start_time_stamp;    /* timestamp when kernel begins executing */
 extern u64_t __main_time_stamp;     /* timestamp when main() begins executing */
 extern u64_t __idle_time_stamp;     /* timestamp when CPU went idle */
+extern struct device __device_init_start[];
+extern struct device __device_init_end[];
+
+static void print_device_init_times(int freq)
+{
+	struct device *dev;
+	u32_t total = 0U;
+
+	TC_PRINT("Device init times:\n");
+	for (dev = __device_init_start; dev < __device_init_end; dev++) {
+		const char *name = dev->config->name;
+
+		/* SYS_INIT() entries have no name */
+		if (name == NULL || name[0] == '\0') {
+			TC_PRINT("  %p: %u cycles, %u us\n",
+				 dev->config->init, dev->init_cycles,
+				 dev->init_cycles / freq);
+		} else {
+			TC_PRINT("  %s: %u cycles, %u us\n", name,
+				 dev->init_cycles, dev->init_cycles / freq);
+		}
+		total += dev->init_cycles;
+	}
+	TC_PRINT("Device init total: %u cycles, %u us\n", total,
+		 total / freq);
+}
 
 void main(void)
 {
@@ -72,6 +100,8 @@ void main(void)
 		 (u32_t)(s_idle_time_stamp & 0xFFFFFFFFULL),
 		 (u32_t)  (idle_us  & 0xFFFFFFFFULL));
 
+	print_device_init_times(freq);
+
 	TC_PRINT("Boot Time Measurement finished\n");
 
 	/* for sanity regression test utility. */
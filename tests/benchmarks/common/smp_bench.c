@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr.h>
+#include <kernel_structs.h>
+#include <misc/printk.h>
+#include "smp_bench.h"
+
+static K_THREAD_STACK_ARRAY_DEFINE(stacks, SMP_BENCH_THREADS,
+				   SMP_BENCH_STACK_SIZE);
+static struct k_thread threads[SMP_BENCH_THREADS];
+
+volatile bool smp_bench_running;
+
+void smp_bench_start(int n, int per_cpu, k_thread_entry_t entry)
+{
+	/* Below the caller, so that it gets a CPU back to end the run */
+	int prio = k_thread_priority_get(k_current_get()) + 1;
+
+	__ASSERT_NO_MSG(n <= SMP_BENCH_THREADS);
+
+	smp_bench_running = true;
+
+	for (int i = 0; i < n; i++) {
+		k_thread_create(&threads[i], stacks[i], SMP_BENCH_STACK_SIZE,
+				entry, (void *)i, NULL, NULL,
+				prio, 0, K_FOREVER);
+#ifdef CONFIG_SCHED_CPU_MASK
+		k_thread_cpu_mask_clear(&threads[i]);
+		k_thread_cpu_mask_enable(&threads[i], i / per_cpu);
+#endif
+	}
+
+	for (int i = 0; i < n; i++) {
+		k_thread_start(&threads[i]);
+	}
+}
+
+static bool thread_gone(struct k_thread *thread)
+{
+	if ((thread->base.thread_state & _THREAD_DEAD) == 0) {
+		return false;
+	}
+
+	/* A thread is marked dead before it switches away for the last
+	 * time, and keeps using its stack until then
+	 */
+	for (int i = 0; i < CONFIG_MP_NUM_CPUS; i++) {
+		if (_kernel.cpus[i].current == thread) {
+			return false;
+		}
+	}
+
+	return true;
+}
+
+void smp_bench_join(int first, int n)
+{
+	for (int i = first; i < first + n; i++) {
+		while (!thread_gone(&threads[i])) {
+			k_sleep(1);
+		}
+	}
+}
+
+void smp_bench_measure(int n)
+{
+	k_sleep(SMP_BENCH_MEASURE_MS);
+	smp_bench_running = false;
+	smp_bench_join(0, n);
+}
+
+void smp_bench_main(void (*run)(int ncpus), int min_cpus)
+{
+	for (int ncpus = min_cpus; ncpus <= SMP_BENCH_MAX_CPUS; ncpus++) {
+		run(ncpus);
+	}
+	printk("fin\n");
+}
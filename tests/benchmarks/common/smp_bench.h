@@ -0,0 +1,51 @@
+/*
+ * Copyright (c) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef ZEPHYR_TESTS_BENCHMARKS_COMMON_SMP_BENCH_H_
+#define ZEPHYR_TESTS_BENCHMARKS_COMMON_SMP_BENCH_H_
+
+#include <zephyr.h>
+
+/* Harness shared by the SMP throughput benchmarks: a pool of worker
+ * threads pinned to CPUs, run for a fixed time and joined before they
+ * are created again for the next CPU count.
+ */
+
+#define SMP_BENCH_MAX_CPUS CONFIG_MP_NUM_CPUS
+#define SMP_BENCH_THREADS (2 * SMP_BENCH_MAX_CPUS)
+#define SMP_BENCH_STACK_SIZE 1024
+#define SMP_BENCH_MEASURE_MS 2000
+
+/* Workers loop until this goes false, then return */
+extern volatile bool smp_bench_running;
+
+/* Creates and starts workers 0..n-1, worker i calling entry((void *)i)
+ * pinned to CPU i / per_cpu, and sets smp_bench_running
+ */
+void smp_bench_start(int n, int per_cpu, k_thread_entry_t entry);
+
+/* Waits until workers first..first+n-1 have exited and left their CPU,
+ * so that their thread objects and stacks can be reused
+ */
+void smp_bench_join(int first, int n);
+
+/* Lets workers 0..n-1 run for SMP_BENCH_MEASURE_MS, then stops and
+ * joins them
+ */
+void smp_bench_measure(int n);
+
+/* Calls run(ncpus) for each CPU count from min_cpus up to all of them,
+ * then prints the line the test harness waits for
+ */
+void smp_bench_main(void (*run)(int ncpus), int min_cpus);
+
+/* Converts a count over one measurement into a rate per second */
+static inline u32_t smp_bench_rate(u64_t count)
+{
+	return (u32_t)(count * 1000 / SMP_BENCH_MEASURE_MS);
+}
+
+#endif /* ZEPHYR_TESTS_BENCHMARKS_COMMON_SMP_BENCH_H_ */
@@ -0,0 +1,85 @@
+#!/usr/bin/env python3
+#
+# Copyright (c) 2019 Intel Corporation
+#
+# SPDX-License-Identifier: Apache-2.0
+
+"""Generate src/trace.h for the heap benchmark.
+
+Emits a fixed sequence of allocations and frees drawn from a seeded
+model of a mixed workload: many short lived small objects (messages,
+list nodes), fewer medium sized buffers, and occasional large buffers
+that stay alive across many other operations.  Live data is kept below
+LIVE_MAX bytes so that allocation failures in the benchmark come from
+fragmentation and rounding, not from the workload outgrowing the arena.
+Every allocation is freed by the end of the trace.
+"""
+
+import random
+
+SEED = 1914
+OPS = 2000
+SLOTS = 128
+LIVE_MAX = 8192
+
+CLASSES = [
+    # weight, min size, max size, mean lifetime (in operations)
+    (45, 8, 48, 6),
+    (30, 49, 200, 20),
+    (18, 201, 600, 60),
+    (7, 601, 2000, 200),
+]
+
+
+def main():
+    rnd = random.Random(SEED)
+    live = {}
+    free_at = {}
+    ops = []
+    live_bytes = 0
+    step = 0
+
+    while len(ops) < OPS - len(live):
+        step += 1
+        due = [s for s, t in free_at.items() if t <= step]
+        if due:
+            slot = rnd.choice(due)
+            ops.append((0, slot))
+            live_bytes -= live.pop(slot)
+            del free_at[slot]
+            continue
+
+        weight = rnd.randrange(100)
+        for w, lo, hi, life in CLASSES:
+            if weight < w:
+                break
+            weight -= w
+        size = rnd.randint(lo, hi)
+
+        slots = [s for s in range(SLOTS) if s not in live]
+        if not slots or live_bytes + size > LIVE_MAX:
+            # Fast forward to the next free
+            step = min(free_at.values()) - 1
+            continue
+
+        slot = rnd.choice(slots)
+        live[slot] = size
+        live_bytes += size
+        free_at[slot] = step + 1 + int(rnd.expovariate(1.0 / life))
+        ops.append((size, slot))
+
+    for slot in sorted(live, key=lambda s: free_at[s]):
+        ops.append((0, slot))
+
+    print("/* Generated by gen_trace.py (seed %d), do not edit */" % SEED)
+    print("")
+    print("#define TRACE_SLOTS %d" % SLOTS)
+    print("")
+    print("static const struct trace_op trace[] = {")
+    for size, slot in ops:
+        print("\t{ %d, %d }," % (size, slot))
+    print("};")
+
+
+if __name__ == "__main__":
+    main()
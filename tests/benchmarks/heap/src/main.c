@@ -0,0 +1,181 @@
+/*
+ * Copyright (c) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr.h>
+#include <misc/printk.h>
+#include <misc/mempool.h>
+#include <misc/tlsf.h>
+
+/* This benchmark replays a fixed allocation trace against the buddy
+ * allocator (sys_mem_pool) and the TLSF heap (sys_tlsf) backing the
+ * same amount of memory, and reports allocation latency, failed
+ * allocations and memory consumed per byte requested.  See README.rst
+ * for details.
+ */
+
+struct trace_op {
+	u16_t size;	/* bytes to allocate, or 0 to free the slot */
+	u16_t slot;
+};
+
+#include "trace.h"
+
+#define ARENA_SIZE	16384
+#define PASSES		4
+
+K_MUTEX_DEFINE(lock);
+
+SYS_MEM_POOL_DEFINE(pool, &lock, 16, ARENA_SIZE / 4, 4, 4, .data);
+
+static char __aligned(sizeof(void *)) heap_buf[ARENA_SIZE];
+static struct sys_tlsf heap;
+
+struct allocator {
+	const char *name;
+	void *(*alloc)(size_t size);
+	void (*free)(void *ptr);
+	size_t (*consumed)(void *ptr);
+};
+
+static void *pool_alloc(size_t size)
+{
+	return sys_mem_pool_alloc(&pool, size);
+}
+
+static void pool_free(void *ptr)
+{
+	sys_mem_pool_free(ptr);
+}
+
+/* Size of the buddy block backing ptr, as computed by realloc() */
+static size_t pool_consumed(void *ptr)
+{
+	struct sys_mem_pool_block *blk = (struct sys_mem_pool_block *)
+		((char *)ptr - sizeof(*blk));
+	size_t size = _ALIGN4(blk->pool->base.max_sz);
+
+	for (int i = 1; i <= blk->level; i++) {
+		size = _ALIGN4(size / 4);
+	}
+
+	return size;
+}
+
+/* sys_mem_pool takes its mutex internally, do the same here so both
+ * backends are measured as malloc() would use them
+ */
+static void *tlsf_alloc(size_t size)
+{
+	void *ret;
+
+	k_mutex_lock(&lock, K_FOREVER);
+	ret = sys_tlsf_alloc(&heap, size);
+	k_mutex_unlock(&lock);
+
+	return ret;
+}
+
+static void tlsf_free(void *ptr)
+{
+	k_mutex_lock(&lock, K_FOREVER);
+	sys_tlsf_free(&heap, ptr);
+	k_mutex_unlock(&lock);
+}
+
+/* Usable size plus the block header */
+static size_t tlsf_consumed(void *ptr)
+{
+	return sys_tlsf_usable_size(ptr) + sizeof(size_t);
+}
+
+static const struct allocator allocators[] = {
+	{ "sys_mem_pool", pool_alloc, pool_free, pool_consumed },
+	{ "sys_tlsf", tlsf_alloc, tlsf_free, tlsf_consumed },
+};
+
+static void *slots[TRACE_SLOTS];
+
+struct stats {
+	u32_t allocs, fails, frees;
+	u32_t alloc_cycles, alloc_max;
+	u32_t free_cycles, free_max;
+	u32_t requested, consumed;
+};
+
+static void replay(const struct allocator *a, struct stats *st)
+{
+	for (int i = 0; i < ARRAY_SIZE(trace); i++) {
+		const struct trace_op *op = &trace[i];
+		u32_t t0, dt;
+
+		if (op->size == 0) {
+			if (slots[op->slot] == NULL) {
+				/* Its allocation failed */
+				continue;
+			}
+
+			t0 = k_cycle_get_32();
+			a->free(slots[op->slot]);
+			dt = k_cycle_get_32() - t0;
+
+			slots[op->slot] = NULL;
+			st->frees++;
+			st->free_cycles += dt;
+			st->free_max = MAX(st->free_max, dt);
+			continue;
+		}
+
+		t0 = k_cycle_get_32();
+		slots[op->slot] = a->alloc(op->size);
+		dt = k_cycle_get_32() - t0;
+
+		if (slots[op->slot] == NULL) {
+			st->fails++;
+			continue;
+		}
+
+		st->allocs++;
+		st->alloc_cycles += dt;
+		st->alloc_max = MAX(st->alloc_max, dt);
+		st->requested += op->size;
+		st->consumed += a->consumed(slots[op->slot]);
+	}
+}
+
+void main(void)
+{
+	sys_mem_pool_init(&pool);
+	sys_tlsf_init(&heap, heap_buf, sizeof(heap_buf));
+
+	printk("heap benchmark: %d trace operations, %d byte arenas, "
+	       "%d passes\n", (int)ARRAY_SIZE(trace), ARENA_SIZE, PASSES);
+
+	for (int i = 0; i < ARRAY_SIZE(allocators); i++) {
+		const struct allocator *a = &allocators[i];
+		struct stats st = { 0 };
+
+		/* The trace frees everything it allocates, so it can
+		 * simply be repeated to get more samples
+		 */
+		for (int pass = 0; pass < PASSES; pass++) {
+			replay(a, &st);
+		}
+
+		printk("%-12s: alloc avg %5u max %6u  free avg %5u max %6u  "
+		       "failed %4u/%u  consumed/requested %u.%02u\n",
+		       a->name,
+		       st.alloc_cycles / MAX(st.allocs, 1U), st.alloc_max,
+		       st.free_cycles / MAX(st.frees, 1U), st.free_max,
+		       st.fails, st.allocs + st.fails,
+		       st.consumed / MAX(st.requested, 1U),
+		       (u32_t)((u64_t)st.consumed * 100U /
+			       MAX(st.requested, 1U) % 100U));
+	}
+
+	printk("TLSF heap: %u bytes free, largest free block %u bytes\n",
+	       (u32_t)sys_tlsf_free_bytes(&heap),
+	       (u32_t)sys_tlsf_largest_free(&heap));
+}
@@ -0,0 +1,2006 @@
+/* Generated by gen_trace.py (seed 1914), do not edit */
+
+#define TRACE_SLOTS 128
+
+static const struct trace_op trace[] = {
+	{ 23, 80 },
+	{ 46, 33 },
+	{ 212, 117 },
+	{ 40, 41 },
+	{ 43, 118 },
+	{ 0, 33 },
+	{ 0, 80 },
+	{ 0, 41 },
+	{ 27, 44 },
+	{ 23, 80 },
+	{ 21, 52 },
+	{ 0, 118 },
+	{ 35, 43 },
+	{ 46, 2 },
+	{ 0, 43 },
+	{ 0, 52 },
+	{ 32, 22 },
+	{ 0, 2 },
+	{ 520, 111 },
+	{ 59, 17 },
+	{ 103, 40 },
+	{ 0, 80 },
+	{ 48, 3 },
+	{ 135, 69 },
+	{ 0, 22 },
+	{ 10, 2 },
+	{ 0, 3 },
+	{ 0, 40 },
+	{ 28, 109 },
+	{ 0, 109 },
+	{ 0, 2 },
+	{ 366, 51 },
+	{ 44, 36 },
+	{ 34, 105 },
+	{ 0, 105 },
+	{ 36, 78 },
+	{ 132, 108 },
+	{ 44, 19 },
+	{ 0, 78 },
+	{ 0, 36 },
+	{ 0, 19 },
+	{ 30, 6 },
+	{ 25, 37 },
+	{ 161, 9 },
+	{ 0, 37 },
+	{ 1276, 16 },
+	{ 0, 6 },
+	{ 0, 108 },
+	{ 0, 9 },
+	{ 0, 44 },
+	{ 41, 78 },
+	{ 0, 117 },
+	{ 0, 69 },
+	{ 0, 78 },
+	{ 0, 17 },
+	{ 10, 66 },
+	{ 1181, 103 },
+	{ 414, 23 },
+	{ 44, 57 },
+	{ 0, 57 },
+	{ 22, 91 },
+	{ 0, 66 },
+	{ 79, 66 },
+	{ 197, 6 },
+	{ 12, 110 },
+	{ 8, 24 },
+	{ 0, 91 },
+	{ 135, 122 },
+	{ 0, 24 },
+	{ 15, 70 },
+	{ 0, 122 },
+	{ 0, 70 },
+	{ 317, 67 },
+	{ 107, 10 },
+	{ 0, 66 },
+	{ 0, 110 },
+	{ 32, 61 },
+	{ 0, 61 },
+	{ 166, 88 },
+	{ 521, 80 },
+	{ 191, 62 },
+	{ 41, 31 },
+	{ 15, 123 },
+	{ 0, 123 },
+	{ 843, 2 },
+	{ 35, 97 },
+	{ 0, 31 },
+	{ 0, 97 },
+	{ 0, 67 },
+	{ 0, 88 },
+	{ 0, 10 },
+	{ 39, 79 },
+	{ 0, 103 },
+	{ 184, 9 },
+	{ 0, 79 },
+	{ 102, 71 },
+	{ 8, 65 },
+	{ 42, 5 },
+	{ 0, 5 },
+	{ 23, 29 },
+	{ 26, 123 },
+	{ 291, 91 },
+	{ 0, 51 },
+	{ 0, 62 },
+	{ 114, 17 },
+	{ 0, 29 },
+	{ 0, 65 },
+	{ 94, 43 },
+	{ 18, 26 },
+	{ 0, 26 },
+	{ 347, 66 },
+	{ 46, 81 },
+	{ 22, 44 },
+	{ 274, 79 },
+	{ 0, 81 },
+	{ 232, 28 },
+	{ 60, 45 },
+	{ 0, 44 },
+	{ 0, 28 },
+	{ 0, 71 },
+	{ 0, 43 },
+	{ 0, 9 },
+	{ 0, 45 },
+	{ 0, 123 },
+	{ 119, 117 },
+	{ 38, 92 },
+	{ 29, 7 },
+	{ 79, 84 },
+	{ 176, 110 },
+	{ 34, 26 },
+	{ 10, 25 },
+	{ 235, 96 },
+	{ 9, 125 },
+	{ 0, 66 },
+	{ 0, 25 },
+	{ 0, 125 },
+	{ 0, 92 },
+	{ 0, 7 },
+	{ 193, 9 },
+	{ 330, 8 },
+	{ 495, 56 },
+	{ 171, 86 },
+	{ 0, 84 },
+	{ 0, 26 },
+	{ 0, 17 },
+	{ 0, 86 },
+	{ 0, 23 },
+	{ 33, 94 },
+	{ 910, 125 },
+	{ 217, 31 },
+	{ 51, 106 },
+	{ 42, 57 },
+	{ 0, 106 },
+	{ 0, 16 },
+	{ 0, 117 },
+	{ 22, 45 },
+	{ 0, 94 },
+	{ 0, 45 },
+	{ 109, 12 },
+	{ 1876, 51 },
+	{ 185, 42 },
+	{ 0, 57 },
+	{ 43, 116 },
+	{ 0, 116 },
+	{ 0, 6 },
+	{ 46, 69 },
+	{ 0, 9 },
+	{ 499, 68 },
+	{ 403, 27 },
+	{ 0, 69 },
+	{ 43, 64 },
+	{ 0, 96 },
+	{ 0, 64 },
+	{ 0, 80 },
+	{ 0, 91 },
+	{ 0, 42 },
+	{ 0, 79 },
+	{ 0, 8 },
+	{ 0, 110 },
+	{ 178, 62 },
+	{ 163, 80 },
+	{ 14, 9 },
+	{ 148, 102 },
+	{ 116, 79 },
+	{ 0, 31 },
+	{ 171, 53 },
+	{ 0, 68 },
+	{ 25, 85 },
+	{ 0, 56 },
+	{ 0, 85 },
+	{ 38, 123 },
+	{ 0, 9 },
+	{ 0, 80 },
+	{ 11, 26 },
+	{ 173, 105 },
+	{ 0, 26 },
+	{ 171, 115 },
+	{ 90, 81 },
+	{ 0, 123 },
+	{ 0, 79 },
+	{ 0, 12 },
+	{ 521, 59 },
+	{ 287, 107 },
+	{ 21, 1 },
+	{ 40, 109 },
+	{ 0, 1 },
+	{ 138, 112 },
+	{ 0, 109 },
+	{ 151, 1 },
+	{ 20, 34 },
+	{ 0, 115 },
+	{ 128, 9 },
+	{ 244, 70 },
+	{ 23, 65 },
+	{ 20, 7 },
+	{ 0, 65 },
+	{ 0, 53 },
+	{ 0, 81 },
+	{ 150, 24 },
+	{ 25, 109 },
+	{ 0, 107 },
+	{ 0, 34 },
+	{ 34, 71 },
+	{ 0, 105 },
+	{ 80, 101 },
+	{ 1358, 18 },
+	{ 0, 70 },
+	{ 0, 111 },
+	{ 26, 72 },
+	{ 0, 72 },
+	{ 127, 23 },
+	{ 0, 59 },
+	{ 0, 109 },
+	{ 211, 38 },
+	{ 91, 28 },
+	{ 0, 28 },
+	{ 0, 101 },
+	{ 0, 102 },
+	{ 0, 62 },
+	{ 0, 9 },
+	{ 0, 7 },
+	{ 21, 88 },
+	{ 0, 71 },
+	{ 476, 56 },
+	{ 100, 43 },
+	{ 36, 8 },
+	{ 0, 1 },
+	{ 0, 8 },
+	{ 0, 24 },
+	{ 0, 23 },
+	{ 135, 68 },
+	{ 27, 12 },
+	{ 109, 62 },
+	{ 29, 40 },
+	{ 45, 124 },
+	{ 0, 124 },
+	{ 409, 28 },
+	{ 48, 92 },
+	{ 47, 117 },
+	{ 45, 101 },
+	{ 0, 27 },
+	{ 0, 12 },
+	{ 0, 40 },
+	{ 0, 62 },
+	{ 0, 117 },
+	{ 0, 92 },
+	{ 0, 101 },
+	{ 24, 32 },
+	{ 0, 68 },
+	{ 418, 93 },
+	{ 0, 32 },
+	{ 34, 55 },
+	{ 190, 122 },
+	{ 0, 122 },
+	{ 0, 125 },
+	{ 12, 48 },
+	{ 555, 61 },
+	{ 167, 64 },
+	{ 0, 48 },
+	{ 292, 0 },
+	{ 0, 88 },
+	{ 27, 44 },
+	{ 0, 44 },
+	{ 0, 0 },
+	{ 20, 34 },
+	{ 30, 30 },
+	{ 0, 55 },
+	{ 125, 62 },
+	{ 0, 64 },
+	{ 0, 62 },
+	{ 0, 30 },
+	{ 0, 43 },
+	{ 0, 93 },
+	{ 1650, 49 },
+	{ 0, 34 },
+	{ 0, 112 },
+	{ 11, 0 },
+	{ 27, 116 },
+	{ 0, 0 },
+	{ 368, 29 },
+	{ 38, 52 },
+	{ 82, 42 },
+	{ 0, 52 },
+	{ 31, 47 },
+	{ 0, 47 },
+	{ 0, 2 },
+	{ 14, 118 },
+	{ 28, 19 },
+	{ 204, 62 },
+	{ 0, 118 },
+	{ 0, 116 },
+	{ 0, 42 },
+	{ 348, 118 },
+	{ 0, 38 },
+	{ 32, 37 },
+	{ 197, 75 },
+	{ 73, 103 },
+	{ 0, 103 },
+	{ 97, 66 },
+	{ 271, 58 },
+	{ 0, 66 },
+	{ 0, 37 },
+	{ 0, 61 },
+	{ 0, 58 },
+	{ 0, 19 },
+	{ 132, 60 },
+	{ 41, 84 },
+	{ 44, 100 },
+	{ 0, 100 },
+	{ 182, 101 },
+	{ 48, 98 },
+	{ 165, 67 },
+	{ 0, 60 },
+	{ 0, 98 },
+	{ 0, 101 },
+	{ 0, 75 },
+	{ 0, 84 },
+	{ 262, 23 },
+	{ 513, 9 },
+	{ 34, 101 },
+	{ 14, 69 },
+	{ 0, 23 },
+	{ 0, 101 },
+	{ 0, 69 },
+	{ 0, 67 },
+	{ 38, 74 },
+	{ 236, 78 },
+	{ 22, 96 },
+	{ 131, 112 },
+	{ 9, 3 },
+	{ 19, 61 },
+	{ 139, 35 },
+	{ 0, 56 },
+	{ 19, 124 },
+	{ 0, 112 },
+	{ 0, 3 },
+	{ 0, 74 },
+	{ 0, 35 },
+	{ 0, 124 },
+	{ 0, 96 },
+	{ 0, 61 },
+	{ 124, 32 },
+	{ 166, 96 },
+	{ 171, 35 },
+	{ 178, 70 },
+	{ 0, 118 },
+	{ 40, 38 },
+	{ 13, 16 },
+	{ 0, 35 },
+	{ 113, 121 },
+	{ 0, 38 },
+	{ 0, 32 },
+	{ 90, 46 },
+	{ 90, 88 },
+	{ 0, 46 },
+	{ 37, 44 },
+	{ 0, 44 },
+	{ 13, 73 },
+	{ 13, 58 },
+	{ 223, 27 },
+	{ 0, 73 },
+	{ 188, 10 },
+	{ 134, 81 },
+	{ 0, 88 },
+	{ 0, 16 },
+	{ 163, 115 },
+	{ 34, 79 },
+	{ 0, 96 },
+	{ 0, 79 },
+	{ 0, 10 },
+	{ 90, 113 },
+	{ 0, 70 },
+	{ 0, 113 },
+	{ 43, 5 },
+	{ 0, 121 },
+	{ 341, 82 },
+	{ 43, 76 },
+	{ 185, 88 },
+	{ 0, 58 },
+	{ 0, 76 },
+	{ 467, 39 },
+	{ 0, 5 },
+	{ 47, 77 },
+	{ 0, 77 },
+	{ 0, 88 },
+	{ 119, 19 },
+	{ 0, 19 },
+	{ 44, 22 },
+	{ 51, 99 },
+	{ 0, 81 },
+	{ 0, 22 },
+	{ 134, 89 },
+	{ 21, 60 },
+	{ 0, 9 },
+	{ 0, 99 },
+	{ 0, 60 },
+	{ 0, 78 },
+	{ 15, 37 },
+	{ 0, 37 },
+	{ 37, 96 },
+	{ 0, 96 },
+	{ 0, 115 },
+	{ 47, 33 },
+	{ 12, 4 },
+	{ 13, 41 },
+	{ 139, 120 },
+	{ 0, 29 },
+	{ 15, 87 },
+	{ 0, 87 },
+	{ 189, 8 },
+	{ 0, 49 },
+	{ 0, 41 },
+	{ 0, 27 },
+	{ 33, 47 },
+	{ 176, 92 },
+	{ 16, 72 },
+	{ 0, 33 },
+	{ 0, 72 },
+	{ 0, 47 },
+	{ 0, 120 },
+	{ 0, 89 },
+	{ 0, 82 },
+	{ 0, 4 },
+	{ 9, 71 },
+	{ 46, 113 },
+	{ 29, 79 },
+	{ 0, 28 },
+	{ 0, 8 },
+	{ 41, 47 },
+	{ 170, 40 },
+	{ 28, 44 },
+	{ 0, 44 },
+	{ 0, 39 },
+	{ 19, 63 },
+	{ 0, 63 },
+	{ 0, 71 },
+	{ 0, 113 },
+	{ 0, 79 },
+	{ 0, 92 },
+	{ 30, 125 },
+	{ 38, 73 },
+	{ 47, 36 },
+	{ 66, 0 },
+	{ 0, 62 },
+	{ 31, 88 },
+	{ 0, 51 },
+	{ 0, 88 },
+	{ 0, 125 },
+	{ 0, 0 },
+	{ 0, 73 },
+	{ 37, 89 },
+	{ 435, 49 },
+	{ 37, 29 },
+	{ 0, 40 },
+	{ 0, 89 },
+	{ 77, 77 },
+	{ 0, 29 },
+	{ 16, 74 },
+	{ 0, 49 },
+	{ 0, 36 },
+	{ 579, 86 },
+	{ 0, 74 },
+	{ 0, 77 },
+	{ 22, 120 },
+	{ 126, 30 },
+	{ 94, 110 },
+	{ 155, 20 },
+	{ 118, 73 },
+	{ 0, 73 },
+	{ 12, 56 },
+	{ 0, 20 },
+	{ 37, 96 },
+	{ 0, 47 },
+	{ 0, 120 },
+	{ 18, 11 },
+	{ 0, 96 },
+	{ 16, 103 },
+	{ 40, 90 },
+	{ 0, 90 },
+	{ 0, 103 },
+	{ 384, 47 },
+	{ 1953, 119 },
+	{ 162, 66 },
+	{ 88, 57 },
+	{ 19, 13 },
+	{ 0, 13 },
+	{ 46, 48 },
+	{ 24, 105 },
+	{ 0, 48 },
+	{ 0, 105 },
+	{ 160, 97 },
+	{ 552, 112 },
+	{ 43, 62 },
+	{ 0, 62 },
+	{ 44, 24 },
+	{ 0, 11 },
+	{ 0, 66 },
+	{ 0, 30 },
+	{ 0, 56 },
+	{ 178, 72 },
+	{ 0, 24 },
+	{ 511, 65 },
+	{ 0, 57 },
+	{ 0, 110 },
+	{ 1522, 12 },
+	{ 190, 64 },
+	{ 0, 97 },
+	{ 406, 24 },
+	{ 0, 65 },
+	{ 29, 94 },
+	{ 25, 50 },
+	{ 27, 32 },
+	{ 93, 73 },
+	{ 179, 104 },
+	{ 0, 64 },
+	{ 55, 59 },
+	{ 15, 96 },
+	{ 0, 96 },
+	{ 0, 50 },
+	{ 0, 47 },
+	{ 0, 24 },
+	{ 0, 104 },
+	{ 314, 89 },
+	{ 36, 15 },
+	{ 0, 86 },
+	{ 487, 62 },
+	{ 68, 111 },
+	{ 342, 14 },
+	{ 637, 49 },
+	{ 0, 89 },
+	{ 0, 15 },
+	{ 29, 105 },
+	{ 0, 105 },
+	{ 0, 32 },
+	{ 0, 94 },
+	{ 0, 14 },
+	{ 0, 72 },
+	{ 291, 93 },
+	{ 103, 90 },
+	{ 249, 113 },
+	{ 25, 77 },
+	{ 139, 86 },
+	{ 169, 114 },
+	{ 0, 86 },
+	{ 0, 73 },
+	{ 0, 77 },
+	{ 91, 29 },
+	{ 0, 114 },
+	{ 0, 90 },
+	{ 167, 50 },
+	{ 32, 39 },
+	{ 17, 114 },
+	{ 108, 94 },
+	{ 155, 126 },
+	{ 0, 39 },
+	{ 0, 114 },
+	{ 296, 115 },
+	{ 19, 74 },
+	{ 28, 127 },
+	{ 45, 48 },
+	{ 0, 127 },
+	{ 0, 48 },
+	{ 0, 126 },
+	{ 0, 50 },
+	{ 41, 81 },
+	{ 0, 81 },
+	{ 0, 119 },
+	{ 0, 74 },
+	{ 0, 29 },
+	{ 28, 35 },
+	{ 0, 59 },
+	{ 407, 89 },
+	{ 178, 45 },
+	{ 103, 41 },
+	{ 1363, 44 },
+	{ 17, 60 },
+	{ 0, 35 },
+	{ 0, 94 },
+	{ 0, 111 },
+	{ 0, 18 },
+	{ 0, 41 },
+	{ 18, 76 },
+	{ 0, 93 },
+	{ 0, 60 },
+	{ 1793, 13 },
+	{ 0, 76 },
+	{ 242, 93 },
+	{ 42, 66 },
+	{ 339, 117 },
+	{ 0, 115 },
+	{ 151, 28 },
+	{ 59, 14 },
+	{ 0, 14 },
+	{ 0, 66 },
+	{ 0, 45 },
+	{ 431, 121 },
+	{ 0, 113 },
+	{ 50, 96 },
+	{ 15, 27 },
+	{ 177, 109 },
+	{ 0, 28 },
+	{ 0, 93 },
+	{ 0, 27 },
+	{ 0, 117 },
+	{ 0, 121 },
+	{ 12, 119 },
+	{ 128, 2 },
+	{ 28, 22 },
+	{ 0, 119 },
+	{ 120, 110 },
+	{ 26, 19 },
+	{ 74, 124 },
+	{ 18, 120 },
+	{ 43, 95 },
+	{ 0, 19 },
+	{ 0, 124 },
+	{ 0, 22 },
+	{ 0, 120 },
+	{ 0, 112 },
+	{ 44, 25 },
+	{ 27, 34 },
+	{ 47, 102 },
+	{ 0, 89 },
+	{ 37, 0 },
+	{ 117, 71 },
+	{ 0, 95 },
+	{ 0, 71 },
+	{ 0, 0 },
+	{ 0, 25 },
+	{ 0, 2 },
+	{ 0, 34 },
+	{ 174, 75 },
+	{ 36, 23 },
+	{ 59, 24 },
+	{ 47, 115 },
+	{ 112, 71 },
+	{ 129, 56 },
+	{ 0, 56 },
+	{ 1086, 85 },
+	{ 0, 102 },
+	{ 0, 71 },
+	{ 196, 120 },
+	{ 170, 20 },
+	{ 40, 26 },
+	{ 0, 23 },
+	{ 0, 120 },
+	{ 45, 41 },
+	{ 0, 41 },
+	{ 166, 83 },
+	{ 0, 115 },
+	{ 160, 14 },
+	{ 0, 26 },
+	{ 0, 20 },
+	{ 0, 24 },
+	{ 0, 62 },
+	{ 174, 98 },
+	{ 449, 89 },
+	{ 0, 96 },
+	{ 19, 28 },
+	{ 71, 68 },
+	{ 0, 110 },
+	{ 0, 28 },
+	{ 0, 83 },
+	{ 0, 89 },
+	{ 0, 109 },
+	{ 116, 90 },
+	{ 142, 1 },
+	{ 344, 39 },
+	{ 0, 1 },
+	{ 265, 89 },
+	{ 378, 43 },
+	{ 0, 98 },
+	{ 156, 61 },
+	{ 28, 38 },
+	{ 8, 100 },
+	{ 0, 38 },
+	{ 0, 90 },
+	{ 21, 51 },
+	{ 46, 42 },
+	{ 0, 43 },
+	{ 33, 50 },
+	{ 0, 39 },
+	{ 0, 42 },
+	{ 0, 100 },
+	{ 44, 39 },
+	{ 395, 58 },
+	{ 0, 51 },
+	{ 0, 50 },
+	{ 44, 103 },
+	{ 182, 94 },
+	{ 13, 19 },
+	{ 35, 59 },
+	{ 21, 102 },
+	{ 0, 103 },
+	{ 24, 66 },
+	{ 65, 15 },
+	{ 0, 58 },
+	{ 0, 59 },
+	{ 420, 17 },
+	{ 0, 75 },
+	{ 0, 14 },
+	{ 0, 19 },
+	{ 0, 94 },
+	{ 0, 68 },
+	{ 0, 39 },
+	{ 0, 61 },
+	{ 0, 66 },
+	{ 43, 76 },
+	{ 0, 76 },
+	{ 0, 15 },
+	{ 0, 102 },
+	{ 166, 26 },
+	{ 79, 119 },
+	{ 24, 103 },
+	{ 49, 29 },
+	{ 0, 103 },
+	{ 17, 72 },
+	{ 13, 86 },
+	{ 0, 86 },
+	{ 184, 45 },
+	{ 157, 53 },
+	{ 12, 50 },
+	{ 407, 116 },
+	{ 0, 72 },
+	{ 0, 17 },
+	{ 46, 2 },
+	{ 0, 2 },
+	{ 335, 86 },
+	{ 116, 27 },
+	{ 0, 50 },
+	{ 0, 119 },
+	{ 0, 45 },
+	{ 32, 19 },
+	{ 110, 104 },
+	{ 0, 19 },
+	{ 141, 34 },
+	{ 0, 29 },
+	{ 17, 43 },
+	{ 0, 116 },
+	{ 132, 93 },
+	{ 0, 43 },
+	{ 0, 34 },
+	{ 41, 122 },
+	{ 0, 122 },
+	{ 0, 26 },
+	{ 13, 59 },
+	{ 0, 53 },
+	{ 0, 59 },
+	{ 506, 125 },
+	{ 17, 29 },
+	{ 0, 29 },
+	{ 0, 93 },
+	{ 48, 22 },
+	{ 0, 27 },
+	{ 72, 122 },
+	{ 337, 62 },
+	{ 0, 22 },
+	{ 153, 96 },
+	{ 0, 96 },
+	{ 0, 62 },
+	{ 23, 25 },
+	{ 125, 110 },
+	{ 39, 20 },
+	{ 0, 25 },
+	{ 0, 110 },
+	{ 38, 109 },
+	{ 0, 20 },
+	{ 45, 106 },
+	{ 120, 39 },
+	{ 0, 39 },
+	{ 0, 109 },
+	{ 0, 106 },
+	{ 370, 74 },
+	{ 0, 104 },
+	{ 0, 86 },
+	{ 36, 1 },
+	{ 438, 27 },
+	{ 20, 113 },
+	{ 0, 113 },
+	{ 0, 1 },
+	{ 16, 42 },
+	{ 0, 42 },
+	{ 0, 85 },
+	{ 89, 90 },
+	{ 0, 90 },
+	{ 378, 105 },
+	{ 25, 34 },
+	{ 585, 108 },
+	{ 0, 34 },
+	{ 130, 117 },
+	{ 27, 24 },
+	{ 0, 105 },
+	{ 38, 100 },
+	{ 0, 24 },
+	{ 0, 100 },
+	{ 41, 26 },
+	{ 38, 52 },
+	{ 0, 125 },
+	{ 0, 49 },
+	{ 0, 26 },
+	{ 0, 52 },
+	{ 16, 64 },
+	{ 42, 114 },
+	{ 32, 58 },
+	{ 21, 26 },
+	{ 0, 26 },
+	{ 0, 114 },
+	{ 0, 58 },
+	{ 0, 27 },
+	{ 37, 15 },
+	{ 18, 91 },
+	{ 0, 91 },
+	{ 0, 74 },
+	{ 0, 15 },
+	{ 0, 64 },
+	{ 159, 88 },
+	{ 131, 66 },
+	{ 158, 22 },
+	{ 31, 114 },
+	{ 0, 13 },
+	{ 380, 54 },
+	{ 0, 88 },
+	{ 72, 107 },
+	{ 0, 89 },
+	{ 0, 122 },
+	{ 0, 66 },
+	{ 0, 22 },
+	{ 146, 31 },
+	{ 180, 126 },
+	{ 508, 127 },
+	{ 0, 31 },
+	{ 0, 108 },
+	{ 0, 107 },
+	{ 0, 114 },
+	{ 0, 54 },
+	{ 111, 49 },
+	{ 11, 20 },
+	{ 92, 24 },
+	{ 105, 109 },
+	{ 0, 20 },
+	{ 0, 49 },
+	{ 471, 20 },
+	{ 9, 83 },
+	{ 0, 126 },
+	{ 19, 121 },
+	{ 17, 103 },
+	{ 0, 83 },
+	{ 0, 117 },
+	{ 0, 121 },
+	{ 25, 11 },
+	{ 17, 19 },
+	{ 0, 11 },
+	{ 0, 24 },
+	{ 101, 117 },
+	{ 39, 105 },
+	{ 0, 19 },
+	{ 0, 12 },
+	{ 0, 103 },
+	{ 0, 127 },
+	{ 0, 105 },
+	{ 544, 94 },
+	{ 937, 26 },
+	{ 0, 117 },
+	{ 0, 109 },
+	{ 37, 48 },
+	{ 224, 97 },
+	{ 0, 48 },
+	{ 35, 65 },
+	{ 0, 65 },
+	{ 38, 104 },
+	{ 471, 52 },
+	{ 28, 125 },
+	{ 0, 125 },
+	{ 0, 52 },
+	{ 16, 24 },
+	{ 0, 104 },
+	{ 1617, 61 },
+	{ 24, 120 },
+	{ 182, 108 },
+	{ 29, 23 },
+	{ 0, 23 },
+	{ 47, 34 },
+	{ 0, 120 },
+	{ 0, 24 },
+	{ 0, 34 },
+	{ 0, 94 },
+	{ 109, 30 },
+	{ 44, 60 },
+	{ 16, 43 },
+	{ 0, 60 },
+	{ 0, 30 },
+	{ 28, 13 },
+	{ 0, 26 },
+	{ 586, 19 },
+	{ 0, 19 },
+	{ 0, 43 },
+	{ 0, 108 },
+	{ 1430, 4 },
+	{ 0, 13 },
+	{ 126, 69 },
+	{ 766, 68 },
+	{ 28, 23 },
+	{ 0, 69 },
+	{ 37, 77 },
+	{ 0, 23 },
+	{ 224, 34 },
+	{ 0, 77 },
+	{ 26, 91 },
+	{ 232, 69 },
+	{ 0, 91 },
+	{ 134, 45 },
+	{ 23, 111 },
+	{ 0, 20 },
+	{ 35, 103 },
+	{ 49, 25 },
+	{ 562, 7 },
+	{ 0, 103 },
+	{ 0, 111 },
+	{ 159, 42 },
+	{ 27, 1 },
+	{ 411, 17 },
+	{ 68, 113 },
+	{ 0, 1 },
+	{ 0, 7 },
+	{ 11, 7 },
+	{ 533, 94 },
+	{ 75, 114 },
+	{ 564, 101 },
+	{ 36, 115 },
+	{ 0, 101 },
+	{ 0, 114 },
+	{ 0, 7 },
+	{ 0, 115 },
+	{ 48, 39 },
+	{ 0, 39 },
+	{ 183, 9 },
+	{ 546, 108 },
+	{ 42, 0 },
+	{ 105, 13 },
+	{ 0, 113 },
+	{ 0, 9 },
+	{ 259, 16 },
+	{ 10, 81 },
+	{ 33, 19 },
+	{ 0, 108 },
+	{ 0, 81 },
+	{ 0, 0 },
+	{ 0, 45 },
+	{ 0, 42 },
+	{ 56, 0 },
+	{ 0, 13 },
+	{ 0, 69 },
+	{ 394, 126 },
+	{ 18, 14 },
+	{ 11, 124 },
+	{ 0, 19 },
+	{ 0, 17 },
+	{ 0, 94 },
+	{ 94, 51 },
+	{ 48, 9 },
+	{ 13, 1 },
+	{ 0, 0 },
+	{ 0, 14 },
+	{ 0, 9 },
+	{ 90, 55 },
+	{ 524, 7 },
+	{ 20, 80 },
+	{ 203, 2 },
+	{ 0, 1 },
+	{ 378, 28 },
+	{ 0, 80 },
+	{ 0, 55 },
+	{ 199, 63 },
+	{ 205, 111 },
+	{ 0, 126 },
+	{ 478, 103 },
+	{ 131, 120 },
+	{ 0, 51 },
+	{ 0, 63 },
+	{ 37, 24 },
+	{ 43, 40 },
+	{ 0, 24 },
+	{ 83, 123 },
+	{ 17, 24 },
+	{ 0, 124 },
+	{ 0, 25 },
+	{ 0, 24 },
+	{ 0, 28 },
+	{ 0, 120 },
+	{ 0, 40 },
+	{ 67, 93 },
+	{ 43, 5 },
+	{ 577, 67 },
+	{ 74, 82 },
+	{ 0, 5 },
+	{ 18, 47 },
+	{ 24, 94 },
+	{ 0, 93 },
+	{ 0, 103 },
+	{ 267, 77 },
+	{ 58, 42 },
+	{ 37, 104 },
+	{ 0, 82 },
+	{ 0, 47 },
+	{ 0, 94 },
+	{ 0, 7 },
+	{ 113, 52 },
+	{ 140, 25 },
+	{ 156, 105 },
+	{ 0, 42 },
+	{ 9, 43 },
+	{ 140, 101 },
+	{ 0, 104 },
+	{ 0, 43 },
+	{ 36, 3 },
+	{ 0, 2 },
+	{ 18, 104 },
+	{ 25, 78 },
+	{ 0, 101 },
+	{ 177, 17 },
+	{ 0, 78 },
+	{ 0, 3 },
+	{ 0, 52 },
+	{ 0, 104 },
+	{ 0, 105 },
+	{ 32, 56 },
+	{ 0, 56 },
+	{ 0, 67 },
+	{ 798, 51 },
+	{ 58, 103 },
+	{ 261, 58 },
+	{ 17, 91 },
+	{ 0, 61 },
+	{ 19, 50 },
+	{ 276, 53 },
+	{ 0, 53 },
+	{ 0, 91 },
+	{ 8, 99 },
+	{ 197, 8 },
+	{ 0, 50 },
+	{ 1086, 88 },
+	{ 173, 94 },
+	{ 0, 123 },
+	{ 217, 18 },
+	{ 0, 58 },
+	{ 0, 99 },
+	{ 0, 8 },
+	{ 0, 25 },
+	{ 26, 104 },
+	{ 0, 103 },
+	{ 72, 43 },
+	{ 15, 99 },
+	{ 0, 16 },
+	{ 0, 104 },
+	{ 0, 43 },
+	{ 0, 94 },
+	{ 161, 79 },
+	{ 200, 42 },
+	{ 0, 4 },
+	{ 0, 77 },
+	{ 0, 99 },
+	{ 23, 12 },
+	{ 0, 12 },
+	{ 362, 13 },
+	{ 487, 36 },
+	{ 21, 63 },
+	{ 0, 13 },
+	{ 904, 113 },
+	{ 48, 115 },
+	{ 0, 115 },
+	{ 454, 13 },
+	{ 594, 81 },
+	{ 0, 17 },
+	{ 425, 22 },
+	{ 0, 51 },
+	{ 0, 18 },
+	{ 0, 63 },
+	{ 0, 111 },
+	{ 0, 81 },
+	{ 0, 36 },
+	{ 0, 22 },
+	{ 0, 97 },
+	{ 0, 42 },
+	{ 22, 110 },
+	{ 580, 15 },
+	{ 21, 117 },
+	{ 33, 4 },
+	{ 26, 18 },
+	{ 132, 48 },
+	{ 0, 117 },
+	{ 12, 46 },
+	{ 1692, 35 },
+	{ 25, 43 },
+	{ 38, 93 },
+	{ 45, 55 },
+	{ 0, 4 },
+	{ 0, 110 },
+	{ 0, 13 },
+	{ 0, 93 },
+	{ 39, 92 },
+	{ 0, 79 },
+	{ 0, 46 },
+	{ 0, 92 },
+	{ 116, 52 },
+	{ 0, 55 },
+	{ 30, 2 },
+	{ 193, 7 },
+	{ 48, 30 },
+	{ 82, 111 },
+	{ 0, 43 },
+	{ 0, 18 },
+	{ 0, 2 },
+	{ 278, 101 },
+	{ 30, 106 },
+	{ 0, 106 },
+	{ 0, 111 },
+	{ 0, 7 },
+	{ 0, 48 },
+	{ 121, 6 },
+	{ 28, 46 },
+	{ 0, 30 },
+	{ 0, 46 },
+	{ 0, 52 },
+	{ 0, 68 },
+	{ 36, 31 },
+	{ 43, 45 },
+	{ 117, 115 },
+	{ 229, 91 },
+	{ 0, 31 },
+	{ 25, 77 },
+	{ 53, 73 },
+	{ 123, 26 },
+	{ 20, 70 },
+	{ 42, 25 },
+	{ 73, 47 },
+	{ 0, 45 },
+	{ 0, 6 },
+	{ 0, 77 },
+	{ 0, 70 },
+	{ 57, 118 },
+	{ 32, 77 },
+	{ 20, 17 },
+	{ 250, 87 },
+	{ 0, 87 },
+	{ 0, 91 },
+	{ 0, 118 },
+	{ 0, 25 },
+	{ 0, 77 },
+	{ 0, 47 },
+	{ 43, 2 },
+	{ 0, 73 },
+	{ 0, 101 },
+	{ 43, 11 },
+	{ 45, 67 },
+	{ 0, 35 },
+	{ 0, 67 },
+	{ 0, 17 },
+	{ 0, 2 },
+	{ 571, 63 },
+	{ 19, 107 },
+	{ 0, 107 },
+	{ 73, 81 },
+	{ 490, 80 },
+	{ 591, 20 },
+	{ 17, 111 },
+	{ 422, 73 },
+	{ 0, 44 },
+	{ 0, 11 },
+	{ 0, 111 },
+	{ 38, 79 },
+	{ 0, 73 },
+	{ 442, 54 },
+	{ 0, 79 },
+	{ 76, 31 },
+	{ 1248, 57 },
+	{ 43, 58 },
+	{ 91, 9 },
+	{ 32, 48 },
+	{ 0, 48 },
+	{ 16, 43 },
+	{ 40, 101 },
+	{ 22, 107 },
+	{ 0, 43 },
+	{ 0, 54 },
+	{ 0, 101 },
+	{ 0, 81 },
+	{ 36, 124 },
+	{ 0, 31 },
+	{ 313, 61 },
+	{ 0, 124 },
+	{ 0, 58 },
+	{ 0, 34 },
+	{ 0, 9 },
+	{ 0, 107 },
+	{ 0, 80 },
+	{ 191, 18 },
+	{ 408, 2 },
+	{ 592, 99 },
+	{ 552, 90 },
+	{ 200, 102 },
+	{ 47, 92 },
+	{ 0, 26 },
+	{ 27, 106 },
+	{ 0, 61 },
+	{ 0, 92 },
+	{ 694, 107 },
+	{ 21, 74 },
+	{ 121, 6 },
+	{ 78, 94 },
+	{ 33, 101 },
+	{ 0, 18 },
+	{ 10, 50 },
+	{ 0, 106 },
+	{ 0, 115 },
+	{ 0, 74 },
+	{ 0, 50 },
+	{ 157, 108 },
+	{ 0, 6 },
+	{ 161, 92 },
+	{ 17, 17 },
+	{ 0, 99 },
+	{ 32, 37 },
+	{ 148, 100 },
+	{ 0, 101 },
+	{ 78, 64 },
+	{ 0, 64 },
+	{ 193, 35 },
+	{ 178, 61 },
+	{ 0, 108 },
+	{ 23, 111 },
+	{ 30, 52 },
+	{ 0, 52 },
+	{ 0, 61 },
+	{ 0, 35 },
+	{ 0, 94 },
+	{ 0, 100 },
+	{ 0, 111 },
+	{ 0, 92 },
+	{ 0, 17 },
+	{ 91, 45 },
+	{ 35, 73 },
+	{ 0, 90 },
+	{ 25, 99 },
+	{ 0, 37 },
+	{ 0, 73 },
+	{ 1794, 87 },
+	{ 0, 99 },
+	{ 0, 45 },
+	{ 0, 87 },
+	{ 174, 28 },
+	{ 24, 27 },
+	{ 23, 103 },
+	{ 144, 87 },
+	{ 19, 94 },
+	{ 0, 27 },
+	{ 0, 103 },
+	{ 34, 31 },
+	{ 47, 74 },
+	{ 19, 37 },
+	{ 0, 87 },
+	{ 42, 43 },
+	{ 140, 120 },
+	{ 44, 83 },
+	{ 0, 102 },
+	{ 0, 94 },
+	{ 0, 43 },
+	{ 0, 74 },
+	{ 0, 37 },
+	{ 0, 28 },
+	{ 0, 107 },
+	{ 0, 83 },
+	{ 25, 14 },
+	{ 148, 102 },
+	{ 585, 43 },
+	{ 0, 31 },
+	{ 0, 120 },
+	{ 475, 91 },
+	{ 39, 99 },
+	{ 169, 112 },
+	{ 17, 19 },
+	{ 0, 14 },
+	{ 0, 99 },
+	{ 0, 19 },
+	{ 269, 39 },
+	{ 39, 19 },
+	{ 0, 19 },
+	{ 184, 19 },
+	{ 11, 28 },
+	{ 202, 70 },
+	{ 0, 28 },
+	{ 181, 32 },
+	{ 0, 112 },
+	{ 124, 116 },
+	{ 50, 89 },
+	{ 29, 12 },
+	{ 0, 19 },
+	{ 0, 32 },
+	{ 0, 102 },
+	{ 0, 12 },
+	{ 0, 70 },
+	{ 40, 28 },
+	{ 0, 15 },
+	{ 353, 80 },
+	{ 0, 20 },
+	{ 44, 96 },
+	{ 36, 56 },
+	{ 47, 120 },
+	{ 0, 96 },
+	{ 12, 29 },
+	{ 0, 113 },
+	{ 0, 28 },
+	{ 0, 120 },
+	{ 0, 2 },
+	{ 0, 29 },
+	{ 33, 18 },
+	{ 37, 103 },
+	{ 20, 25 },
+	{ 0, 103 },
+	{ 0, 56 },
+	{ 0, 25 },
+	{ 22, 22 },
+	{ 0, 22 },
+	{ 139, 97 },
+	{ 0, 43 },
+	{ 30, 112 },
+	{ 36, 84 },
+	{ 15, 103 },
+	{ 493, 32 },
+	{ 0, 18 },
+	{ 286, 77 },
+	{ 134, 45 },
+	{ 156, 96 },
+	{ 0, 89 },
+	{ 0, 103 },
+	{ 0, 91 },
+	{ 0, 112 },
+	{ 1797, 35 },
+	{ 0, 45 },
+	{ 0, 116 },
+	{ 0, 97 },
+	{ 0, 80 },
+	{ 46, 16 },
+	{ 0, 84 },
+	{ 0, 32 },
+	{ 117, 38 },
+	{ 59, 20 },
+	{ 0, 39 },
+	{ 1722, 98 },
+	{ 0, 96 },
+	{ 0, 20 },
+	{ 21, 31 },
+	{ 23, 113 },
+	{ 36, 92 },
+	{ 0, 113 },
+	{ 0, 92 },
+	{ 0, 31 },
+	{ 0, 16 },
+	{ 129, 70 },
+	{ 531, 71 },
+	{ 86, 53 },
+	{ 0, 70 },
+	{ 20, 125 },
+	{ 0, 71 },
+	{ 0, 125 },
+	{ 0, 38 },
+	{ 35, 8 },
+	{ 120, 51 },
+	{ 0, 8 },
+	{ 22, 50 },
+	{ 562, 18 },
+	{ 0, 51 },
+	{ 0, 77 },
+	{ 0, 57 },
+	{ 0, 50 },
+	{ 120, 64 },
+	{ 59, 123 },
+	{ 160, 106 },
+	{ 280, 115 },
+	{ 0, 64 },
+	{ 17, 121 },
+	{ 32, 8 },
+	{ 27, 14 },
+	{ 50, 127 },
+	{ 0, 14 },
+	{ 0, 8 },
+	{ 0, 121 },
+	{ 0, 106 },
+	{ 113, 68 },
+	{ 0, 127 },
+	{ 9, 11 },
+	{ 0, 11 },
+	{ 0, 53 },
+	{ 43, 106 },
+	{ 21, 82 },
+	{ 0, 68 },
+	{ 511, 59 },
+	{ 0, 82 },
+	{ 108, 6 },
+	{ 0, 115 },
+	{ 0, 123 },
+	{ 1738, 71 },
+	{ 12, 57 },
+	{ 32, 127 },
+	{ 0, 57 },
+	{ 0, 127 },
+	{ 0, 106 },
+	{ 0, 63 },
+	{ 0, 18 },
+	{ 17, 29 },
+	{ 104, 57 },
+	{ 290, 67 },
+	{ 159, 120 },
+	{ 0, 29 },
+	{ 48, 72 },
+	{ 27, 50 },
+	{ 0, 50 },
+	{ 0, 6 },
+	{ 0, 120 },
+	{ 33, 125 },
+	{ 38, 53 },
+	{ 0, 59 },
+	{ 37, 78 },
+	{ 0, 125 },
+	{ 48, 23 },
+	{ 0, 53 },
+	{ 19, 102 },
+	{ 0, 102 },
+	{ 126, 109 },
+	{ 0, 23 },
+	{ 0, 57 },
+	{ 44, 73 },
+	{ 192, 54 },
+	{ 0, 72 },
+	{ 50, 9 },
+	{ 14, 26 },
+	{ 0, 73 },
+	{ 184, 42 },
+	{ 0, 9 },
+	{ 0, 78 },
+	{ 0, 109 },
+	{ 23, 111 },
+	{ 21, 25 },
+	{ 187, 92 },
+	{ 0, 26 },
+	{ 191, 108 },
+	{ 93, 37 },
+	{ 350, 107 },
+	{ 0, 54 },
+	{ 0, 111 },
+	{ 0, 42 },
+	{ 9, 110 },
+	{ 45, 85 },
+	{ 0, 25 },
+	{ 0, 92 },
+	{ 310, 36 },
+	{ 14, 102 },
+	{ 269, 38 },
+	{ 0, 110 },
+	{ 26, 95 },
+	{ 0, 37 },
+	{ 10, 91 },
+	{ 0, 91 },
+	{ 0, 95 },
+	{ 0, 102 },
+	{ 0, 85 },
+	{ 0, 108 },
+	{ 50, 49 },
+	{ 486, 48 },
+	{ 29, 32 },
+	{ 24, 101 },
+	{ 0, 49 },
+	{ 0, 101 },
+	{ 50, 89 },
+	{ 42, 7 },
+	{ 0, 32 },
+	{ 45, 18 },
+	{ 0, 67 },
+	{ 35, 80 },
+	{ 45, 51 },
+	{ 0, 18 },
+	{ 35, 86 },
+	{ 47, 122 },
+	{ 35, 100 },
+	{ 0, 80 },
+	{ 0, 7 },
+	{ 0, 89 },
+	{ 0, 86 },
+	{ 161, 52 },
+	{ 0, 100 },
+	{ 0, 38 },
+	{ 0, 48 },
+	{ 0, 107 },
+	{ 109, 40 },
+	{ 194, 101 },
+	{ 0, 122 },
+	{ 0, 52 },
+	{ 0, 101 },
+	{ 0, 40 },
+	{ 23, 43 },
+	{ 0, 51 },
+	{ 191, 42 },
+	{ 591, 46 },
+	{ 21, 59 },
+	{ 312, 32 },
+	{ 44, 57 },
+	{ 14, 112 },
+	{ 21, 40 },
+	{ 0, 43 },
+	{ 0, 112 },
+	{ 0, 59 },
+	{ 292, 76 },
+	{ 45, 92 },
+	{ 0, 57 },
+	{ 0, 92 },
+	{ 0, 40 },
+	{ 39, 100 },
+	{ 0, 100 },
+	{ 32, 15 },
+	{ 0, 42 },
+	{ 45, 66 },
+	{ 74, 105 },
+	{ 0, 15 },
+	{ 0, 66 },
+	{ 15, 12 },
+	{ 79, 62 },
+	{ 10, 65 },
+	{ 0, 65 },
+	{ 45, 113 },
+	{ 32, 106 },
+	{ 37, 50 },
+	{ 0, 113 },
+	{ 15, 103 },
+	{ 43, 2 },
+	{ 0, 106 },
+	{ 10, 85 },
+	{ 0, 12 },
+	{ 0, 103 },
+	{ 43, 90 },
+	{ 0, 85 },
+	{ 0, 105 },
+	{ 0, 2 },
+	{ 0, 62 },
+	{ 0, 32 },
+	{ 0, 50 },
+	{ 0, 90 },
+	{ 16, 51 },
+	{ 14, 94 },
+	{ 227, 102 },
+	{ 204, 33 },
+	{ 114, 54 },
+	{ 14, 56 },
+	{ 0, 51 },
+	{ 0, 33 },
+	{ 0, 36 },
+	{ 84, 6 },
+	{ 0, 54 },
+	{ 0, 56 },
+	{ 404, 126 },
+	{ 0, 6 },
+	{ 0, 102 },
+	{ 41, 80 },
+	{ 0, 80 },
+	{ 50, 37 },
+	{ 26, 43 },
+	{ 0, 35 },
+	{ 148, 12 },
+	{ 166, 75 },
+	{ 0, 37 },
+	{ 0, 94 },
+	{ 15, 11 },
+	{ 0, 11 },
+	{ 419, 81 },
+	{ 129, 66 },
+	{ 1046, 60 },
+	{ 9, 97 },
+	{ 0, 43 },
+	{ 0, 97 },
+	{ 58, 54 },
+	{ 0, 54 },
+	{ 0, 12 },
+	{ 72, 70 },
+	{ 0, 88 },
+	{ 98, 40 },
+	{ 42, 67 },
+	{ 64, 51 },
+	{ 125, 94 },
+	{ 189, 108 },
+	{ 0, 75 },
+	{ 166, 88 },
+	{ 33, 91 },
+	{ 0, 91 },
+	{ 0, 94 },
+	{ 90, 106 },
+	{ 255, 3 },
+	{ 12, 47 },
+	{ 0, 67 },
+	{ 0, 66 },
+	{ 31, 52 },
+	{ 0, 108 },
+	{ 19, 55 },
+	{ 437, 125 },
+	{ 39, 25 },
+	{ 312, 102 },
+	{ 0, 55 },
+	{ 0, 47 },
+	{ 0, 125 },
+	{ 0, 76 },
+	{ 0, 25 },
+	{ 0, 46 },
+	{ 41, 26 },
+	{ 162, 94 },
+	{ 0, 70 },
+	{ 0, 51 },
+	{ 52, 118 },
+	{ 0, 40 },
+	{ 157, 90 },
+	{ 0, 26 },
+	{ 0, 88 },
+	{ 0, 81 },
+	{ 0, 52 },
+	{ 0, 106 },
+	{ 56, 47 },
+	{ 41, 56 },
+	{ 0, 102 },
+	{ 208, 4 },
+	{ 35, 113 },
+	{ 63, 100 },
+	{ 250, 29 },
+	{ 16, 44 },
+	{ 0, 56 },
+	{ 0, 118 },
+	{ 0, 113 },
+	{ 136, 119 },
+	{ 21, 8 },
+	{ 33, 54 },
+	{ 0, 44 },
+	{ 0, 90 },
+	{ 0, 119 },
+	{ 0, 54 },
+	{ 88, 20 },
+	{ 130, 127 },
+	{ 0, 127 },
+	{ 0, 8 },
+	{ 0, 47 },
+	{ 27, 112 },
+	{ 39, 124 },
+	{ 0, 20 },
+	{ 1045, 43 },
+	{ 0, 112 },
+	{ 284, 55 },
+	{ 14, 76 },
+	{ 41, 40 },
+	{ 14, 107 },
+	{ 0, 3 },
+	{ 0, 76 },
+	{ 0, 94 },
+	{ 82, 81 },
+	{ 28, 31 },
+	{ 152, 94 },
+	{ 0, 107 },
+	{ 0, 31 },
+	{ 0, 40 },
+	{ 0, 124 },
+	{ 0, 55 },
+	{ 48, 69 },
+	{ 38, 88 },
+	{ 131, 117 },
+	{ 571, 104 },
+	{ 0, 94 },
+	{ 0, 69 },
+	{ 0, 88 },
+	{ 586, 99 },
+	{ 116, 53 },
+	{ 0, 99 },
+	{ 84, 103 },
+	{ 0, 81 },
+	{ 398, 89 },
+	{ 0, 53 },
+	{ 28, 2 },
+	{ 380, 102 },
+	{ 0, 98 },
+	{ 0, 89 },
+	{ 53, 12 },
+	{ 0, 2 },
+	{ 179, 112 },
+	{ 28, 56 },
+	{ 0, 56 },
+	{ 0, 112 },
+	{ 137, 67 },
+	{ 351, 26 },
+	{ 26, 111 },
+	{ 12, 25 },
+	{ 0, 100 },
+	{ 0, 67 },
+	{ 0, 111 },
+	{ 548, 69 },
+	{ 0, 25 },
+	{ 75, 121 },
+	{ 53, 78 },
+	{ 38, 106 },
+	{ 132, 15 },
+	{ 0, 121 },
+	{ 0, 78 },
+	{ 107, 64 },
+	{ 0, 106 },
+	{ 30, 8 },
+	{ 0, 8 },
+	{ 25, 56 },
+	{ 26, 115 },
+	{ 0, 117 },
+	{ 81, 6 },
+	{ 19, 94 },
+	{ 0, 56 },
+	{ 0, 69 },
+	{ 0, 94 },
+	{ 0, 12 },
+	{ 0, 60 },
+	{ 0, 115 },
+	{ 12, 0 },
+	{ 438, 65 },
+	{ 0, 65 },
+	{ 241, 101 },
+	{ 1531, 1 },
+	{ 0, 6 },
+	{ 249, 73 },
+	{ 0, 0 },
+	{ 0, 15 },
+	{ 413, 10 },
+	{ 0, 104 },
+	{ 0, 101 },
+	{ 42, 86 },
+	{ 88, 87 },
+	{ 16, 61 },
+	{ 17, 56 },
+	{ 0, 61 },
+	{ 17, 101 },
+	{ 0, 56 },
+	{ 85, 47 },
+	{ 169, 114 },
+	{ 0, 64 },
+	{ 119, 92 },
+	{ 35, 52 },
+	{ 0, 71 },
+	{ 0, 114 },
+	{ 0, 92 },
+	{ 0, 52 },
+	{ 0, 86 },
+	{ 38, 38 },
+	{ 134, 25 },
+	{ 0, 38 },
+	{ 41, 70 },
+	{ 0, 101 },
+	{ 0, 103 },
+	{ 0, 87 },
+	{ 0, 70 },
+	{ 122, 15 },
+	{ 42, 61 },
+	{ 292, 5 },
+	{ 0, 25 },
+	{ 0, 15 },
+	{ 0, 47 },
+	{ 37, 40 },
+	{ 0, 40 },
+	{ 0, 5 },
+	{ 0, 61 },
+	{ 44, 88 },
+	{ 15, 105 },
+	{ 68, 110 },
+	{ 0, 88 },
+	{ 92, 96 },
+	{ 0, 105 },
+	{ 0, 1 },
+	{ 0, 96 },
+	{ 123, 114 },
+	{ 43, 76 },
+	{ 19, 121 },
+	{ 566, 90 },
+	{ 117, 125 },
+	{ 46, 97 },
+	{ 47, 84 },
+	{ 66, 2 },
+	{ 0, 121 },
+	{ 0, 125 },
+	{ 0, 2 },
+	{ 0, 76 },
+	{ 68, 75 },
+	{ 0, 75 },
+	{ 0, 84 },
+	{ 0, 114 },
+	{ 0, 97 },
+	{ 157, 21 },
+	{ 12, 92 },
+	{ 1907, 83 },
+	{ 13, 25 },
+	{ 0, 25 },
+	{ 0, 29 },
+	{ 45, 98 },
+	{ 0, 92 },
+	{ 45, 15 },
+	{ 0, 15 },
+	{ 19, 89 },
+	{ 0, 73 },
+	{ 0, 4 },
+	{ 0, 110 },
+	{ 490, 100 },
+	{ 261, 61 },
+	{ 0, 89 },
+	{ 47, 111 },
+	{ 106, 13 },
+	{ 0, 21 },
+	{ 120, 95 },
+	{ 0, 111 },
+	{ 492, 45 },
+	{ 0, 13 },
+	{ 0, 83 },
+	{ 464, 105 },
+	{ 205, 77 },
+	{ 103, 118 },
+	{ 0, 98 },
+	{ 0, 126 },
+	{ 0, 95 },
+	{ 0, 90 },
+	{ 179, 27 },
+	{ 104, 28 },
+	{ 227, 89 },
+	{ 82, 62 },
+	{ 154, 49 },
+	{ 0, 62 },
+	{ 0, 61 },
+	{ 35, 54 },
+	{ 494, 50 },
+	{ 938, 67 },
+	{ 26, 114 },
+	{ 0, 27 },
+	{ 32, 125 },
+	{ 0, 114 },
+	{ 259, 41 },
+	{ 0, 118 },
+	{ 0, 125 },
+	{ 0, 54 },
+	{ 35, 117 },
+	{ 37, 52 },
+	{ 17, 32 },
+	{ 0, 28 },
+	{ 0, 32 },
+	{ 0, 52 },
+	{ 415, 78 },
+	{ 0, 117 },
+	{ 242, 40 },
+	{ 406, 98 },
+	{ 192, 37 },
+	{ 8, 107 },
+	{ 41, 27 },
+	{ 0, 89 },
+	{ 185, 54 },
+	{ 0, 78 },
+	{ 0, 37 },
+	{ 0, 49 },
+	{ 415, 101 },
+	{ 1295, 91 },
+	{ 0, 10 },
+	{ 0, 107 },
+	{ 0, 102 },
+	{ 61, 56 },
+	{ 136, 118 },
+	{ 10, 83 },
+	{ 17, 24 },
+	{ 0, 24 },
+	{ 24, 64 },
+	{ 0, 98 },
+	{ 47, 31 },
+	{ 36, 94 },
+	{ 0, 105 },
+	{ 0, 54 },
+	{ 24, 120 },
+	{ 0, 94 },
+	{ 0, 27 },
+	{ 43, 104 },
+	{ 24, 4 },
+	{ 0, 104 },
+	{ 0, 101 },
+	{ 0, 4 },
+	{ 0, 31 },
+	{ 0, 83 },
+	{ 0, 45 },
+	{ 0, 56 },
+	{ 0, 120 },
+	{ 0, 64 },
+	{ 130, 36 },
+	{ 29, 126 },
+	{ 0, 100 },
+	{ 0, 36 },
+	{ 44, 110 },
+	{ 1560, 82 },
+	{ 8, 68 },
+	{ 223, 66 },
+	{ 376, 117 },
+	{ 26, 104 },
+	{ 0, 126 },
+	{ 0, 110 },
+	{ 299, 56 },
+	{ 0, 104 },
+	{ 467, 75 },
+	{ 30, 53 },
+	{ 191, 105 },
+	{ 0, 68 },
+	{ 0, 118 },
+	{ 0, 105 },
+	{ 0, 53 },
+	{ 0, 75 },
+	{ 46, 6 },
+	{ 0, 6 },
+	{ 31, 109 },
+	{ 0, 109 },
+	{ 0, 26 },
+	{ 130, 46 },
+	{ 287, 1 },
+	{ 0, 77 },
+	{ 30, 83 },
+	{ 30, 101 },
+	{ 0, 101 },
+	{ 215, 120 },
+	{ 0, 83 },
+	{ 330, 105 },
+	{ 268, 30 },
+	{ 0, 1 },
+	{ 48, 32 },
+	{ 22, 103 },
+	{ 11, 10 },
+	{ 310, 39 },
+	{ 25, 33 },
+	{ 0, 10 },
+	{ 33, 115 },
+	{ 0, 115 },
+	{ 0, 32 },
+	{ 0, 33 },
+	{ 0, 103 },
+	{ 0, 39 },
+	{ 113, 22 },
+	{ 11, 21 },
+	{ 0, 21 },
+	{ 248, 26 },
+	{ 0, 66 },
+	{ 27, 19 },
+	{ 0, 40 },
+	{ 28, 104 },
+	{ 0, 104 },
+	{ 19, 35 },
+	{ 0, 35 },
+	{ 188, 96 },
+	{ 311, 112 },
+	{ 0, 96 },
+	{ 69, 54 },
+	{ 0, 117 },
+	{ 44, 69 },
+	{ 69, 95 },
+	{ 374, 70 },
+	{ 19, 63 },
+	{ 38, 79 },
+	{ 0, 22 },
+	{ 0, 79 },
+	{ 0, 63 },
+	{ 0, 26 },
+	{ 0, 19 },
+	{ 0, 69 },
+	{ 0, 82 },
+	{ 0, 30 },
+	{ 0, 41 },
+	{ 0, 95 },
+	{ 0, 46 },
+	{ 0, 50 },
+	{ 0, 112 },
+	{ 0, 56 },
+	{ 0, 67 },
+	{ 0, 120 },
+	{ 0, 105 },
+	{ 0, 54 },
+	{ 0, 43 },
+	{ 0, 70 },
+	{ 0, 91 },
+};
@@ -0,0 +1,60 @@
+/*
+ * Copyright (c) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr.h>
+#include <syscall_handler.h>
+#include <misc/printk.h>
+
+/* Kernel object lookup benchmark: dynamic semaphores are allocated in
+ * growing numbers, and each time all of them are validated the way a
+ * system call handler does.  See README.rst.
+ */
+
+#define MAX_OBJECTS 1024
+#define ROUNDS 4
+
+static const int counts[] = { 1, 16, 64, 256, MAX_OBJECTS };
+
+static struct k_sem *sems[MAX_OBJECTS];
+
+void main(void)
+{
+	int allocated = 0;
+
+	k_thread_system_pool_assign(k_current_get());
+
+	for (int c = 0; c < ARRAY_SIZE(counts); c++) {
+		u32_t start, cycles;
+		int errors = 0;
+
+		for (; allocated < counts[c]; allocated++) {
+			sems[allocated] = k_object_alloc(K_OBJ_SEM);
+			if (sems[allocated] == NULL) {
+				printk("allocation %d failed\n", allocated);
+				return;
+			}
+			k_sem_init(sems[allocated], 0, 1);
+		}
+
+		start = k_cycle_get_32();
+		for (int r = 0; r < ROUNDS; r++) {
+			for (int i = 0; i < allocated; i++) {
+				errors += _k_object_validate(
+					_k_object_find(sems[i]), K_OBJ_SEM,
+					_OBJ_INIT_TRUE) != 0;
+			}
+		}
+		cycles = k_cycle_get_32() - start;
+
+		printk("%d objects: %u cycles/lookup%s\n", allocated,
+		       cycles / (ROUNDS * allocated),
+		       errors != 0 ? " (validation errors)" : "");
+	}
+
+	for (int i = 0; i < allocated; i++) {
+		k_object_free(sems[i]);
+	}
+}
@@ -0,0 +1,151 @@
+/*
+ * Copyright (c) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr.h>
+#include <string.h>
+#include <misc/printk.h>
+#include <logging/log.h>
+#include <logging/log_backend.h>
+#include <logging/log_ctrl.h>
+#include "smp_bench.h"
+
+LOG_MODULE_REGISTER(log_bench, LOG_LEVEL_INF);
+
+/* Logging SMP benchmark: one consumer thread pinned to CPU 0 processes
+ * messages while one producer thread pinned to each of CPUs 1..N logs
+ * as fast as it can, for a fixed time.  The number of messages logged,
+ * processed and dropped per second is reported, along with the number
+ * of messages the backend received out of order from the producer that
+ * logged them.  See README.rst.
+ */
+
+static volatile u32_t logged[SMP_BENCH_MAX_CPUS];
+static volatile bool consuming;
+
+static u32_t processed;
+static u32_t dropped_msgs;
+static u32_t out_of_order;
+static u32_t last_seq[SMP_BENCH_MAX_CPUS];
+static bool seen[SMP_BENCH_MAX_CPUS];
+
+static void put(struct log_backend const *const backend,
+		struct log_msg *msg)
+{
+	u32_t idx, seq;
+
+	processed++;
+
+	if (!log_msg_is_std(msg) || log_msg_nargs_get(msg) != 2) {
+		return;
+	}
+
+	/* Messages from different CPUs may interleave in any order, only
+	 * those of one producer must come in the order it logged them.
+	 * Drops may leave gaps.
+	 */
+	idx = log_msg_arg_get(msg, 0);
+	seq = log_msg_arg_get(msg, 1);
+	if (idx >= SMP_BENCH_MAX_CPUS) {
+		return;
+	}
+
+	if (seen[idx] && (s32_t)(seq - last_seq[idx]) <= 0) {
+		out_of_order++;
+	}
+
+	seen[idx] = true;
+	last_seq[idx] = seq;
+}
+
+static void dropped(struct log_backend const *const backend, u32_t cnt)
+{
+	dropped_msgs += cnt;
+}
+
+static void panic(struct log_backend const *const backend)
+{
+}
+
+const struct log_backend_api bench_backend_api = {
+	.put = put,
+	.panic = panic,
+	.dropped = dropped,
+};
+
+LOG_BACKEND_DEFINE(bench_backend, bench_backend_api, true);
+
+static void producer(int idx)
+{
+	while (smp_bench_running) {
+		LOG_INF("cpu %d msg %u", idx, logged[idx]);
+		logged[idx]++;
+	}
+}
+
+static void consumer(void)
+{
+	while (consuming) {
+		(void)log_process(false);
+	}
+
+	/* The producers have exited, drain what they left behind */
+	while (log_process(false)) {
+	}
+}
+
+/* Worker 0 is the consumer, workers 1..ncpus-1 the producers */
+static void worker(void *p1, void *p2, void *p3)
+{
+	int idx = (int)p1;
+
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	if (idx == 0) {
+		consumer();
+	} else {
+		producer(idx);
+	}
+}
+
+static void run(int ncpus)
+{
+	u64_t total = 0;
+
+	consuming = true;
+	processed = 0U;
+	dropped_msgs = 0U;
+	out_of_order = 0U;
+	for (int i = 0; i < ncpus; i++) {
+		logged[i] = 0U;
+		seen[i] = false;
+	}
+
+	smp_bench_start(ncpus, 1, worker);
+
+	/* Stop the producers first, so that the consumer's final drain
+	 * sees everything they logged
+	 */
+	k_sleep(SMP_BENCH_MEASURE_MS);
+	smp_bench_running = false;
+	smp_bench_join(1, ncpus - 1);
+	consuming = false;
+	smp_bench_join(0, 1);
+
+	for (int i = 1; i < ncpus; i++) {
+		total += logged[i];
+	}
+
+	printk("producers %d: %u logged/s, %u processed/s, %u dropped/s\n",
+	       ncpus - 1, smp_bench_rate(total), smp_bench_rate(processed),
+	       smp_bench_rate(dropped_msgs));
+	printk("             %u out of order\n", out_of_order);
+}
+
+void main(void)
+{
+	smp_bench_main(run, 2);
+}
@@ -0,0 +1,76 @@
+/*
+ * Copyright (c) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr.h>
+#include <misc/printk.h>
+#include "smp_bench.h"
+
+/* Memory slab SMP throughput benchmark: for 1 to 4 CPUs, one
+ * thread pinned to each CPU allocates and frees bursts of blocks
+ * from a single shared slab for a fixed time, and the total number
+ * of alloc/free pairs per second is reported.  See README.rst.
+ */
+
+#define BURST 4
+#define BLK_SIZE 64
+#define BLK_NUM (SMP_BENCH_MAX_CPUS * BURST * 4)
+
+K_MEM_SLAB_DEFINE(slab, BLK_SIZE, BLK_NUM, 4);
+
+static volatile u32_t pairs[SMP_BENCH_MAX_CPUS];
+
+static void worker(void *p1, void *p2, void *p3)
+{
+	int idx = (int)p1;
+	void *blocks[BURST];
+
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	while (smp_bench_running) {
+		/* Bursts rather than single pairs, like a driver
+		 * allocating a few buffers per packet
+		 */
+		for (int i = 0; i < BURST; i++) {
+			(void)k_mem_slab_alloc(&slab, &blocks[i], K_FOREVER);
+			*(volatile u32_t *)blocks[i] = idx;
+		}
+
+		for (int i = 0; i < BURST; i++) {
+			k_mem_slab_free(&slab, &blocks[i]);
+		}
+
+		pairs[idx] += BURST;
+	}
+}
+
+static void run(int ncpus)
+{
+	u64_t total = 0;
+
+	for (int i = 0; i < ncpus; i++) {
+		pairs[i] = 0;
+	}
+
+	/* The workers finish their burst before exiting, so that all
+	 * blocks are back when the slab accounting is printed
+	 */
+	smp_bench_start(ncpus, 1, worker);
+	smp_bench_measure(ncpus);
+
+	for (int i = 0; i < ncpus; i++) {
+		total += pairs[i];
+	}
+
+	printk("cpus %d: %u alloc/free pairs/s, %u blocks in use\n", ncpus,
+	       smp_bench_rate(total),
+	       k_mem_slab_num_used_get(&slab));
+}
+
+void main(void)
+{
+	smp_bench_main(run, 1);
+}
@@ -0,0 +1,147 @@
+/*
+ * Copyright (c) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr.h>
+#include <misc/printk.h>
+#include <net/net_core.h>
+#include <net/net_pkt.h>
+#include <net/net_ip.h>
+#include <net/net_if.h>
+
+#include "connection.h"
+
+/* Connection demultiplexing benchmark: UDP connection handlers are
+ * registered in growing numbers, and each time incoming packets are
+ * matched against them with net_conn_input().  See README.rst.
+ */
+
+#define MAX_CONNS CONFIG_NET_MAX_CONN
+#define ROUNDS 4
+
+#define LISTEN_PORT 4242
+#define LOCAL_PORT_BASE 10000
+#define REMOTE_PORT_BASE 20000
+#define UNKNOWN_PORT_BASE 40000
+
+static const int counts[] = { 8, 64, 512 };
+
+static struct net_conn_handle *handles[MAX_CONNS];
+static u32_t received;
+
+static struct in_addr peer_addr = { { { 192, 0, 2, 1 } } };
+static struct in_addr my_addr = { { { 192, 0, 2, 2 } } };
+
+static enum net_verdict recv_cb(struct net_conn *conn,
+				struct net_pkt *pkt,
+				union net_ip_header *ip_hdr,
+				union net_proto_header *proto_hdr,
+				void *user_data)
+{
+	received++;
+
+	/* Not consumed, the packet is reused for every lookup */
+	return NET_OK;
+}
+
+static int register_conn(int idx)
+{
+	struct sockaddr_in remote = {
+		.sin_family = AF_INET,
+		.sin_addr = peer_addr,
+	};
+
+	/* The first handler is the listener */
+	if (idx == 0) {
+		return net_conn_register(IPPROTO_UDP, AF_INET, NULL, NULL,
+					 0, LISTEN_PORT, recv_cb, NULL,
+					 &handles[idx]);
+	}
+
+	return net_conn_register(IPPROTO_UDP, AF_INET,
+				 (struct sockaddr *)&remote, NULL,
+				 REMOTE_PORT_BASE + idx,
+				 LOCAL_PORT_BASE + idx,
+				 recv_cb, NULL, &handles[idx]);
+}
+
+static u32_t lookup(struct net_pkt *pkt, union net_ip_header *ip_hdr,
+		    union net_proto_header *proto_hdr, u16_t src_port,
+		    u16_t dst_port)
+{
+	proto_hdr->udp->src_port = htons(src_port);
+	proto_hdr->udp->dst_port = htons(dst_port);
+
+	return net_conn_input(pkt, ip_hdr, IPPROTO_UDP, proto_hdr) == NET_OK;
+}
+
+void main(void)
+{
+	struct net_ipv4_hdr ipv4 = { 0 };
+	struct net_udp_hdr udp = { 0 };
+	union net_ip_header ip_hdr = { .ipv4 = &ipv4 };
+	union net_proto_header proto_hdr = { .udp = &udp };
+	struct net_pkt *pkt;
+	int registered = 0;
+
+	pkt = net_pkt_alloc_on_iface(net_if_get_default(), K_NO_WAIT);
+	if (pkt == NULL) {
+		printk("packet allocation failed\n");
+		return;
+	}
+
+	net_pkt_set_family(pkt, AF_INET);
+	net_ipaddr_copy(&ipv4.src, &peer_addr);
+	net_ipaddr_copy(&ipv4.dst, &my_addr);
+
+	for (int c = 0; c < ARRAY_SIZE(counts); c++) {
+		u32_t start, connected, listener;
+		u32_t expected;
+
+		for (; registered < counts[c]; registered++) {
+			if (register_conn(registered) < 0) {
+				printk("registration %d failed\n", registered);
+				goto out;
+			}
+		}
+
+		received = 0U;
+		expected = 0U;
+
+		start = k_cycle_get_32();
+		for (int r = 0; r < ROUNDS; r++) {
+			for (int i = 1; i < registered; i++) {
+				expected += lookup(pkt, &ip_hdr, &proto_hdr,
+						   REMOTE_PORT_BASE + i,
+						   LOCAL_PORT_BASE + i);
+			}
+		}
+		connected = k_cycle_get_32() - start;
+
+		start = k_cycle_get_32();
+		for (int r = 0; r < ROUNDS; r++) {
+			for (int i = 1; i < registered; i++) {
+				expected += lookup(pkt, &ip_hdr, &proto_hdr,
+						   UNKNOWN_PORT_BASE + i,
+						   LISTEN_PORT);
+			}
+		}
+		listener = k_cycle_get_32() - start;
+
+		printk("%d conns: %u cycles/connected, %u cycles/listener%s\n",
+		       registered, connected / (ROUNDS * (registered - 1)),
+		       listener / (ROUNDS * (registered - 1)),
+		       received != expected ||
+		       expected != 2 * ROUNDS * (registered - 1) ?
+		       " (lookup errors)" : "");
+	}
+
+out:
+	for (int i = 0; i < registered; i++) {
+		net_conn_unregister(handles[i]);
+	}
+
+	net_pkt_unref(pkt);
+}
@@ -0,0 +1,134 @@
+/*
+ * Copyright (c) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr.h>
+#include <misc/printk.h>
+
+/* Event loop wakeup benchmark: a high priority consumer thread waits
+ * on N semaphores, either with k_poll() or with a poll set, and the
+ * main thread gives them in turn.  The cycles per give/wakeup/wait
+ * round are reported for each N.  See README.rst.
+ */
+
+#define MAX_OBJS 64
+#define ROUNDS 1000
+#define STACK_SIZE 1024
+
+static struct k_sem sems[MAX_OBJS];
+static struct k_poll_event events[MAX_OBJS];
+
+static struct k_poll_event set_events[MAX_OBJS];
+static struct k_pollset set;
+
+static K_THREAD_STACK_DEFINE(stack, STACK_SIZE);
+static struct k_thread consumer;
+
+static volatile bool running;
+
+static void poll_consumer(void *p1, void *p2, void *p3)
+{
+	int num = (int)p1;
+
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	while (running) {
+		(void)k_poll(events, num, K_FOREVER);
+
+		for (int i = 0; i < num; i++) {
+			if (events[i].state == K_POLL_STATE_SEM_AVAILABLE) {
+				(void)k_sem_take(events[i].sem, K_NO_WAIT);
+			}
+			events[i].state = K_POLL_STATE_NOT_READY;
+		}
+	}
+}
+
+static void pollset_consumer(void *p1, void *p2, void *p3)
+{
+	struct k_poll_event ready[4];
+
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	while (running) {
+		int n = k_pollset_wait(&set, ready, ARRAY_SIZE(ready),
+				       K_FOREVER);
+
+		for (int i = 0; i < n; i++) {
+			(void)k_sem_take(ready[i].sem, K_NO_WAIT);
+		}
+	}
+}
+
+static u32_t run(k_thread_entry_t entry, int num)
+{
+	u32_t start, cycles;
+
+	for (int i = 0; i < num; i++) {
+		k_sem_reset(&sems[i]);
+	}
+
+	running = true;
+	k_thread_create(&consumer, stack, STACK_SIZE, entry,
+			(void *)num, NULL, NULL, K_PRIO_COOP(1), 0, 0);
+
+	/* Let the consumer block first */
+	k_yield();
+
+	start = k_cycle_get_32();
+	for (int i = 0; i < ROUNDS; i++) {
+		/* The consumer preempts us here and is back waiting
+		 * by the time k_sem_give() returns
+		 */
+		k_sem_give(&sems[i % num]);
+	}
+	cycles = k_cycle_get_32() - start;
+
+	running = false;
+	k_sem_give(&sems[0]);
+	k_thread_abort(&consumer);
+
+	return cycles / ROUNDS;
+}
+
+void main(void)
+{
+	static const int nums[] = { 1, 8, 16, 32, 64 };
+
+	for (int i = 0; i < MAX_OBJS; i++) {
+		k_sem_init(&sems[i], 0, 1);
+		k_poll_event_init(&events[i], K_POLL_TYPE_SEM_AVAILABLE,
+				  K_POLL_MODE_NOTIFY_ONLY, &sems[i]);
+	}
+
+	printk("poll benchmark: %d rounds per measurement\n", ROUNDS);
+
+	for (int i = 0; i < ARRAY_SIZE(nums); i++) {
+		int num = nums[i];
+		u32_t poll_cycles, set_cycles;
+
+		poll_cycles = run(poll_consumer, num);
+
+		k_pollset_init(&set, set_events, num);
+		for (int j = 0; j < num; j++) {
+			(void)k_pollset_add(&set, K_POLL_TYPE_SEM_AVAILABLE,
+					    &sems[j], j);
+		}
+		set_cycles = run(pollset_consumer, num);
+
+		printk("%2d objects: k_poll %6u cycles, k_pollset %6u cycles\n",
+		       num, poll_cycles, set_cycles);
+
+		/* Unregister the set from the semaphores before the next
+		 * k_pollset_init() throws its members away
+		 */
+		for (int j = 0; j < num; j++) {
+			(void)k_pollset_del(&set, &sems[j]);
+		}
+	}
+}
@@ -0,0 +1,112 @@
+/*
+ * Copyright (c) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr.h>
+#include <misc/printk.h>
+
+/* FIFO consumption benchmark: the main thread puts bursts of items on
+ * a FIFO and a higher priority consumer drains it either with
+ * k_fifo_get() or with k_fifo_get_batch().  The cycles per item are
+ * reported for each burst size.  See README.rst.
+ */
+
+#define MAX_BURST 64
+#define ITEMS 4096
+#define STACK_SIZE 1024
+
+struct item {
+	void *fifo_reserved;
+	u32_t seq;
+};
+
+static struct item items[MAX_BURST];
+
+K_FIFO_DEFINE(fifo);
+
+static K_THREAD_STACK_DEFINE(stack, STACK_SIZE);
+static struct k_thread consumer;
+
+static volatile u32_t consumed;
+
+static void single_consumer(void *p1, void *p2, void *p3)
+{
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	while (true) {
+		struct item *it = k_fifo_get(&fifo, K_FOREVER);
+
+		it->seq++;
+		consumed++;
+	}
+}
+
+static void batch_consumer(void *p1, void *p2, void *p3)
+{
+	void *batch[MAX_BURST];
+
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	while (true) {
+		int n = k_fifo_get_batch(&fifo, batch, ARRAY_SIZE(batch),
+					 K_FOREVER);
+
+		for (int i = 0; i < n; i++) {
+			((struct item *)batch[i])->seq++;
+		}
+		consumed += n;
+	}
+}
+
+static u32_t run(k_thread_entry_t entry, int burst)
+{
+	u32_t start, cycles;
+
+	consumed = 0;
+	k_thread_create(&consumer, stack, STACK_SIZE, entry,
+			NULL, NULL, NULL, K_PRIO_COOP(1), 0, 0);
+
+	start = k_cycle_get_32();
+	for (int sent = 0; sent < ITEMS; sent += burst) {
+		for (int i = 0; i < burst - 1; i++) {
+			items[i].fifo_reserved = &items[i + 1];
+		}
+		items[burst - 1].fifo_reserved = NULL;
+
+		/* The consumer preempts us and drains the whole burst
+		 * before this returns
+		 */
+		k_fifo_put_list(&fifo, &items[0], &items[burst - 1]);
+	}
+	cycles = k_cycle_get_32() - start;
+
+	k_thread_abort(&consumer);
+
+	if (consumed != ITEMS) {
+		printk("consumer lost items: %u/%u\n", consumed, ITEMS);
+	}
+
+	return cycles / ITEMS;
+}
+
+void main(void)
+{
+	static const int bursts[] = { 1, 4, 16, MAX_BURST };
+
+	printk("queue benchmark: %d items per measurement\n", ITEMS);
+
+	for (int i = 0; i < ARRAY_SIZE(bursts); i++) {
+		u32_t single = run(single_consumer, bursts[i]);
+		u32_t batch = run(batch_consumer, bursts[i]);
+
+		printk("burst %2d: k_fifo_get %5u cycles/item, "
+		       "k_fifo_get_batch %5u cycles/item\n",
+		       bursts[i], single, batch);
+	}
+}
@@ -0,0 +1,167 @@
+/*
+ * Copyright (c) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr.h>
+#include <misc/printk.h>
+#include <ring_buffer.h>
+
+/* Ring buffer throughput benchmark: several producer threads put data
+ * items into a ring buffer drained by one consumer thread, either a
+ * struct ring_buf under a spinlock or a lock-free struct ring_buf_mp.
+ * The cycles per item are reported for each number of producers.  See
+ * README.rst.
+ */
+
+#define MAX_PRODUCERS 4
+#define ITEMS 10000
+#define ITEM_WORDS 3
+#define STACK_SIZE 1024
+#define PRIO K_PRIO_PREEMPT(1)
+
+struct variant {
+	const char *name;
+	void (*init)(void);
+	int (*put)(u32_t *data);
+	int (*get)(u32_t *data);
+};
+
+RING_BUF_ITEM_DECLARE_POW2(locked_buf, 8);
+static struct k_spinlock lock;
+
+RING_BUF_MP_ITEM_DECLARE_POW2(mp_buf, 8);
+
+static K_THREAD_STACK_ARRAY_DEFINE(stacks, MAX_PRODUCERS + 1, STACK_SIZE);
+static struct k_thread threads[MAX_PRODUCERS + 1];
+
+K_SEM_DEFINE(done, 0, 1);
+
+static void locked_init(void)
+{
+	ring_buf_init(&locked_buf, locked_buf.size, locked_buf.buf.buf32);
+}
+
+static int locked_put(u32_t *data)
+{
+	k_spinlock_key_t key = k_spin_lock(&lock);
+	int ret = ring_buf_item_put(&locked_buf, 0, 0, data, ITEM_WORDS);
+
+	k_spin_unlock(&lock, key);
+
+	return ret;
+}
+
+static int locked_get(u32_t *data)
+{
+	k_spinlock_key_t key = k_spin_lock(&lock);
+	u8_t size32 = ITEM_WORDS;
+	u16_t type;
+	u8_t value;
+	int ret = ring_buf_item_get(&locked_buf, &type, &value, data,
+				    &size32);
+
+	k_spin_unlock(&lock, key);
+
+	return ret;
+}
+
+static void mp_init(void)
+{
+	ring_buf_mp_init(&mp_buf, mp_buf.size, mp_buf.buf.buf32);
+}
+
+static int mp_put(u32_t *data)
+{
+	return ring_buf_mp_item_put(&mp_buf, 0, 0, data, ITEM_WORDS);
+}
+
+static int mp_get(u32_t *data)
+{
+	u8_t size32 = ITEM_WORDS;
+	u16_t type;
+	u8_t value;
+
+	return ring_buf_mp_item_get(&mp_buf, &type, &value, data, &size32);
+}
+
+static const struct variant variants[] = {
+	{ "locked", locked_init, locked_put, locked_get },
+	{ "lock-free", mp_init, mp_put, mp_get },
+};
+
+static void producer(void *p1, void *p2, void *p3)
+{
+	const struct variant *v = p1;
+	u32_t data[ITEM_WORDS] = { 0 };
+
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	for (u32_t i = 0; i < ITEMS; i++) {
+		data[0] = i;
+		while (v->put(data) != 0) {
+			k_yield();
+		}
+	}
+}
+
+static void consumer(void *p1, void *p2, void *p3)
+{
+	const struct variant *v = p1;
+	u32_t total = POINTER_TO_UINT(p2);
+	u32_t data[ITEM_WORDS];
+
+	ARG_UNUSED(p3);
+
+	for (u32_t n = 0; n < total; ) {
+		if (v->get(data) == 0) {
+			n++;
+		} else {
+			k_yield();
+		}
+	}
+
+	k_sem_give(&done);
+}
+
+static u32_t run(const struct variant *v, int producers)
+{
+	u32_t total = producers * ITEMS;
+	u32_t start, cycles;
+
+	v->init();
+
+	start = k_cycle_get_32();
+	k_thread_create(&threads[0], stacks[0], STACK_SIZE, consumer,
+			(void *)v, UINT_TO_POINTER(total), NULL, PRIO, 0, 0);
+	for (int i = 1; i <= producers; i++) {
+		k_thread_create(&threads[i], stacks[i], STACK_SIZE, producer,
+				(void *)v, NULL, NULL, PRIO, 0, 0);
+	}
+
+	k_sem_take(&done, K_FOREVER);
+	cycles = k_cycle_get_32() - start;
+
+	for (int i = 0; i <= producers; i++) {
+		k_thread_abort(&threads[i]);
+	}
+
+	return cycles / total;
+}
+
+void main(void)
+{
+	printk("ring buffer benchmark: %d items per producer, %d CPUs\n",
+	       ITEMS, CONFIG_MP_NUM_CPUS);
+
+	for (int producers = 1; producers <= MAX_PRODUCERS; producers *= 2) {
+		u32_t locked = run(&variants[0], producers);
+		u32_t lock_free = run(&variants[1], producers);
+
+		printk("%d producers: %s %5u cycles/item, "
+		       "%s %5u cycles/item\n", producers,
+		       variants[0].name, locked, variants[1].name, lock_free);
+	}
+}
@@ -0,0 +1,52 @@
+/*
+ * Copyright (c) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr.h>
+#include <misc/printk.h>
+#include "smp_bench.h"
+
+/* SMP context switch throughput benchmark: for 1 to 4 CPUs, a
+ * pair of threads pinned to each CPU yields back and forth for a
+ * fixed time, and the total switch rate is reported.  See README.rst.
+ */
+
+static volatile u32_t switches[SMP_BENCH_THREADS];
+
+static void yielder(void *p1, void *p2, void *p3)
+{
+	int idx = (int)p1;
+
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	while (smp_bench_running) {
+		switches[idx]++;
+		k_yield();
+	}
+}
+
+static void run(int ncpus)
+{
+	u64_t total = 0;
+
+	for (int i = 0; i < 2 * ncpus; i++) {
+		switches[i] = 0;
+	}
+
+	smp_bench_start(2 * ncpus, 2, yielder);
+	smp_bench_measure(2 * ncpus);
+
+	for (int i = 0; i < 2 * ncpus; i++) {
+		total += switches[i];
+	}
+
+	printk("cpus %d: %u switches/s\n", ncpus, smp_bench_rate(total));
+}
+
+void main(void)
+{
+	smp_bench_main(run, 1);
+}
@@ -0,0 +1,185 @@
+/*
+ * Copyright (c) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr.h>
+#include <misc/printk.h>
+#include <net/socket.h>
+
+/* Socket readiness benchmark: UDP sockets are opened in growing numbers,
+ * a few of them receive a datagram each round, and the cost of finding
+ * them with poll() and with epoll_wait() is compared.  See README.rst.
+ */
+
+#define MAX_SOCKETS 128
+#define ACTIVE 4
+#define ROUNDS 64
+
+#define PORT_BASE 10000
+
+/* Time for the loopback interface to deliver the datagrams of a round */
+#define DELIVERY_TIME K_MSEC(5)
+
+static const int counts[] = { 8, 32, 128 };
+
+static int socks[MAX_SOCKETS];
+static struct pollfd pfds[MAX_SOCKETS];
+
+static struct sockaddr_in addr = {
+	.sin_family = AF_INET,
+};
+
+static int send_round(int c_sock, int count)
+{
+	/* Spread the active sockets over the set */
+	for (int i = 0; i < ACTIVE; i++) {
+		addr.sin_port = htons(PORT_BASE + i * count / ACTIVE);
+
+		if (sendto(c_sock, "x", 1, 0, (struct sockaddr *)&addr,
+			   sizeof(addr)) < 0) {
+			return -errno;
+		}
+	}
+
+	k_sleep(DELIVERY_TIME);
+
+	return 0;
+}
+
+static int bench_poll(int c_sock, int count, u32_t *cycles)
+{
+	char buf[4];
+
+	*cycles = 0U;
+
+	for (int r = 0; r < ROUNDS; r++) {
+		int received = 0;
+
+		if (send_round(c_sock, count) < 0) {
+			return -1;
+		}
+
+		while (received < ACTIVE) {
+			u32_t start = k_cycle_get_32();
+			int ret = poll(pfds, count, -1);
+
+			*cycles += k_cycle_get_32() - start;
+			if (ret <= 0) {
+				return -1;
+			}
+
+			for (int i = 0; i < count; i++) {
+				if (pfds[i].revents & POLLIN) {
+					recv(socks[i], buf, sizeof(buf), 0);
+					received++;
+				}
+			}
+		}
+	}
+
+	return 0;
+}
+
+static int bench_epoll(int ep, int c_sock, int count, u32_t *cycles)
+{
+	struct epoll_event events[ACTIVE];
+	char buf[4];
+
+	*cycles = 0U;
+
+	for (int r = 0; r < ROUNDS; r++) {
+		int received = 0;
+
+		if (send_round(c_sock, count) < 0) {
+			return -1;
+		}
+
+		while (received < ACTIVE) {
+			u32_t start = k_cycle_get_32();
+			int ret = epoll_wait(ep, events, ARRAY_SIZE(events),
+					     -1);
+
+			*cycles += k_cycle_get_32() - start;
+			if (ret <= 0) {
+				return -1;
+			}
+
+			for (int i = 0; i < ret; i++) {
+				recv(events[i].data.fd, buf, sizeof(buf), 0);
+				received++;
+			}
+		}
+	}
+
+	return 0;
+}
+
+static int open_socket(int ep, int idx)
+{
+	struct epoll_event ev = {
+		.events = EPOLLIN,
+	};
+
+	socks[idx] = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+	if (socks[idx] < 0) {
+		return -1;
+	}
+
+	addr.sin_port = htons(PORT_BASE + idx);
+	if (bind(socks[idx], (struct sockaddr *)&addr, sizeof(addr)) < 0) {
+		return -1;
+	}
+
+	pfds[idx].fd = socks[idx];
+	pfds[idx].events = POLLIN;
+
+	ev.data.fd = socks[idx];
+
+	return epoll_ctl(ep, EPOLL_CTL_ADD, socks[idx], &ev);
+}
+
+void main(void)
+{
+	int opened = 0;
+	int c_sock, ep;
+
+	inet_pton(AF_INET, CONFIG_NET_CONFIG_MY_IPV4_ADDR, &addr.sin_addr);
+
+	c_sock = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+	ep = epoll_create1(0);
+	if (c_sock < 0 || ep < 0) {
+		printk("setup failed (%d)\n", errno);
+		return;
+	}
+
+	for (int c = 0; c < ARRAY_SIZE(counts); c++) {
+		u32_t poll_cycles, epoll_cycles;
+
+		for (; opened < counts[c]; opened++) {
+			if (open_socket(ep, opened) < 0) {
+				printk("socket %d failed (%d)\n", opened, errno);
+				goto out;
+			}
+		}
+
+		if (bench_poll(c_sock, opened, &poll_cycles) < 0 ||
+		    bench_epoll(ep, c_sock, opened, &epoll_cycles) < 0) {
+			printk("%d sockets: wait failed (%d)\n", opened, errno);
+			goto out;
+		}
+
+		printk("%d sockets, %d active: %u cycles/poll, "
+		       "%u cycles/epoll_wait\n", opened, ACTIVE,
+		       poll_cycles / ROUNDS, epoll_cycles / ROUNDS);
+	}
+
+out:
+	for (int i = 0; i < opened; i++) {
+		close(socks[i]);
+	}
+
+	close(ep);
+	close(c_sock);
+}
@@ -0,0 +1,177 @@
+/*
+ * Copyright (c) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr.h>
+#include <misc/printk.h>
+#include <net/socket.h>
+
+/* UDP packets-per-second benchmark: datagrams are sent to a socket bound
+ * on the loopback interface and read back, one per call with sendto() and
+ * recvfrom(), then in batches with sendmmsg() and recvmmsg().  See
+ * README.rst.
+ */
+
+#define SERVER_PORT 4242
+#define PAYLOAD_SIZE 64
+#define BATCH 16
+#define ROUNDS 256
+
+#define STACK_SIZE 4096
+
+static K_THREAD_STACK_DEFINE(bench_stack, STACK_SIZE);
+static struct k_thread bench_thread;
+
+static void report(const char *name, u32_t elapsed)
+{
+	elapsed = MAX(elapsed, 1U);
+
+	printk("%s: %u datagrams in %u ms, %u pps\n", name, ROUNDS * BATCH,
+	       elapsed, (u32_t)((u64_t)ROUNDS * BATCH * 1000U / elapsed));
+}
+
+static int run_single(int c_sock, int s_sock, struct sockaddr_in *addr,
+		      u8_t (*buf)[PAYLOAD_SIZE])
+{
+	u32_t start = k_uptime_get_32();
+
+	for (int r = 0; r < ROUNDS; r++) {
+		for (int i = 0; i < BATCH; i++) {
+			if (sendto(c_sock, buf[i], PAYLOAD_SIZE, 0,
+				   (struct sockaddr *)addr,
+				   sizeof(*addr)) != PAYLOAD_SIZE) {
+				return -errno;
+			}
+		}
+
+		for (int i = 0; i < BATCH; i++) {
+			if (recvfrom(s_sock, buf[i], PAYLOAD_SIZE, 0,
+				     NULL, NULL) != PAYLOAD_SIZE) {
+				return -errno;
+			}
+		}
+	}
+
+	report("sendto/recvfrom", k_uptime_get_32() - start);
+
+	return 0;
+}
+
+static int run_batched(int c_sock, int s_sock, struct sockaddr_in *addr,
+		       u8_t (*buf)[PAYLOAD_SIZE])
+{
+	struct mmsghdr msgvec[BATCH];
+	struct iovec iov[BATCH];
+	u32_t start;
+
+	memset(msgvec, 0, sizeof(msgvec));
+	for (int i = 0; i < BATCH; i++) {
+		iov[i].iov_base = buf[i];
+		iov[i].iov_len = PAYLOAD_SIZE;
+		msgvec[i].msg_hdr.msg_iov = &iov[i];
+		msgvec[i].msg_hdr.msg_iovlen = 1;
+	}
+
+	start = k_uptime_get_32();
+
+	for (int r = 0; r < ROUNDS; r++) {
+		int done;
+
+		for (int i = 0; i < BATCH; i++) {
+			msgvec[i].msg_hdr.msg_name = addr;
+			msgvec[i].msg_hdr.msg_namelen = sizeof(*addr);
+		}
+
+		for (int i = 0; i < BATCH; i += done) {
+			done = sendmmsg(c_sock, &msgvec[i], BATCH - i, 0);
+			if (done <= 0) {
+				return -errno;
+			}
+		}
+
+		for (int i = 0; i < BATCH; i++) {
+			msgvec[i].msg_hdr.msg_name = NULL;
+			msgvec[i].msg_hdr.msg_namelen = 0;
+		}
+
+		for (int i = 0; i < BATCH; i += done) {
+			done = recvmmsg(s_sock, &msgvec[i], BATCH - i, 0,
+					NULL);
+			if (done <= 0) {
+				return -errno;
+			}
+		}
+	}
+
+	report("sendmmsg/recvmmsg", k_uptime_get_32() - start);
+
+	return 0;
+}
+
+static void bench(void *p1, void *p2, void *p3)
+{
+	struct sockaddr_in addr = {
+		.sin_family = AF_INET,
+		.sin_port = htons(SERVER_PORT),
+	};
+	u8_t buf[BATCH][PAYLOAD_SIZE];
+	int c_sock, s_sock;
+	int ret;
+
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	inet_pton(AF_INET, CONFIG_NET_CONFIG_MY_IPV4_ADDR, &addr.sin_addr);
+	memset(buf, 0xa5, sizeof(buf));
+
+	s_sock = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+	c_sock = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+	if (s_sock < 0 || c_sock < 0) {
+		printk("socket failed (%d)\n", errno);
+		return;
+	}
+
+	if (bind(s_sock, (struct sockaddr *)&addr, sizeof(addr)) < 0) {
+		printk("bind failed (%d)\n", errno);
+		goto out;
+	}
+
+	ret = run_single(c_sock, s_sock, &addr, buf);
+	if (ret == 0) {
+		ret = run_batched(c_sock, s_sock, &addr, buf);
+	}
+
+	if (ret < 0) {
+		printk("transfer failed (%d)\n", ret);
+	}
+
+out:
+	close(c_sock);
+	close(s_sock);
+}
+
+void main(void)
+{
+	u32_t options = 0U;
+
+	if (IS_ENABLED(CONFIG_USERSPACE)) {
+		options = K_USER | K_INHERIT_PERMS;
+	}
+
+	printk("%s mode, %d byte datagrams, batches of %d\n",
+	       options ? "user" : "supervisor", PAYLOAD_SIZE, BATCH);
+
+	k_thread_create(&bench_thread, bench_stack, STACK_SIZE, bench,
+			NULL, NULL, NULL, K_PRIO_PREEMPT(8), options,
+			K_FOREVER);
+
+#if defined(CONFIG_USERSPACE)
+	/* The batched calls copy the message vectors to the kernel heap */
+	k_thread_system_pool_assign(&bench_thread);
+#endif
+
+	k_thread_start(&bench_thread);
+}
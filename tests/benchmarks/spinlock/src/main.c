@@ -0,0 +1,83 @@
+/*
+ * Copyright (c) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr.h>
+#include <spinlock.h>
+#include <string.h>
+#include <misc/printk.h>
+#include "smp_bench.h"
+
+/* Spinlock SMP benchmark: for 1 to 4 CPUs, one thread pinned to
+ * each CPU takes and releases a single shared spinlock for a fixed
+ * time.  The total number of acquisitions per second, their spread
+ * among CPUs and the lock's contention statistics are reported.  See
+ * README.rst.
+ */
+
+#define SHARED_WORDS 4
+
+static struct k_spinlock lock;
+static volatile u32_t shared[SHARED_WORDS];
+
+static volatile u32_t locks[SMP_BENCH_MAX_CPUS];
+
+static void worker(void *p1, void *p2, void *p3)
+{
+	int idx = (int)p1;
+	k_spinlock_key_t key;
+
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	while (smp_bench_running) {
+		key = k_spin_lock(&lock);
+
+		/* A short critical section touching a few words, like
+		 * a kernel object update
+		 */
+		for (int i = 0; i < SHARED_WORDS; i++) {
+			shared[i] += idx;
+		}
+
+		k_spin_unlock(&lock, key);
+
+		locks[idx]++;
+	}
+}
+
+static void run(int ncpus)
+{
+	u32_t min = UINT32_MAX, max = 0U;
+	u64_t total = 0;
+
+	memset(&lock.stats, 0, sizeof(lock.stats));
+	for (int i = 0; i < ncpus; i++) {
+		locks[i] = 0;
+	}
+
+	smp_bench_start(ncpus, 1, worker);
+	smp_bench_measure(ncpus);
+
+	for (int i = 0; i < ncpus; i++) {
+		total += locks[i];
+		min = MIN(min, locks[i]);
+		max = MAX(max, locks[i]);
+	}
+
+	printk("cpus %d: %u locks/s, per cpu %u..%u\n", ncpus,
+	       smp_bench_rate(total), min, max);
+	printk("        %u%% contended, %u spins/contended lock, "
+	       "%u cycles max hold\n",
+	       (u32_t)((u64_t)lock.stats.contended * 100 /
+		       MAX(lock.stats.acquired, 1)),
+	       lock.stats.spins / MAX(lock.stats.contended, 1),
+	       lock.stats.hold_max);
+}
+
+void main(void)
+{
+	smp_bench_main(run, 1);
+}
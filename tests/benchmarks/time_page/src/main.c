@@ -0,0 +1,97 @@
+/*
+ * Copyright (c) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr.h>
+#include <app_memory/app_memdomain.h>
+#include <misc/printk.h>
+
+/* Time read benchmark: a user thread reads the uptime through the
+ * k_uptime_get() system call and through the time page, and the
+ * average cycles per read of each are reported.  See README.rst.
+ */
+
+#define READS 10000
+#define STACK_SIZE 1024
+
+K_APPMEM_PARTITION_DEFINE(bench_partition);
+#define BENCH_BMEM K_APP_BMEM(bench_partition)
+
+BENCH_BMEM static volatile s64_t sink;
+
+static u32_t syscall_cycles;
+static u32_t page_cycles;
+
+static struct k_mem_domain bench_domain;
+static K_THREAD_STACK_DEFINE(user_stack, STACK_SIZE);
+static struct k_thread user_thread;
+
+static void read_uptime(bool fast)
+{
+	for (int i = 0; i < READS; i++) {
+		sink = fast ? k_uptime_get_fast() : k_uptime_get();
+	}
+}
+
+static u32_t measure(bool fast)
+{
+	u32_t start = k_cycle_get_32();
+
+	read_uptime(fast);
+
+	return k_cycle_get_32() - start;
+}
+
+static void user_fn(void *p1, void *p2, void *p3)
+{
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	read_uptime((bool)(uintptr_t)p1);
+}
+
+/* k_cycle_get_32() reads the timer hardware, which user threads have
+ * no access to, so the timestamps are taken by main around the whole
+ * life of the user thread.  The user thread has a higher priority than
+ * main and never blocks, so it is done when k_thread_start() returns.
+ */
+static u32_t measure_user(bool fast)
+{
+	u32_t start;
+
+	k_thread_create(&user_thread, user_stack, STACK_SIZE, user_fn,
+			(void *)(uintptr_t)fast, NULL, NULL, -1, K_USER,
+			K_FOREVER);
+	k_mem_domain_add_thread(&bench_domain, &user_thread);
+
+	start = k_cycle_get_32();
+	k_thread_start(&user_thread);
+	return k_cycle_get_32() - start;
+}
+
+static void report(const char *mode)
+{
+	printk("%s:\n", mode);
+	printk("  syscall: %u cycles/read\n", syscall_cycles / READS);
+	printk("  time page: %u cycles/read\n", page_cycles / READS);
+}
+
+void main(void)
+{
+	struct k_mem_partition *parts[] = {
+		&bench_partition,
+		&z_time_page_partition
+	};
+
+	k_mem_domain_init(&bench_domain, ARRAY_SIZE(parts), parts);
+
+	syscall_cycles = measure_user(false);
+	page_cycles = measure_user(true);
+	report("user mode");
+
+	syscall_cycles = measure(false);
+	page_cycles = measure(true);
+	report("supervisor mode");
+}
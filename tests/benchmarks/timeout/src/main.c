@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr.h>
+#include <misc/printk.h>
+
+/* This is a timeout queue microbenchmark.  It measures the cost of
+ * adding, querying and aborting a timeout while a growing number of
+ * other timeouts is pending.  See README.rst for details.
+ */
+
+#define MAX_PENDING 512
+#define N_RUNS 200
+
+static const int sweep[] = { 1, 8, 64, 256, MAX_PENDING };
+
+static struct k_timer timers[MAX_PENDING];
+static struct k_timer probe;
+
+static u32_t t_start, t_remaining, t_stop;
+
+static void measure(int runs)
+{
+	t_start = t_remaining = t_stop = 0U;
+
+	for (int i = 0; i < runs; i++) {
+		/* Spread the probe over the whole range of pending
+		 * timeouts so the list backend has to walk a varying
+		 * distance
+		 */
+		s32_t duration = K_SECONDS(10) + (i % MAX_PENDING) * 7;
+		u32_t t0, t1, t2, t3;
+
+		t0 = k_cycle_get_32();
+		k_timer_start(&probe, duration, 0);
+		t1 = k_cycle_get_32();
+		(void)k_timer_remaining_get(&probe);
+		t2 = k_cycle_get_32();
+		k_timer_stop(&probe);
+		t3 = k_cycle_get_32();
+
+		t_start += t1 - t0;
+		t_remaining += t2 - t1;
+		t_stop += t3 - t2;
+	}
+}
+
+void main(void)
+{
+	int pending = 0;
+
+	k_timer_init(&probe, NULL, NULL);
+
+	for (int i = 0; i < ARRAY_SIZE(sweep); i++) {
+		/* Background timers get long, interleaved durations
+		 * so none of them expires during the measurement
+		 */
+		while (pending < sweep[i]) {
+			k_timer_init(&timers[pending], NULL, NULL);
+			k_timer_start(&timers[pending],
+				      K_SECONDS(5) + (pending * 13) % 10000, 0);
+			pending++;
+		}
+
+		/* Warm up caches, then measure */
+		measure(10);
+		measure(N_RUNS);
+
+		printk("pending %4d: start %5d remaining %5d stop %5d\n",
+		       pending, t_start / N_RUNS, t_remaining / N_RUNS,
+		       t_stop / N_RUNS);
+	}
+
+	for (int i = 0; i < pending; i++) {
+		k_timer_stop(&timers[i]);
+	}
+
+	printk("fin\n");
+}
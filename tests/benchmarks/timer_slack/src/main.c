@@ -0,0 +1,59 @@
+/*
+ * Copyright (c) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr.h>
+#include <misc/printk.h>
+
+/* Timer slack benchmark: a set of periodic timers runs for a while
+ * without and then with slack, and the rate of timer wakeups taken to
+ * serve them is computed from the timeout statistics.  See README.rst.
+ */
+
+#define NUM_TIMERS 8
+#define BASE_PERIOD 100
+#define PERIOD_STEP 10
+#define RUN_MS 5000
+
+static struct k_timer timers[NUM_TIMERS];
+
+static void run(const char *name, bool slack)
+{
+	struct k_timeout_stats before, after;
+	s64_t start, elapsed;
+
+	for (int i = 0; i < NUM_TIMERS; i++) {
+		s32_t period = BASE_PERIOD + i * PERIOD_STEP;
+
+		k_timer_start_slack(&timers[i], period, period,
+				    slack ? period / 4 : 0);
+	}
+
+	k_timeout_stats_get(&before);
+	start = k_uptime_get();
+	k_sleep(RUN_MS);
+	k_timeout_stats_get(&after);
+	elapsed = k_uptime_get() - start;
+
+	for (int i = 0; i < NUM_TIMERS; i++) {
+		k_timer_stop(&timers[i]);
+	}
+
+	printk("%s %u wakeups/s, %u expirations/s\n", name,
+	       (u32_t)((after.announces - before.announces) * MSEC_PER_SEC /
+		       elapsed),
+	       (u32_t)((after.expired - before.expired) * MSEC_PER_SEC /
+		       elapsed));
+}
+
+void main(void)
+{
+	for (int i = 0; i < NUM_TIMERS; i++) {
+		k_timer_init(&timers[i], NULL, NULL);
+	}
+
+	run("no slack:", false);
+	run("slack:   ", true);
+}
@@ -0,0 +1,216 @@
+/*
+ * Copyright (c) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr.h>
+#include <misc/printk.h>
+
+/* Data passing benchmark: the main thread produces messages into a
+ * message queue or a pipe and a higher priority consumer reads them,
+ * either copying them in and out with the regular calls or working in
+ * place in the ring buffer with the claim/finish calls.  The cycles per
+ * message are reported for each message size.  See README.rst.
+ */
+
+#define MAX_MSG_SIZE 256
+#define MSGQ_LEN 8
+#define PIPE_SIZE 1024
+#define MSGS 2048
+#define STACK_SIZE (1024 + MAX_MSG_SIZE)
+
+static char __aligned(4) msgq_buf[MAX_MSG_SIZE * MSGQ_LEN];
+static struct k_msgq msgq;
+
+K_PIPE_DEFINE(pipe, PIPE_SIZE, 4);
+
+static K_THREAD_STACK_DEFINE(stack, STACK_SIZE);
+static struct k_thread consumer;
+
+static u8_t tx_buf[MAX_MSG_SIZE];
+
+static volatile u32_t consumed;
+static volatile u32_t sum;
+
+static void produce(u8_t *data, size_t size, u32_t seq)
+{
+	for (size_t i = 0; i < size; i++) {
+		data[i] = (u8_t)(seq + i);
+	}
+}
+
+static u32_t consume(const u8_t *data, size_t size)
+{
+	u32_t s = 0;
+
+	for (size_t i = 0; i < size; i++) {
+		s += data[i];
+	}
+
+	return s;
+}
+
+static void msgq_copy_consumer(void *p1, void *p2, void *p3)
+{
+	size_t size = (size_t)p1;
+	u8_t rx_buf[MAX_MSG_SIZE];
+
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	while (true) {
+		(void)k_msgq_get(&msgq, rx_buf, K_FOREVER);
+		sum += consume(rx_buf, size);
+		consumed++;
+	}
+}
+
+static void msgq_claim_consumer(void *p1, void *p2, void *p3)
+{
+	size_t size = (size_t)p1;
+	void *msg;
+
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	while (true) {
+		(void)k_msgq_get_claim(&msgq, &msg, K_FOREVER);
+		sum += consume(msg, size);
+		(void)k_msgq_get_finish(&msgq);
+		consumed++;
+	}
+}
+
+static void msgq_copy_producer(size_t size, u32_t seq)
+{
+	produce(tx_buf, size, seq);
+	(void)k_msgq_put(&msgq, tx_buf, K_FOREVER);
+}
+
+static void msgq_claim_producer(size_t size, u32_t seq)
+{
+	void *slot;
+
+	(void)k_msgq_put_claim(&msgq, &slot, K_FOREVER);
+	produce(slot, size, seq);
+	(void)k_msgq_put_finish(&msgq);
+}
+
+static void pipe_copy_consumer(void *p1, void *p2, void *p3)
+{
+	size_t size = (size_t)p1;
+	u8_t rx_buf[MAX_MSG_SIZE];
+	size_t bytes_read;
+
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	while (true) {
+		(void)k_pipe_get(&pipe, rx_buf, size, &bytes_read, size,
+				 K_FOREVER);
+		sum += consume(rx_buf, size);
+		consumed++;
+	}
+}
+
+static void pipe_claim_consumer(void *p1, void *p2, void *p3)
+{
+	size_t msg_size = (size_t)p1;
+	size_t left = msg_size;
+	unsigned char *data;
+	size_t size;
+
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	while (true) {
+		/* A message may wrap around the end of the ring buffer */
+		size = left;
+		(void)k_pipe_get_claim(&pipe, &data, &size, K_FOREVER);
+		sum += consume(data, size);
+		(void)k_pipe_get_finish(&pipe, size);
+
+		left -= size;
+		if (left == 0) {
+			left = msg_size;
+			consumed++;
+		}
+	}
+}
+
+static void pipe_copy_producer(size_t size, u32_t seq)
+{
+	size_t bytes_written;
+
+	produce(tx_buf, size, seq);
+	(void)k_pipe_put(&pipe, tx_buf, size, &bytes_written, size,
+			 K_FOREVER);
+}
+
+static void pipe_claim_producer(size_t msg_size, u32_t seq)
+{
+	unsigned char *data;
+	size_t size;
+
+	for (size_t done = 0; done < msg_size; done += size) {
+		size = msg_size - done;
+		(void)k_pipe_put_claim(&pipe, &data, &size, K_FOREVER);
+		produce(data, size, seq + done);
+		(void)k_pipe_put_finish(&pipe, size);
+	}
+}
+
+static u32_t run(k_thread_entry_t entry, void (*producer)(size_t, u32_t),
+		 size_t size)
+{
+	u32_t start, cycles;
+
+	consumed = 0;
+	k_thread_create(&consumer, stack, STACK_SIZE, entry,
+			(void *)size, NULL, NULL, K_PRIO_COOP(1), 0, 0);
+
+	start = k_cycle_get_32();
+	for (u32_t i = 0; i < MSGS; i++) {
+		producer(size, i);
+	}
+	cycles = k_cycle_get_32() - start;
+
+	k_thread_abort(&consumer);
+
+	if (consumed != MSGS) {
+		printk("consumer lost messages: %u/%u\n", consumed, MSGS);
+	}
+
+	return cycles / MSGS;
+}
+
+void main(void)
+{
+	static const size_t sizes[] = { 16, 64, MAX_MSG_SIZE };
+
+	printk("zero copy benchmark: %d messages per measurement\n", MSGS);
+
+	for (int i = 0; i < ARRAY_SIZE(sizes); i++) {
+		u32_t copy, claim;
+
+		k_msgq_init(&msgq, msgq_buf, sizes[i], MSGQ_LEN);
+		copy = run(msgq_copy_consumer, msgq_copy_producer, sizes[i]);
+		claim = run(msgq_claim_consumer, msgq_claim_producer,
+			    sizes[i]);
+		printk("msgq %3u bytes: copy %5u cycles/msg, "
+		       "claim %5u cycles/msg\n",
+		       (u32_t)sizes[i], copy, claim);
+	}
+
+	for (int i = 0; i < ARRAY_SIZE(sizes); i++) {
+		u32_t copy, claim;
+
+		copy = run(pipe_copy_consumer, pipe_copy_producer, sizes[i]);
+		claim = run(pipe_claim_consumer, pipe_claim_producer,
+			    sizes[i]);
+		printk("pipe %3u bytes: copy %5u cycles/msg, "
+		       "claim %5u cycles/msg\n",
+		       (u32_t)sizes[i], copy, claim);
+	}
+}
@@ -6,9 +6,11 @@
 
 #include <zephyr.h>
 #include <device.h>
+#include <errno.h>
 
 
 #define DUMMY_DRIVER_NAME	"dummy_driver"
+#define DUMMY_DUP_NAME		"dummy_dup"
 
 typedef int (*dummy_api_configure_t)(struct device *dev,
 				     u32_t dev_config);
@@ -39,6 +41,19 @@ DEVICE_AND_API_INIT(dummy_driver, DUMMY_DRIVER_NAME, &dummy_init,
 		    NULL, NULL, POST_KERNEL, CONFIG_KERNEL_INIT_PRIORITY_DEFAULT,
 		    &funcs);
 
+static int dummy_fail_init(struct device *dev)
+{
+	return -EIO;
+}
+
+/* Two devices with the same name, the first failing to initialize */
+DEVICE_AND_API_INIT(dummy_dup_fail, DUMMY_DUP_NAME, &dummy_fail_init,
+		    NULL, NULL, POST_KERNEL, CONFIG_KERNEL_INIT_PRIORITY_DEFAULT,
+		    &funcs);
+DEVICE_AND_API_INIT(dummy_dup, DUMMY_DUP_NAME, &dummy_init,
+		    NULL, NULL, POST_KERNEL, CONFIG_KERNEL_INIT_PRIORITY_DEFAULT,
+		    &funcs);
+
 /**
  * @endcond
  */
@@ -12,6 +12,7 @@
 
 #define DUMMY_PORT_1    "dummy"
 #define DUMMY_PORT_2    "dummy_driver"
+#define DUMMY_DUP       "dummy_dup"
 
 /**
  * @brief Test cases to verify device objects
@@ -83,6 +84,23 @@ static void test_bogus_dynamic_name(void)
 	zassert_true(mux == NULL, NULL);
 }
 
+/**
+ * @brief Test device binding for devices sharing a name
+ *
+ * Validates that the device found is the one that initialized
+ * successfully, when another device with the same name failed to.
+ *
+ * @see device_get_binding(), DEVICE_AND_API_INIT()
+ */
+static void test_duplicate_name(void)
+{
+	struct device *dev;
+
+	dev = device_get_binding(DUMMY_DUP);
+	zassert_not_null(dev, NULL);
+	zassert_not_null(dev->driver_api, NULL);
+}
+
 #ifdef CONFIG_DEVICE_POWER_MANAGEMENT
 /**
  * @brief Test system device list query API with PM enabled.
@@ -162,6 +180,8 @@ void test_dummy_device_pm(void)
  * @}
  */
 
+extern void test_parallel_init(void);
+
 void test_main(void)
 {
 	ztest_test_suite(device,
@@ -169,6 +189,8 @@ void test_main(void)
 			 ztest_unit_test(build_suspend_device_list),
 			 ztest_unit_test(test_dummy_device),
 			 ztest_unit_test(test_bogus_dynamic_name),
-			 ztest_unit_test(test_dynamic_name));
+			 ztest_unit_test(test_dynamic_name),
+			 ztest_unit_test(test_duplicate_name),
+			 ztest_unit_test(test_parallel_init));
 	ztest_run_test_suite(device);
 }
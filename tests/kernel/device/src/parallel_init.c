@@ -0,0 +1,73 @@
+/*
+ * Copyright (c) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr.h>
+#include <device.h>
+#include <ztest.h>
+
+#define INIT_SLEEP_MS	50
+
+/* Order in which the test devices start and finish initializing */
+struct init_record {
+	atomic_val_t start;
+	atomic_val_t end;
+};
+
+static struct init_record rec_a, rec_b, rec_c, rec_d;
+static atomic_t init_seq;
+
+static int record_init(struct device *dev)
+{
+	struct init_record *rec =
+		(struct init_record *)dev->config->config_info;
+
+	rec->start = atomic_inc(&init_seq);
+	k_sleep(INIT_SLEEP_MS);
+	rec->end = atomic_inc(&init_seq);
+
+	return 0;
+}
+
+/* par_b comes first in priority order but depends on par_a, par_c
+ * depends on nothing, and seq_d is not marked for parallel init
+ */
+DEVICE_INIT(par_b, "par_b", record_init, NULL, &rec_b, APPLICATION, 50);
+DEVICE_INIT_PARALLEL(par_b, "par_a");
+DEVICE_INIT(par_a, "par_a", record_init, NULL, &rec_a, APPLICATION, 51);
+DEVICE_INIT_PARALLEL(par_a);
+DEVICE_INIT(par_c, "par_c", record_init, NULL, &rec_c, APPLICATION, 52);
+DEVICE_INIT_PARALLEL(par_c, "not_in_build");
+DEVICE_INIT(seq_d, "seq_d", record_init, NULL, &rec_d, APPLICATION, 53);
+
+static bool overlap(struct init_record *r1, struct init_record *r2)
+{
+	return r1->start < r2->end && r2->start < r1->end;
+}
+
+/**
+ * @brief Test parallel device initialization
+ *
+ * @ingroup kernel_device_tests
+ *
+ * @see DEVICE_INIT_PARALLEL()
+ */
+void test_parallel_init(void)
+{
+	if (!IS_ENABLED(CONFIG_DEVICE_INIT_PARALLEL)) {
+		ztest_test_skip();
+	}
+
+	/**TESTPOINT: a device starts after the devices it depends on */
+	zassert_true(rec_b.start > rec_a.end, NULL);
+
+	/**TESTPOINT: independent devices are initialized concurrently */
+	zassert_true(overlap(&rec_a, &rec_c), NULL);
+
+	/**TESTPOINT: an unmarked device waits for all devices before it */
+	zassert_true(rec_d.start > rec_a.end, NULL);
+	zassert_true(rec_d.start > rec_b.end, NULL);
+	zassert_true(rec_d.start > rec_c.end, NULL);
+}
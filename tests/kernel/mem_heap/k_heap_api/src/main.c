@@ -0,0 +1,220 @@
+/*
+ * Copyright (c) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <ztest.h>
+#include <string.h>
+
+#define HEAP_SIZE	2048
+#define BLK_SIZE	70
+#define BLK_NUM_MAX	(HEAP_SIZE / BLK_SIZE)
+#define TIMEOUT_MS	100
+#define STACK_SIZE	(512 + CONFIG_TEST_EXTRA_STACKSIZE)
+
+K_HEAP_DEFINE(heap, HEAP_SIZE);
+
+static char __aligned(sizeof(void *)) rt_heap_buf[HEAP_SIZE];
+static struct k_heap rt_heap;
+
+static K_THREAD_STACK_DEFINE(tstack, STACK_SIZE);
+static struct k_thread tdata;
+
+static void *blocks[BLK_NUM_MAX];
+
+static int fill_heap(struct k_heap *h, size_t size)
+{
+	int n;
+
+	for (n = 0; n < BLK_NUM_MAX; n++) {
+		blocks[n] = k_heap_alloc(h, size, K_NO_WAIT);
+		if (blocks[n] == NULL) {
+			break;
+		}
+		(void)memset(blocks[n], n, size);
+	}
+
+	return n;
+}
+
+static void drain_heap(struct k_heap *h, int n)
+{
+	for (int i = 0; i < n; i++) {
+		for (int j = 0; j < BLK_SIZE; j++) {
+			zassert_equal(((u8_t *)blocks[i])[j], (u8_t)i,
+				      "block %d corrupted", i);
+		}
+		k_heap_free(h, blocks[i]);
+	}
+}
+
+/**
+ * @brief Test k_heap_alloc() and k_heap_free()
+ *
+ * @details Allocate odd sized blocks until the heap is exhausted,
+ * check that the blocks do not overlap and that freeing them all
+ * gives the heap back in one piece.
+ *
+ * @see k_heap_alloc(), k_heap_free()
+ */
+void test_k_heap_alloc_free(void)
+{
+	size_t initial = sys_tlsf_free_bytes(&heap.heap);
+	int n = fill_heap(&heap, BLK_SIZE);
+
+	/** TESTPOINT: blocks are not rounded up to a power of two */
+	zassert_true(n * BLK_SIZE > initial * 3 / 4,
+		     "only %d blocks allocated", n);
+	zassert_is_null(k_heap_alloc(&heap, BLK_SIZE, K_NO_WAIT), NULL);
+
+	drain_heap(&heap, n);
+
+	/** TESTPOINT: free blocks are merged with their neighbours */
+	zassert_equal(sys_tlsf_free_bytes(&heap.heap), initial, NULL);
+	zassert_equal(sys_tlsf_largest_free(&heap.heap), initial, NULL);
+
+	/** TESTPOINT: If mem is NULL, no operation is performed */
+	k_heap_free(&heap, NULL);
+	zassert_is_null(k_heap_alloc(&heap, 0, K_NO_WAIT), NULL);
+}
+
+/**
+ * @brief Test that k_heap_aligned_alloc() honours the alignment
+ *
+ * @see k_heap_aligned_alloc()
+ */
+void test_k_heap_aligned_alloc(void)
+{
+	size_t initial = sys_tlsf_free_bytes(&heap.heap);
+	void *p[7];
+
+	for (int i = 0; i < ARRAY_SIZE(p); i++) {
+		u32_t align = 4 << i;
+
+		p[i] = k_heap_aligned_alloc(&heap, align, 13 * i + 1,
+					    K_NO_WAIT);
+		zassert_not_null(p[i], "align %u failed", align);
+		zassert_equal((uintptr_t)p[i] & (align - 1), 0,
+			      "%p not aligned to %u", p[i], align);
+	}
+
+	for (int i = 0; i < ARRAY_SIZE(p); i++) {
+		k_heap_free(&heap, p[i]);
+	}
+
+	zassert_equal(sys_tlsf_free_bytes(&heap.heap), initial, NULL);
+}
+
+/**
+ * @brief Test that memory freed between allocations is reused
+ *
+ * @details Free two neighbouring blocks in the middle of a full heap
+ * and check that a single allocation spanning both succeeds.
+ *
+ * @see k_heap_alloc(), k_heap_free()
+ */
+void test_k_heap_coalesce(void)
+{
+	int n = fill_heap(&heap, BLK_SIZE);
+	void *p;
+
+	zassert_true(n > 4, NULL);
+	zassert_is_null(k_heap_alloc(&heap, 2 * BLK_SIZE, K_NO_WAIT), NULL);
+
+	k_heap_free(&heap, blocks[1]);
+	k_heap_free(&heap, blocks[2]);
+	p = k_heap_alloc(&heap, 2 * BLK_SIZE, K_NO_WAIT);
+	zassert_not_null(p, NULL);
+	zassert_true(p == blocks[1] || p == blocks[2], NULL);
+
+	k_heap_free(&heap, p);
+	for (int i = 0; i < n; i++) {
+		if (i != 1 && i != 2) {
+			k_heap_free(&heap, blocks[i]);
+		}
+	}
+}
+
+/**
+ * @brief Test k_heap_alloc() timeouts on an exhausted heap
+ *
+ * @see k_heap_alloc()
+ */
+void test_k_heap_alloc_timeout(void)
+{
+	int n = fill_heap(&heap, BLK_SIZE);
+	s64_t start;
+
+	/** TESTPOINT: return NULL without waiting */
+	zassert_is_null(k_heap_alloc(&heap, BLK_SIZE, K_NO_WAIT), NULL);
+
+	/** TESTPOINT: return NULL after the timeout expires */
+	start = k_uptime_get();
+	zassert_is_null(k_heap_alloc(&heap, BLK_SIZE, TIMEOUT_MS), NULL);
+	zassert_true(k_uptime_get() - start >= TIMEOUT_MS, NULL);
+
+	drain_heap(&heap, n);
+}
+
+static void tfree_entry(void *p1, void *p2, void *p3)
+{
+	k_sleep(TIMEOUT_MS / 2);
+	k_heap_free(&heap, blocks[0]);
+}
+
+/**
+ * @brief Test that a blocked k_heap_alloc() is woken by k_heap_free()
+ *
+ * @see k_heap_alloc(), k_heap_free()
+ */
+void test_k_heap_alloc_wait(void)
+{
+	int n = fill_heap(&heap, BLK_SIZE);
+	void *p;
+
+	k_thread_create(&tdata, tstack, STACK_SIZE, tfree_entry,
+			NULL, NULL, NULL, K_PRIO_PREEMPT(1), 0, 0);
+
+	/** TESTPOINT: the freed block satisfies the waiting thread */
+	p = k_heap_alloc(&heap, BLK_SIZE, K_FOREVER);
+	zassert_equal(p, blocks[0], NULL);
+	(void)memset(p, 0, BLK_SIZE);
+
+	k_thread_abort(&tdata);
+	drain_heap(&heap, n);
+}
+
+/**
+ * @brief Test a heap initialized at runtime with k_heap_init()
+ *
+ * @see k_heap_init()
+ */
+void test_k_heap_init(void)
+{
+	int n;
+
+	k_heap_init(&rt_heap, rt_heap_buf, sizeof(rt_heap_buf));
+
+	n = fill_heap(&rt_heap, BLK_SIZE);
+	zassert_true(n > 0, NULL);
+	for (int i = 0; i < n; i++) {
+		zassert_true((u8_t *)blocks[i] >= (u8_t *)rt_heap_buf &&
+			     (u8_t *)blocks[i] + BLK_SIZE <=
+			     (u8_t *)rt_heap_buf + sizeof(rt_heap_buf),
+			     "block %d outside of the heap", i);
+	}
+	drain_heap(&rt_heap, n);
+}
+
+void test_main(void)
+{
+	ztest_test_suite(k_heap_api,
+			 ztest_unit_test(test_k_heap_alloc_free),
+			 ztest_unit_test(test_k_heap_aligned_alloc),
+			 ztest_unit_test(test_k_heap_coalesce),
+			 ztest_unit_test(test_k_heap_alloc_timeout),
+			 ztest_unit_test(test_k_heap_alloc_wait),
+			 ztest_unit_test(test_k_heap_init));
+	ztest_run_test_suite(k_heap_api);
+}
@@ -18,6 +18,10 @@ extern struct k_sem sem1;
 static struct k_sem semarray[SEM_ARRAY_SIZE];
 static struct k_sem *dyn_sem[SEM_ARRAY_SIZE];
 
+#define DYN_OBJ_COUNT	100
+
+static struct k_sem *many_sem[DYN_OBJ_COUNT];
+
 K_SEM_DEFINE(sem1, 0, 1);
 static struct k_sem sem2;
 static char bad_sem[sizeof(struct k_sem)];
@@ -107,10 +111,59 @@ void test_generic_object(void)
 	}
 }
 
+/**
+ * @brief Test lookups in a large dynamic object table
+ *
+ * @details Allocate enough objects for the table to be resized several
+ * times, then free some of them and check that exactly the remaining ones
+ * are still found.
+ *
+ * @ingroup kernel_memprotect_tests
+ *
+ * @see k_object_alloc(), k_object_free()
+ */
+void test_dyn_object_table(void)
+{
+	struct _k_object *ko;
+
+	for (int i = 0; i < DYN_OBJ_COUNT; i++) {
+		many_sem[i] = k_object_alloc(K_OBJ_SEM);
+		zassert_not_null(many_sem[i], "couldn't allocate semaphore");
+	}
+
+	for (int i = 0; i < DYN_OBJ_COUNT; i++) {
+		ko = _k_object_find(many_sem[i]);
+		zassert_not_null(ko, NULL);
+		zassert_equal(ko->name, (char *)many_sem[i], NULL);
+		zassert_equal(ko->type, K_OBJ_SEM, NULL);
+	}
+
+	/* Leave holes in the table, searches must probe past them */
+	for (int i = 0; i < DYN_OBJ_COUNT; i += 2) {
+		k_object_free(many_sem[i]);
+	}
+
+	for (int i = 0; i < DYN_OBJ_COUNT; i++) {
+		ko = _k_object_find(many_sem[i]);
+		if (i % 2 == 0) {
+			zassert_is_null(ko, NULL);
+		} else {
+			zassert_not_null(ko, NULL);
+			zassert_equal(ko->name, (char *)many_sem[i], NULL);
+		}
+	}
+
+	for (int i = 1; i < DYN_OBJ_COUNT; i += 2) {
+		k_object_free(many_sem[i]);
+		zassert_false(test_object(many_sem[i], -EBADF), NULL);
+	}
+}
+
 void test_main(void)
 {
 	k_thread_system_pool_assign(k_current_get());
 	ztest_test_suite(object_validation,
-			 ztest_unit_test(test_generic_object));
+			 ztest_unit_test(test_generic_object),
+			 ztest_unit_test(test_dyn_object_table));
 	ztest_run_test_suite(object_validation);
 }
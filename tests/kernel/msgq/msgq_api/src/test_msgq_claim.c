@@ -0,0 +1,133 @@
+/*
+ * Copyright (c) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "test_msgq.h"
+
+K_THREAD_STACK_EXTERN(tstack);
+extern struct k_thread tdata;
+extern struct k_msgq msgq;
+static char __aligned(4) tbuffer[MSG_SIZE * MSGQ_LEN];
+static u32_t data[MSGQ_LEN] = { MSG0, MSG1 };
+
+static void put_claimed(struct k_msgq *q, u32_t value)
+{
+	void *slot;
+
+	zassert_equal(k_msgq_put_claim(q, &slot, K_NO_WAIT), 0, NULL);
+	*(u32_t *)slot = value;
+	zassert_equal(k_msgq_put_finish(q), 0, NULL);
+}
+
+static void get_entry(void *p1, void *p2, void *p3)
+{
+	u32_t rx_data;
+
+	zassert_equal(k_msgq_get(p1, &rx_data, K_FOREVER), 0, NULL);
+	zassert_equal(rx_data, MSG0, NULL);
+}
+
+static void get_claim_entry(void *p1, void *p2, void *p3)
+{
+	void *msg;
+
+	k_sleep(TIMEOUT >> 1);
+	zassert_equal(k_msgq_get_claim(p1, &msg, K_NO_WAIT), 0, NULL);
+	zassert_equal(*(u32_t *)msg, data[0], NULL);
+	zassert_equal(k_msgq_get_finish(p1), 0, NULL);
+}
+
+/**
+ * @addtogroup kernel_message_queue_tests
+ * @{
+ */
+
+/**
+ * @brief Test building and consuming messages in place
+ * @see k_msgq_put_claim(), k_msgq_put_finish(), k_msgq_get_claim(),
+ * k_msgq_get_finish()
+ */
+void test_msgq_claim(void)
+{
+	u32_t rx_data;
+	void *slot, *msg;
+
+	k_msgq_init(&msgq, tbuffer, MSG_SIZE, MSGQ_LEN);
+
+	/**TESTPOINT: the claimed slot is inside the queue's buffer */
+	zassert_equal(k_msgq_put_claim(&msgq, &slot, K_NO_WAIT), 0, NULL);
+	zassert_equal(slot, tbuffer, NULL);
+	*(u32_t *)slot = MSG0;
+
+	/**TESTPOINT: one claim per side, no copying writer meanwhile */
+	zassert_equal(k_msgq_put_claim(&msgq, &slot, K_NO_WAIT), -EBUSY, NULL);
+	zassert_equal(k_msgq_put(&msgq, &data[1], K_NO_WAIT), -EBUSY, NULL);
+	zassert_equal(k_msgq_num_used_get(&msgq), 0, NULL);
+
+	zassert_equal(k_msgq_put_finish(&msgq), 0, NULL);
+	zassert_equal(k_msgq_put_finish(&msgq), -EINVAL, NULL);
+	zassert_equal(k_msgq_put(&msgq, &data[1], K_NO_WAIT), 0, NULL);
+
+	/**TESTPOINT: the queue is full */
+	zassert_equal(k_msgq_put_claim(&msgq, &slot, K_NO_WAIT), -ENOMSG,
+		      NULL);
+	zassert_equal(k_msgq_put_claim(&msgq, &slot, TIMEOUT), -EAGAIN, NULL);
+
+	/**TESTPOINT: messages are claimed in order */
+	zassert_equal(k_msgq_get_claim(&msgq, &msg, K_NO_WAIT), 0, NULL);
+	zassert_equal(*(u32_t *)msg, MSG0, NULL);
+	zassert_equal(k_msgq_get(&msgq, &rx_data, K_NO_WAIT), -EBUSY, NULL);
+	zassert_equal(k_msgq_get_finish(&msgq), 0, NULL);
+	zassert_equal(k_msgq_get_finish(&msgq), -EINVAL, NULL);
+
+	zassert_equal(k_msgq_get(&msgq, &rx_data, K_NO_WAIT), 0, NULL);
+	zassert_equal(rx_data, MSG1, NULL);
+	zassert_equal(k_msgq_get_claim(&msgq, &msg, K_NO_WAIT), -ENOMSG,
+		      NULL);
+
+	/**TESTPOINT: claims follow the ring buffer around */
+	for (int i = 0; i < 2 * MSGQ_LEN; i++) {
+		put_claimed(&msgq, i);
+		zassert_equal(k_msgq_get(&msgq, &rx_data, K_NO_WAIT), 0, NULL);
+		zassert_equal(rx_data, i, NULL);
+	}
+}
+
+/**
+ * @brief Test that claims wake up and wait for other threads
+ * @see k_msgq_put_claim(), k_msgq_put_finish(), k_msgq_get_claim(),
+ * k_msgq_get_finish()
+ */
+void test_msgq_claim_wait(void)
+{
+	void *slot;
+
+	k_msgq_init(&msgq, tbuffer, MSG_SIZE, MSGQ_LEN);
+
+	/**TESTPOINT: finishing a claim hands the message to a reader */
+	k_thread_create(&tdata, tstack, STACK_SIZE, get_entry, &msgq,
+			NULL, NULL, K_PRIO_PREEMPT(0), 0, 0);
+	k_sleep(TIMEOUT >> 1);
+	put_claimed(&msgq, MSG0);
+	zassert_equal(k_msgq_num_used_get(&msgq), 0, NULL);
+	k_thread_abort(&tdata);
+
+	/**TESTPOINT: a claim waits for a reader to free a slot */
+	for (int i = 0; i < MSGQ_LEN; i++) {
+		zassert_equal(k_msgq_put(&msgq, &data[i], K_NO_WAIT), 0, NULL);
+	}
+	k_thread_create(&tdata, tstack, STACK_SIZE, get_claim_entry, &msgq,
+			NULL, NULL, K_PRIO_PREEMPT(0), 0, 0);
+	zassert_equal(k_msgq_put_claim(&msgq, &slot, K_FOREVER), 0, NULL);
+	zassert_equal(k_msgq_put_finish(&msgq), 0, NULL);
+	zassert_equal(k_msgq_num_used_get(&msgq), MSGQ_LEN, NULL);
+	k_thread_abort(&tdata);
+
+	k_msgq_purge(&msgq);
+}
+
+/**
+ * @}
+ */
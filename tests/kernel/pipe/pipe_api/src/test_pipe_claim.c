@@ -0,0 +1,164 @@
+/*
+ * Copyright (c) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <ztest.h>
+
+#define STACK_SIZE	1024
+#define PIPE_LEN	16
+#define TIMEOUT		100
+
+K_PIPE_DEFINE(claim_pipe, PIPE_LEN, 4);
+static K_THREAD_STACK_DEFINE(claim_stack, STACK_SIZE);
+static struct k_thread claim_thread;
+
+static const unsigned char data[] = "abcd1234$%^&PIPE";
+
+static void put_claimed(struct k_pipe *ppipe, const unsigned char *src,
+			size_t len)
+{
+	unsigned char *buf;
+	size_t size;
+
+	while (len > 0) {
+		size = len;
+		zassert_equal(k_pipe_put_claim(ppipe, &buf, &size, K_NO_WAIT),
+			      0, NULL);
+		zassert_true(size > 0 && size <= len, NULL);
+		memcpy(buf, src, size);
+		zassert_equal(k_pipe_put_finish(ppipe, size), 0, NULL);
+		src += size;
+		len -= size;
+	}
+}
+
+static void get_entry(void *p1, void *p2, void *p3)
+{
+	unsigned char rx_data[PIPE_LEN / 2];
+	size_t rd_byte;
+
+	zassert_equal(k_pipe_get(p1, rx_data, sizeof(rx_data), &rd_byte,
+				 sizeof(rx_data), K_FOREVER), 0, NULL);
+	zassert_equal(rd_byte, sizeof(rx_data), NULL);
+	zassert_false(memcmp(rx_data, data, sizeof(rx_data)), NULL);
+}
+
+static void get_claim_entry(void *p1, void *p2, void *p3)
+{
+	unsigned char *buf;
+	size_t size = PIPE_LEN;
+
+	k_sleep(TIMEOUT / 2);
+	zassert_equal(k_pipe_get_claim(p1, &buf, &size, K_NO_WAIT), 0, NULL);
+	zassert_equal(*buf, data[0], NULL);
+	zassert_equal(k_pipe_get_finish(p1, size), 0, NULL);
+}
+
+/**
+ * @addtogroup kernel_pipe_tests
+ * @{
+ */
+
+/**
+ * @brief Test producing and consuming pipe data in place
+ * @see k_pipe_put_claim(), k_pipe_put_finish(), k_pipe_get_claim(),
+ * k_pipe_get_finish()
+ */
+void test_pipe_claim(void)
+{
+	unsigned char rx_data[PIPE_LEN];
+	unsigned char *buf;
+	size_t size, wt_byte, rd_byte;
+
+	/**TESTPOINT: the claim is limited to the free space */
+	size = 2 * PIPE_LEN;
+	zassert_equal(k_pipe_put_claim(&claim_pipe, &buf, &size, K_NO_WAIT),
+		      0, NULL);
+	zassert_equal(size, PIPE_LEN, NULL);
+
+	/**TESTPOINT: one claim per side, no copying writer meanwhile */
+	zassert_equal(k_pipe_put_claim(&claim_pipe, &buf, &size, K_NO_WAIT),
+		      -EBUSY, NULL);
+	zassert_equal(k_pipe_put(&claim_pipe, (void *)data, 4, &wt_byte, 1,
+				 K_NO_WAIT), -EBUSY, NULL);
+
+	/**TESTPOINT: only the finished part is written */
+	memcpy(buf, data, 6);
+	zassert_equal(k_pipe_put_finish(&claim_pipe, PIPE_LEN + 1), -EINVAL,
+		      NULL);
+	zassert_equal(k_pipe_put_finish(&claim_pipe, 6), 0, NULL);
+	zassert_equal(k_pipe_put_finish(&claim_pipe, 0), -EINVAL, NULL);
+
+	size = PIPE_LEN;
+	zassert_equal(k_pipe_get_claim(&claim_pipe, &buf, &size, K_NO_WAIT),
+		      0, NULL);
+	zassert_equal(size, 6, NULL);
+	zassert_false(memcmp(buf, data, 6), NULL);
+	zassert_equal(k_pipe_get(&claim_pipe, rx_data, 1, &rd_byte, 1,
+				 K_NO_WAIT), -EBUSY, NULL);
+	zassert_equal(k_pipe_get_finish(&claim_pipe, 2), 0, NULL);
+
+	zassert_equal(k_pipe_get(&claim_pipe, rx_data, 4, &rd_byte, 4,
+				 K_NO_WAIT), 0, NULL);
+	zassert_false(memcmp(rx_data, &data[2], 4), NULL);
+
+	/**TESTPOINT: the pipe is empty */
+	size = PIPE_LEN;
+	zassert_equal(k_pipe_get_claim(&claim_pipe, &buf, &size, K_NO_WAIT),
+		      -EIO, NULL);
+	zassert_equal(k_pipe_get_claim(&claim_pipe, &buf, &size, TIMEOUT),
+		      -EAGAIN, NULL);
+
+	/**TESTPOINT: claims stop at the end of the ring buffer */
+	put_claimed(&claim_pipe, data, PIPE_LEN);
+	size = PIPE_LEN;
+	zassert_equal(k_pipe_get_claim(&claim_pipe, &buf, &size, K_NO_WAIT),
+		      0, NULL);
+	zassert_equal(size, PIPE_LEN - 6, NULL);
+	zassert_false(memcmp(buf, data, size), NULL);
+	zassert_equal(k_pipe_get_finish(&claim_pipe, size), 0, NULL);
+
+	zassert_equal(k_pipe_get(&claim_pipe, rx_data, 6, &rd_byte, 6,
+				 K_NO_WAIT), 0, NULL);
+	zassert_false(memcmp(rx_data, &data[PIPE_LEN - 6], 6), NULL);
+}
+
+/**
+ * @brief Test that claims wake up and wait for other threads
+ * @see k_pipe_put_claim(), k_pipe_put_finish(), k_pipe_get_claim(),
+ * k_pipe_get_finish()
+ */
+void test_pipe_claim_wait(void)
+{
+	unsigned char *buf;
+	size_t size, wt_byte;
+
+	/**TESTPOINT: finishing a claim serves a waiting reader */
+	k_thread_create(&claim_thread, claim_stack, STACK_SIZE, get_entry,
+			&claim_pipe, NULL, NULL, K_PRIO_PREEMPT(0), 0, 0);
+	k_sleep(TIMEOUT / 2);
+	put_claimed(&claim_pipe, data, PIPE_LEN / 2);
+	size = PIPE_LEN;
+	zassert_equal(k_pipe_get_claim(&claim_pipe, &buf, &size, K_NO_WAIT),
+		      -EIO, NULL);
+	k_thread_abort(&claim_thread);
+
+	/**TESTPOINT: a claim waits for a reader to free space */
+	zassert_equal(k_pipe_put(&claim_pipe, (void *)data, PIPE_LEN,
+				 &wt_byte, PIPE_LEN, K_NO_WAIT), 0, NULL);
+	k_thread_create(&claim_thread, claim_stack, STACK_SIZE,
+			get_claim_entry, &claim_pipe, NULL, NULL,
+			K_PRIO_PREEMPT(0), 0, 0);
+	size = PIPE_LEN;
+	zassert_equal(k_pipe_put_claim(&claim_pipe, &buf, &size, K_FOREVER),
+		      0, NULL);
+	zassert_true(size > 0, NULL);
+	zassert_equal(k_pipe_put_finish(&claim_pipe, 0), 0, NULL);
+	k_thread_abort(&claim_thread);
+}
+
+/**
+ * @}
+ */
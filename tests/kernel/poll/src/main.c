@@ -12,6 +12,12 @@ extern void test_poll_cancel_main_high_prio(void);
 extern void test_poll_multi(void);
 extern void test_poll_threadstate(void);
 extern void test_poll_grant_access(void);
+extern void test_pollset_no_wait(void);
+extern void test_pollset_wait(void);
+extern void test_pollset_add_del(void);
+extern void test_pollset_many(void);
+extern void test_pollset_two_waiters(void);
+extern void test_pollset_grant_access(void);
 
 K_MEM_POOL_DEFINE(test_pool, 128, 128, 4, 4);
 
@@ -19,6 +25,7 @@ K_MEM_POOL_DEFINE(test_pool, 128, 128, 4, 4);
 void test_main(void)
 {
 	test_poll_grant_access();
+	test_pollset_grant_access();
 
 	k_thread_resource_pool_assign(k_current_get(), &test_pool);
 
@@ -28,6 +35,11 @@ void test_main(void)
 			 ztest_unit_test(test_poll_cancel_main_low_prio),
 			 ztest_unit_test(test_poll_cancel_main_high_prio),
 			 ztest_unit_test(test_poll_multi),
-			 ztest_unit_test(test_poll_threadstate));
+			 ztest_unit_test(test_poll_threadstate),
+			 ztest_user_unit_test(test_pollset_no_wait),
+			 ztest_unit_test(test_pollset_wait),
+			 ztest_unit_test(test_pollset_add_del),
+			 ztest_unit_test(test_pollset_many),
+			 ztest_unit_test(test_pollset_two_waiters));
 	ztest_run_test_suite(poll_api);
 }
@@ -0,0 +1,357 @@
+/*
+ * Copyright (c) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <ztest.h>
+#include <kernel.h>
+
+#define NUM_MANY	32
+#define TIMEOUT_MS	100
+#define STACK_SIZE	(1024 + CONFIG_TEST_EXTRA_STACKSIZE)
+
+enum {
+	TAG_SEM = 1,
+	TAG_FIFO,
+	TAG_SIGNAL,
+	TAG_IDLE,
+};
+
+struct fifo_msg {
+	void *private;
+	u32_t msg;
+};
+
+K_POLLSET_DEFINE(set, 4);
+K_SEM_DEFINE(set_sem, 0, 1);
+K_SEM_DEFINE(set_idle_sem, 0, 1);
+K_FIFO_DEFINE(set_fifo);
+static struct k_poll_signal set_signal;
+
+static struct k_pollset many_set;
+static struct k_poll_event many_events[NUM_MANY];
+static struct k_sem many_sems[NUM_MANY];
+
+static K_THREAD_STACK_DEFINE(helper_stack, STACK_SIZE);
+static struct k_thread helper_thread;
+static K_THREAD_STACK_DEFINE(helper2_stack, STACK_SIZE);
+static struct k_thread helper2_thread;
+
+static void set_add_all(void)
+{
+	zassert_equal(k_pollset_add(&set, K_POLL_TYPE_SEM_AVAILABLE,
+				    &set_sem, TAG_SEM), 0, NULL);
+	zassert_equal(k_pollset_add(&set, K_POLL_TYPE_FIFO_DATA_AVAILABLE,
+				    &set_fifo, TAG_FIFO), 0, NULL);
+	zassert_equal(k_pollset_add(&set, K_POLL_TYPE_SIGNAL,
+				    &set_signal, TAG_SIGNAL), 0, NULL);
+	zassert_equal(k_pollset_add(&set, K_POLL_TYPE_SEM_AVAILABLE,
+				    &set_idle_sem, TAG_IDLE), 0, NULL);
+}
+
+static void set_del_all(void)
+{
+	zassert_equal(k_pollset_del(&set, &set_sem), 0, NULL);
+	zassert_equal(k_pollset_del(&set, &set_fifo), 0, NULL);
+	zassert_equal(k_pollset_del(&set, &set_signal), 0, NULL);
+	zassert_equal(k_pollset_del(&set, &set_idle_sem), 0, NULL);
+}
+
+/**
+ * @brief Test k_pollset_wait() on members which are already ready
+ *
+ * @ingroup kernel_poll_tests
+ *
+ * @see k_pollset_add(), k_pollset_wait(), k_pollset_del()
+ */
+void test_pollset_no_wait(void)
+{
+	struct fifo_msg msg = { NULL, 0xdeadbeef };
+	struct k_poll_event ready[4];
+	u32_t seen = 0;
+	int n;
+
+	k_poll_signal_init(&set_signal);
+	set_add_all();
+
+	/** TESTPOINT: nothing ready yet */
+	zassert_equal(k_pollset_wait(&set, ready, ARRAY_SIZE(ready),
+				     K_NO_WAIT), -EAGAIN, NULL);
+
+	k_sem_give(&set_sem);
+	zassert_false(k_fifo_alloc_put(&set_fifo, &msg), NULL);
+	k_poll_signal_raise(&set_signal, 0x1337);
+
+	/** TESTPOINT: exactly the three signaled members are returned */
+	n = k_pollset_wait(&set, ready, ARRAY_SIZE(ready), K_NO_WAIT);
+	zassert_equal(n, 3, "%d events returned", n);
+	for (int i = 0; i < n; i++) {
+		switch (ready[i].tag) {
+		case TAG_SEM:
+			zassert_equal(ready[i].state,
+				      K_POLL_STATE_SEM_AVAILABLE, NULL);
+			zassert_equal(ready[i].sem, &set_sem, NULL);
+			break;
+		case TAG_FIFO:
+			zassert_equal(ready[i].state,
+				      K_POLL_STATE_FIFO_DATA_AVAILABLE, NULL);
+			zassert_equal(ready[i].fifo, &set_fifo, NULL);
+			break;
+		case TAG_SIGNAL:
+			zassert_equal(ready[i].state,
+				      K_POLL_STATE_SIGNALED, NULL);
+			zassert_equal(ready[i].signal, &set_signal, NULL);
+			break;
+		default:
+			zassert_unreachable("unexpected tag %u", ready[i].tag);
+		}
+		seen |= BIT(ready[i].tag);
+	}
+	zassert_equal(seen, BIT(TAG_SEM) | BIT(TAG_FIFO) | BIT(TAG_SIGNAL),
+		      NULL);
+
+	/** TESTPOINT: unconsumed members are reported again */
+	zassert_equal(k_sem_take(&set_sem, K_NO_WAIT), 0, NULL);
+	zassert_equal(k_fifo_get(&set_fifo, K_NO_WAIT), &msg, NULL);
+	n = k_pollset_wait(&set, ready, ARRAY_SIZE(ready), K_NO_WAIT);
+	zassert_equal(n, 1, "%d events returned", n);
+	zassert_equal(ready[0].tag, TAG_SIGNAL, NULL);
+
+	/** TESTPOINT: consumed members are not */
+	k_poll_signal_reset(&set_signal);
+	zassert_equal(k_pollset_wait(&set, ready, ARRAY_SIZE(ready),
+				     K_NO_WAIT), -EAGAIN, NULL);
+
+	set_del_all();
+}
+
+static void give_sem_entry(void *p1, void *p2, void *p3)
+{
+	k_sleep(TIMEOUT_MS / 2);
+	k_sem_give(p1);
+}
+
+/**
+ * @brief Test that a thread blocked in k_pollset_wait() is woken up
+ *
+ * @ingroup kernel_poll_tests
+ *
+ * @see k_pollset_wait()
+ */
+void test_pollset_wait(void)
+{
+	struct k_poll_event ready[2];
+	s64_t start;
+
+	set_add_all();
+
+	/** TESTPOINT: time out when no member becomes ready */
+	start = k_uptime_get();
+	zassert_equal(k_pollset_wait(&set, ready, ARRAY_SIZE(ready),
+				     TIMEOUT_MS), -EAGAIN, NULL);
+	zassert_true(k_uptime_get() - start >= TIMEOUT_MS, NULL);
+
+	/** TESTPOINT: a member becoming ready wakes the waiter */
+	k_thread_create(&helper_thread, helper_stack, STACK_SIZE,
+			give_sem_entry, &set_idle_sem, NULL, NULL,
+			K_PRIO_PREEMPT(0), 0, 0);
+	zassert_equal(k_pollset_wait(&set, ready, ARRAY_SIZE(ready),
+				     K_FOREVER), 1, NULL);
+	zassert_equal(ready[0].tag, TAG_IDLE, NULL);
+	zassert_equal(ready[0].state, K_POLL_STATE_SEM_AVAILABLE, NULL);
+	zassert_equal(k_sem_take(&set_idle_sem, K_NO_WAIT), 0, NULL);
+	k_thread_abort(&helper_thread);
+
+	/** TESTPOINT: the member is still registered after reporting */
+	k_thread_create(&helper_thread, helper_stack, STACK_SIZE,
+			give_sem_entry, &set_idle_sem, NULL, NULL,
+			K_PRIO_PREEMPT(0), 0, 0);
+	zassert_equal(k_pollset_wait(&set, ready, ARRAY_SIZE(ready),
+				     K_FOREVER), 1, NULL);
+	zassert_equal(ready[0].tag, TAG_IDLE, NULL);
+	zassert_equal(k_sem_take(&set_idle_sem, K_NO_WAIT), 0, NULL);
+	k_thread_abort(&helper_thread);
+
+	set_del_all();
+}
+
+/**
+ * @brief Test poll set membership management
+ *
+ * @ingroup kernel_poll_tests
+ *
+ * @see k_pollset_add(), k_pollset_del()
+ */
+void test_pollset_add_del(void)
+{
+	struct k_poll_event ready[4];
+	struct k_sem extra_sem;
+
+	k_sem_init(&extra_sem, 0, 1);
+
+	/** TESTPOINT: invalid type */
+	zassert_equal(k_pollset_add(&set, K_POLL_TYPE_IGNORE, &set_sem, 0),
+		      -EINVAL, NULL);
+
+	set_add_all();
+
+	/** TESTPOINT: an object is only added once */
+	zassert_equal(k_pollset_add(&set, K_POLL_TYPE_SEM_AVAILABLE,
+				    &set_sem, 0), -EEXIST, NULL);
+
+	/** TESTPOINT: the set is full */
+	zassert_equal(k_pollset_add(&set, K_POLL_TYPE_SEM_AVAILABLE,
+				    &extra_sem, 0), -ENOMEM, NULL);
+
+	/** TESTPOINT: a removed member is not reported, nor re-armed */
+	k_sem_give(&set_sem);
+	zassert_equal(k_pollset_del(&set, &set_sem), 0, NULL);
+	zassert_equal(k_pollset_del(&set, &set_sem), -ENOENT, NULL);
+	zassert_equal(k_pollset_wait(&set, ready, ARRAY_SIZE(ready),
+				     K_NO_WAIT), -EAGAIN, NULL);
+
+	/** TESTPOINT: its slot can be reused */
+	zassert_equal(k_pollset_add(&set, K_POLL_TYPE_SEM_AVAILABLE,
+				    &extra_sem, TAG_SEM), 0, NULL);
+	k_sem_give(&extra_sem);
+	zassert_equal(k_pollset_wait(&set, ready, ARRAY_SIZE(ready),
+				     K_NO_WAIT), 1, NULL);
+	zassert_equal(ready[0].sem, &extra_sem, NULL);
+
+	/** TESTPOINT: an object already available is reported on add */
+	zassert_equal(k_pollset_del(&set, &extra_sem), 0, NULL);
+	zassert_equal(k_pollset_add(&set, K_POLL_TYPE_SEM_AVAILABLE,
+				    &set_sem, TAG_SEM), 0, NULL);
+	zassert_equal(k_pollset_wait(&set, ready, ARRAY_SIZE(ready),
+				     K_NO_WAIT), 1, NULL);
+	zassert_equal(ready[0].sem, &set_sem, NULL);
+	zassert_equal(k_sem_take(&set_sem, K_NO_WAIT), 0, NULL);
+
+	set_del_all();
+}
+
+/**
+ * @brief Test a large poll set with fewer output slots than ready events
+ *
+ * @ingroup kernel_poll_tests
+ *
+ * @see k_pollset_init(), k_pollset_wait()
+ */
+void test_pollset_many(void)
+{
+	static const int given[] = { 3, 17, 30 };
+	struct k_poll_event ready[2];
+	u32_t seen = 0;
+	int n;
+
+	k_pollset_init(&many_set, many_events, ARRAY_SIZE(many_events));
+	for (int i = 0; i < NUM_MANY; i++) {
+		k_sem_init(&many_sems[i], 0, 1);
+		zassert_equal(k_pollset_add(&many_set,
+					    K_POLL_TYPE_SEM_AVAILABLE,
+					    &many_sems[i], i), 0, NULL);
+	}
+
+	for (int i = 0; i < ARRAY_SIZE(given); i++) {
+		k_sem_give(&many_sems[given[i]]);
+	}
+
+	/** TESTPOINT: events which do not fit are returned next time */
+	n = k_pollset_wait(&many_set, ready, ARRAY_SIZE(ready), K_NO_WAIT);
+	zassert_equal(n, 2, NULL);
+	for (int i = 0; i < n; i++) {
+		seen |= BIT(ready[i].tag);
+		zassert_equal(k_sem_take(ready[i].sem, K_NO_WAIT), 0, NULL);
+	}
+
+	n = k_pollset_wait(&many_set, ready, ARRAY_SIZE(ready), K_NO_WAIT);
+	zassert_equal(n, 1, NULL);
+	seen |= BIT(ready[0].tag);
+	zassert_equal(k_sem_take(ready[0].sem, K_NO_WAIT), 0, NULL);
+
+	zassert_equal(seen, BIT(3) | BIT(17) | BIT(30), NULL);
+	zassert_equal(k_pollset_wait(&many_set, ready, ARRAY_SIZE(ready),
+				     K_NO_WAIT), -EAGAIN, NULL);
+}
+
+static void wait_no_wait_entry(void *p1, void *p2, void *p3)
+{
+	struct k_poll_event ready[4];
+
+	*(int *)p1 = k_pollset_wait(&set, ready, ARRAY_SIZE(ready),
+				    K_NO_WAIT);
+}
+
+static void wait_forever_entry(void *p1, void *p2, void *p3)
+{
+	struct k_poll_event ready[4];
+
+	atomic_add(p1, k_pollset_wait(&set, ready, ARRAY_SIZE(ready),
+				      K_FOREVER));
+}
+
+/**
+ * @brief Test that a ready event is returned to only one of two waiters
+ *
+ * @ingroup kernel_poll_tests
+ *
+ * @see k_pollset_wait()
+ */
+void test_pollset_two_waiters(void)
+{
+	struct k_poll_event ready[4];
+	atomic_t reported = ATOMIC_INIT(0);
+	int res = 0;
+
+	set_add_all();
+	k_sem_give(&set_sem);
+
+	/** TESTPOINT: an event returned to one waiter and not consumed is
+	 * returned again by the next wait, even of another thread
+	 */
+	zassert_equal(k_pollset_wait(&set, ready, ARRAY_SIZE(ready),
+				     K_NO_WAIT), 1, NULL);
+	zassert_equal(ready[0].tag, TAG_SEM, NULL);
+	k_thread_create(&helper_thread, helper_stack, STACK_SIZE,
+			wait_no_wait_entry, &res, NULL, NULL,
+			K_PRIO_PREEMPT(0), 0, 0);
+	k_sleep(TIMEOUT_MS / 10);
+	zassert_equal(res, 1, NULL);
+
+	/** TESTPOINT: once consumed, it is not returned any more */
+	zassert_equal(k_sem_take(&set_sem, K_NO_WAIT), 0, NULL);
+	zassert_equal(k_pollset_wait(&set, ready, ARRAY_SIZE(ready),
+				     K_NO_WAIT), -EAGAIN, NULL);
+
+	/** TESTPOINT: an event wakes up only one of two blocked waiters */
+	k_thread_create(&helper_thread, helper_stack, STACK_SIZE,
+			wait_forever_entry, &reported, NULL, NULL,
+			K_PRIO_PREEMPT(0), 0, 0);
+	k_thread_create(&helper2_thread, helper2_stack, STACK_SIZE,
+			wait_forever_entry, &reported, NULL, NULL,
+			K_PRIO_PREEMPT(0), 0, 0);
+	k_sleep(TIMEOUT_MS / 10);
+	k_sem_give(&set_sem);
+	k_sleep(TIMEOUT_MS / 10);
+	zassert_equal(atomic_get(&reported), 1, NULL);
+
+	/** TESTPOINT: the other one gets the next event */
+	k_sem_give(&set_idle_sem);
+	k_sleep(TIMEOUT_MS / 10);
+	zassert_equal(atomic_get(&reported), 2, NULL);
+
+	zassert_equal(k_sem_take(&set_sem, K_NO_WAIT), 0, NULL);
+	zassert_equal(k_sem_take(&set_idle_sem, K_NO_WAIT), 0, NULL);
+	k_thread_abort(&helper_thread);
+	k_thread_abort(&helper2_thread);
+
+	set_del_all();
+}
+
+void test_pollset_grant_access(void)
+{
+	k_thread_access_grant(k_current_get(), &set, &set_sem, &set_idle_sem,
+			      &set_fifo, &set_signal, &helper_thread,
+			      &helper_stack);
+}
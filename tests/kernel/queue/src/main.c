@@ -17,6 +17,11 @@ static void test_auto_free(void)
 {
 	ztest_test_skip();
 }
+
+static void test_queue_get_batch_user(void)
+{
+	ztest_test_skip();
+}
 #endif
 
 /*test case main entry*/
@@ -31,6 +36,10 @@ void test_main(void)
 			 ztest_unit_test(test_queue_get_2threads),
 			 ztest_unit_test(test_queue_get_fail),
 			 ztest_unit_test(test_queue_loop),
-			 ztest_unit_test(test_queue_alloc));
+			 ztest_unit_test(test_queue_alloc),
+			 ztest_unit_test(test_queue_get_batch),
+			 ztest_unit_test(test_queue_get_batch_wait),
+			 ztest_unit_test(test_queue_get_batch_cancel),
+			 ztest_unit_test(test_queue_get_batch_user));
 	ztest_run_test_suite(queue_api);
 }
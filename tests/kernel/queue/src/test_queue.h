@@ -21,6 +21,12 @@ extern void test_queue_supv_to_user(void);
 extern void test_auto_free(void);
 #endif
 extern void test_queue_alloc(void);
+extern void test_queue_get_batch(void);
+extern void test_queue_get_batch_wait(void);
+extern void test_queue_get_batch_cancel(void);
+#ifdef CONFIG_USERSPACE
+extern void test_queue_get_batch_user(void);
+#endif
 
 typedef struct qdata {
 	sys_snode_t snode;
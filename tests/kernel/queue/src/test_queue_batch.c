@@ -0,0 +1,137 @@
+/*
+ * Copyright (c) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "test_queue.h"
+
+#define STACK_SIZE (512 + CONFIG_TEST_EXTRA_STACKSIZE)
+#define LIST_LEN 10
+#define TIMEOUT_MS 100
+
+static K_THREAD_STACK_DEFINE(batch_stack, STACK_SIZE);
+static struct k_thread batch_thread;
+
+static struct k_queue batch_queue;
+static qdata_t batch_data[LIST_LEN];
+
+/**
+ * @brief Verify k_queue_get_batch() takes items in queue order
+ * @ingroup kernel_queue_tests
+ * @see k_queue_get_batch(), k_fifo_get_batch(), k_lifo_get_batch()
+ */
+void test_queue_get_batch(void)
+{
+	void *items[LIST_LEN];
+	s64_t start;
+	int num;
+
+	k_queue_init(&batch_queue);
+
+	for (int i = 0; i < LIST_LEN; i++) {
+		batch_data[i].data = i;
+		k_queue_append(&batch_queue, &batch_data[i]);
+	}
+
+	/**TESTPOINT: take no more than asked for, in queue order */
+	num = k_queue_get_batch(&batch_queue, items, 4, K_NO_WAIT);
+	zassert_equal(num, 4, NULL);
+	for (int i = 0; i < num; i++) {
+		zassert_equal(items[i], &batch_data[i], NULL);
+	}
+
+	/**TESTPOINT: take what is left without waiting for more */
+	num = k_fifo_get_batch((struct k_fifo *)&batch_queue, items,
+			       ARRAY_SIZE(items), K_FOREVER);
+	zassert_equal(num, LIST_LEN - 4, NULL);
+	for (int i = 0; i < num; i++) {
+		zassert_equal(items[i], &batch_data[i + 4], NULL);
+	}
+
+	/**TESTPOINT: LIFO order through k_lifo_get_batch() */
+	for (int i = 0; i < 3; i++) {
+		k_queue_prepend(&batch_queue, &batch_data[i]);
+	}
+	num = k_lifo_get_batch((struct k_lifo *)&batch_queue, items,
+			       ARRAY_SIZE(items), K_NO_WAIT);
+	zassert_equal(num, 3, NULL);
+	for (int i = 0; i < num; i++) {
+		zassert_equal(items[i], &batch_data[2 - i], NULL);
+	}
+
+	/**TESTPOINT: empty queue */
+	zassert_equal(k_queue_get_batch(&batch_queue, items,
+					ARRAY_SIZE(items), K_NO_WAIT), 0, NULL);
+	start = k_uptime_get();
+	zassert_equal(k_queue_get_batch(&batch_queue, items,
+					ARRAY_SIZE(items), TIMEOUT_MS), 0,
+		      NULL);
+	zassert_true(k_uptime_get() - start >= TIMEOUT_MS, NULL);
+}
+
+static void append_list_entry(void *p1, void *p2, void *p3)
+{
+	k_sleep(TIMEOUT_MS / 2);
+
+	for (int i = 0; i < 2; i++) {
+		batch_data[i].snode.next = &batch_data[i + 1].snode;
+	}
+	batch_data[2].snode.next = NULL;
+	k_queue_append_list(&batch_queue, &batch_data[0], &batch_data[2]);
+}
+
+/**
+ * @brief Verify a blocked k_queue_get_batch() gets a whole list
+ * @ingroup kernel_queue_tests
+ * @see k_queue_get_batch(), k_queue_append_list()
+ */
+void test_queue_get_batch_wait(void)
+{
+	void *items[LIST_LEN];
+	int num;
+
+	k_queue_init(&batch_queue);
+
+	k_thread_create(&batch_thread, batch_stack, STACK_SIZE,
+			append_list_entry, NULL, NULL, NULL,
+			K_PRIO_PREEMPT(0), 0, 0);
+
+	/**TESTPOINT: wait for data, then take all that was appended */
+	num = k_queue_get_batch(&batch_queue, items, ARRAY_SIZE(items),
+				K_FOREVER);
+	zassert_equal(num, 3, "got %d items", num);
+	for (int i = 0; i < num; i++) {
+		zassert_equal(items[i], &batch_data[i], NULL);
+	}
+
+	k_thread_abort(&batch_thread);
+}
+
+static void cancel_entry(void *p1, void *p2, void *p3)
+{
+	k_sleep(TIMEOUT_MS / 2);
+	k_queue_cancel_wait(&batch_queue);
+}
+
+/**
+ * @brief Verify k_queue_cancel_wait() on k_queue_get_batch()
+ * @ingroup kernel_queue_tests
+ * @see k_queue_get_batch(), k_queue_cancel_wait()
+ */
+void test_queue_get_batch_cancel(void)
+{
+	void *items[LIST_LEN];
+
+	k_queue_init(&batch_queue);
+
+	k_thread_create(&batch_thread, batch_stack, STACK_SIZE,
+			cancel_entry, NULL, NULL, NULL,
+			K_PRIO_PREEMPT(0), 0, 0);
+
+	zassert_equal(k_queue_get_batch(&batch_queue, items,
+					ARRAY_SIZE(items), K_FOREVER), 0,
+		      NULL);
+
+	k_thread_abort(&batch_thread);
+}
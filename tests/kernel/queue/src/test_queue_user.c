@@ -144,4 +144,67 @@ void test_auto_free(void)
 	}
 }
 
+static void child_thread_get_batch(void *p1, void *p2, void *p3)
+{
+	struct k_queue *q = p1;
+	struct k_sem *sem = p2;
+	void *items[LIST_LEN];
+	int num = 0;
+
+	while (num < LIST_LEN) {
+		int got = k_queue_get_batch(q, &items[num], LIST_LEN - num,
+					    K_FOREVER);
+
+		zassert_true(got > 0, NULL);
+		num += got;
+	}
+
+	for (int i = 0; i < LIST_LEN; i++) {
+		zassert_equal(((struct qdata *)items[i])->data, i, NULL);
+	}
+
+	zassert_equal(k_queue_get_batch(q, items, LIST_LEN, K_NO_WAIT), 0,
+		      NULL);
+
+	k_sem_give(sem);
+}
+
+/**
+ * @brief Verify k_queue_get_batch() from a user thread
+ * @details The child user thread takes items appended with
+ * k_queue_alloc_append() in batches.
+ * @ingroup kernel_queue_tests
+ * @see k_queue_get_batch(), k_queue_alloc_append()
+ */
+void test_queue_get_batch_user(void)
+{
+	struct k_queue *q;
+	struct k_sem *sem;
+
+	k_thread_resource_pool_assign(k_current_get(), &test_pool);
+
+	q = k_object_alloc(K_OBJ_QUEUE);
+	zassert_not_null(q, "no memory for allocated queue object");
+	k_queue_init(q);
+
+	sem = k_object_alloc(K_OBJ_SEM);
+	zassert_not_null(sem, "no memory for semaphore object");
+	k_sem_init(sem, 0, 1);
+
+	k_thread_create(&child_thread, child_stack, STACK_SIZE,
+			child_thread_get_batch, q, sem, NULL,
+			K_HIGHEST_THREAD_PRIO, K_USER | K_INHERIT_PERMS, 0);
+
+	/* The child blocks on the empty queue first, then gets the items
+	 * as we append them
+	 */
+	for (int i = 0; i < LIST_LEN; i++) {
+		qdata[i].data = i;
+		qdata[i].allocated = true;
+		zassert_false(k_queue_alloc_append(q, &qdata[i]), NULL);
+	}
+
+	k_sem_take(sem, K_FOREVER);
+}
+
 #endif /* CONFIG_USERSPACE */
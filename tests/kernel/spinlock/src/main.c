@@ -28,6 +28,15 @@ volatile int bounce_owner, bounce_done;
  * @}
  */
 
+static bool spin_is_locked(struct k_spinlock *l)
+{
+#ifdef CONFIG_SPINLOCK_TICKET
+	return atomic_get(&l->owner) != atomic_get(&l->next);
+#else
+	return atomic_get(&l->locked) != 0;
+#endif
+}
+
 /**
  * @brief Test basic spinlock
  *
@@ -40,15 +49,47 @@ void test_spinlock_basic(void)
 	k_spinlock_key_t key;
 	static struct k_spinlock l;
 
-	zassert_true(!l.locked, "Spinlock initialized to locked");
+	zassert_true(!spin_is_locked(&l), "Spinlock initialized to locked");
 
 	key = k_spin_lock(&l);
 
-	zassert_true(l.locked, "Spinlock failed to lock");
+	zassert_true(spin_is_locked(&l), "Spinlock failed to lock");
 
 	k_spin_unlock(&l, key);
 
-	zassert_true(!l.locked, "Spinlock failed to unlock");
+	zassert_true(!spin_is_locked(&l), "Spinlock failed to unlock");
+}
+
+/**
+ * @brief Test spinlock contention statistics
+ *
+ * @ingroup kernel_spinlock_tests
+ *
+ * @see k_spin_lock(), k_spin_unlock()
+ */
+void test_spinlock_stats(void)
+{
+#ifdef CONFIG_SPINLOCK_STATS
+	k_spinlock_key_t key;
+	static struct k_spinlock l;
+	int i;
+
+	for (i = 0; i < 3; i++) {
+		key = k_spin_lock(&l);
+		k_busy_wait(10);
+		k_spin_unlock(&l, key);
+	}
+
+	/**TESTPOINT: uncontended locks are counted but never spin */
+	zassert_equal(l.stats.acquired, 3, "Acquisitions not counted");
+	zassert_equal(l.stats.contended, 0, "Free lock seen as contended");
+	zassert_equal(l.stats.spins, 0, "Spun on a free lock");
+
+	/**TESTPOINT: the hold time covers the critical section */
+	zassert_true(l.stats.hold_max > 0, "Hold time not recorded");
+#else
+	ztest_test_skip();
+#endif
 }
 
 void bounce_once(int id)
@@ -127,6 +168,7 @@ void test_main(void)
 {
 	ztest_test_suite(spinlock,
 			 ztest_unit_test(test_spinlock_basic),
+			 ztest_unit_test(test_spinlock_stats),
 			 ztest_unit_test(test_spinlock_bounce));
 	ztest_run_test_suite(spinlock);
 }
@@ -0,0 +1,129 @@
+/*
+ * Copyright (c) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <ztest.h>
+#include <kernel_structs.h>
+
+#define STACKSIZE (1024 + CONFIG_TEST_EXTRA_STACKSIZE)
+#define DEPTH 512
+
+static K_THREAD_STACK_DEFINE(tstack, STACKSIZE);
+static struct k_thread tdata;
+static K_SEM_DEFINE(wake_sem, 0, 1);
+
+/* Block in k_sem_take() with DEPTH bytes of locals below the entry frame,
+ * so that the sample taken when switching out covers them. The semaphore
+ * is never given, the threads are aborted once blocked.
+ */
+static void __attribute__((noinline)) deep_wait(void)
+{
+	volatile u8_t buf[DEPTH];
+	int i;
+
+	for (i = 0; i < DEPTH; i++) {
+		buf[i] = i;
+	}
+
+	k_sem_take(&wake_sem, K_FOREVER);
+
+	zassert_equal(buf[0], 0, NULL);
+}
+
+static void shallow_entry(void *p1, void *p2, void *p3)
+{
+	k_sem_take(&wake_sem, K_FOREVER);
+}
+
+static void deep_entry(void *p1, void *p2, void *p3)
+{
+	deep_wait();
+}
+
+static size_t run_thread(k_thread_entry_t entry)
+{
+	size_t used;
+
+	k_thread_create(&tdata, tstack, STACKSIZE, entry, NULL, NULL, NULL,
+			K_PRIO_PREEMPT(0), 0, K_NO_WAIT);
+
+	/* Let it block on the semaphore */
+	k_sleep(10);
+	k_thread_abort(&tdata);
+
+	used = k_thread_stack_usage_get(&tdata);
+	zassert_true(used <= tdata.stack_info.size,
+		     "usage %u above stack size", (unsigned int)used);
+
+	return used;
+}
+
+/**
+ * @brief Test the sampled stack high-water mark of threads
+ *
+ * @details A thread that blocks with DEPTH bytes of locals must report at
+ * least DEPTH bytes of usage, and more than a thread that blocks right in
+ * its entry point.
+ *
+ * @see k_thread_stack_usage_get()
+ */
+void test_stack_usage_sampled(void)
+{
+	size_t shallow, deep;
+
+	shallow = run_thread(shallow_entry);
+	deep = run_thread(deep_entry);
+
+	zassert_true(shallow > 0, "no sample taken");
+	zassert_true(deep >= DEPTH, "usage %u below %u",
+		     (unsigned int)deep, DEPTH);
+	zassert_true(deep > shallow, NULL);
+}
+
+/**
+ * @brief Test the sampled interrupt stack usage
+ *
+ * @see k_isr_stack_usage_get()
+ */
+void test_isr_stack_usage(void)
+{
+	k_sleep(100);
+
+	/* Some ports run interrupts on the thread stack, only check the
+	 * bounds.
+	 */
+	zassert_true(k_isr_stack_usage_get(0) <= CONFIG_ISR_STACK_SIZE, NULL);
+}
+
+/**
+ * @brief Test that the guard region is painted and left intact
+ */
+void test_stack_guard(void)
+{
+#ifdef CONFIG_STACK_USAGE_MONITOR_GUARD
+	u8_t *guard;
+	int i;
+
+	(void)run_thread(deep_entry);
+
+	/* The guard sits above the stack sentinel, if any */
+	guard = (u8_t *)tdata.stack_info.start + STACK_GUARD_OFFSET;
+	for (i = 0; i < CONFIG_STACK_USAGE_MONITOR_GUARD_SIZE; i++) {
+		zassert_equal(guard[i], STACK_GUARD_PATTERN,
+			      "guard damaged at %d", i);
+	}
+#else
+	ztest_test_skip();
+#endif
+}
+
+void test_main(void)
+{
+	ztest_test_suite(stack_usage,
+			 ztest_unit_test(test_stack_usage_sampled),
+			 ztest_unit_test(test_isr_stack_usage),
+			 ztest_unit_test(test_stack_guard));
+	ztest_run_test_suite(stack_usage);
+}
@@ -0,0 +1,73 @@
+/*
+ * Copyright (c) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <ztest.h>
+
+/* One tick, in milliseconds, rounded up */
+#define TICK_MS ((MSEC_PER_SEC + CONFIG_SYS_CLOCK_TICKS_PER_SEC - 1) / \
+		 CONFIG_SYS_CLOCK_TICKS_PER_SEC)
+
+#if defined(CONFIG_TIME_PAGE_MAX_AGE_MS) && CONFIG_TIME_PAGE_MAX_AGE_MS > 0
+#define MAX_AGE_MS MAX(CONFIG_TIME_PAGE_MAX_AGE_MS, TICK_MS)
+#else
+#define MAX_AGE_MS TICK_MS
+#endif
+
+/**
+ * @brief Test the uptime read from the time page
+ *
+ * @see k_uptime_get_fast()
+ */
+void test_time_page_uptime(void)
+{
+	s64_t fast, uptime;
+
+	for (int i = 0; i < 10; i++) {
+		/* Waking up announces the elapsed ticks, so the time page
+		 * is fresh even in tickless mode
+		 */
+		k_sleep(3);
+
+		fast = k_uptime_get_fast();
+		uptime = k_uptime_get();
+
+		/**TESTPOINT: the time page lags by less than its max age */
+		zassert_true(fast <= uptime, "time page ahead of uptime");
+		zassert_true(uptime - fast <= MAX_AGE_MS + TICK_MS,
+			     "time page %d ms behind", (int)(uptime - fast));
+	}
+}
+
+/**
+ * @brief Test that the time page advances
+ *
+ * @see k_uptime_get_fast()
+ */
+void test_time_page_monotonic(void)
+{
+	s64_t start = k_uptime_get_fast();
+	s64_t prev = start, now;
+
+	while ((now = k_uptime_get_fast()) - start < 50) {
+		/**TESTPOINT: the time page never goes backwards */
+		zassert_true(now >= prev, "time page went backwards");
+		prev = now;
+
+		/* In tickless mode the page only advances on announcements,
+		 * which an idle sleep provides
+		 */
+		k_sleep(1);
+	}
+}
+
+void test_main(void)
+{
+	ztest_test_suite(time_page,
+			 ztest_user_unit_test(test_time_page_uptime),
+			 ztest_user_unit_test(test_time_page_monotonic),
+			 ztest_unit_test(test_time_page_uptime));
+	ztest_run_test_suite(time_page);
+}
@@ -0,0 +1,166 @@
+/*
+ * Copyright (c) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @brief Timeout slack tests
+ * @defgroup kernel_timer_slack_tests Timeout slack
+ * @ingroup all_tests
+ * @{
+ * @}
+ */
+
+#include <ztest.h>
+
+#define EARLY		100
+#define LATE		130
+#define SLACK		50
+#define TICK_MS		(MSEC_PER_SEC / CONFIG_SYS_CLOCK_TICKS_PER_SEC)
+#define TIMEOUT		(2 * (LATE + SLACK))
+
+struct expiry {
+	s64_t uptime;
+	u32_t announces;
+};
+
+static struct expiry early_expiry, late_expiry, work_expiry;
+static K_SEM_DEFINE(done_sema, 0, 2);
+
+static void record(struct expiry *e)
+{
+	struct k_timeout_stats stats;
+
+	k_timeout_stats_get(&stats);
+	e->uptime = k_uptime_get();
+	e->announces = stats.announces;
+}
+
+static void early_fn(struct k_timer *timer)
+{
+	record(&early_expiry);
+	k_sem_give(&done_sema);
+}
+
+static void late_fn(struct k_timer *timer)
+{
+	record(&late_expiry);
+	k_sem_give(&done_sema);
+}
+
+static void work_fn(struct k_work *work)
+{
+	record(&work_expiry);
+	k_sem_give(&done_sema);
+}
+
+K_TIMER_DEFINE(early_timer, early_fn, NULL);
+K_TIMER_DEFINE(late_timer, late_fn, NULL);
+
+static void wait_both(void)
+{
+	zassert_equal(k_sem_take(&done_sema, TIMEOUT), 0, NULL);
+	zassert_equal(k_sem_take(&done_sema, TIMEOUT), 0, NULL);
+}
+
+/**
+ * @brief Test that a timer with slack is batched with a later timer
+ *
+ * @ingroup kernel_timer_slack_tests
+ *
+ * @see k_timer_start_slack(), k_timeout_stats_get()
+ */
+void test_timer_slack_batch(void)
+{
+	struct k_timeout_stats before, after;
+	s64_t start;
+
+	k_timeout_stats_get(&before);
+	start = k_uptime_get();
+	k_timer_start_slack(&early_timer, EARLY, 0, SLACK);
+	k_timer_start(&late_timer, LATE, 0);
+	wait_both();
+	k_timeout_stats_get(&after);
+
+	/**TESTPOINT: the timer never expires early, nor after its slack */
+	zassert_true(early_expiry.uptime - start >= EARLY, NULL);
+	zassert_true(early_expiry.uptime - start <= EARLY + SLACK + TICK_MS,
+		     NULL);
+	zassert_true(late_expiry.uptime - start >= LATE, NULL);
+	zassert_true(after.expired - before.expired >= 2, NULL);
+
+	if (!IS_ENABLED(CONFIG_TICKLESS_KERNEL)) {
+		ztest_test_skip();
+	}
+
+	/**TESTPOINT: both expire from the same timer interrupt */
+	zassert_equal(early_expiry.announces, late_expiry.announces, NULL);
+}
+
+/**
+ * @brief Test that timers without slack are not batched
+ *
+ * @ingroup kernel_timer_slack_tests
+ *
+ * @see k_timer_start_slack(), k_timer_start()
+ */
+void test_timer_no_slack(void)
+{
+	s64_t start;
+
+	/**TESTPOINT: k_timer_start() clears the slack of a timer */
+	start = k_uptime_get();
+	k_timer_start(&early_timer, EARLY, 0);
+	k_timer_start_slack(&late_timer, LATE, 0, SLACK);
+	wait_both();
+
+	zassert_true(early_expiry.uptime - start >= EARLY, NULL);
+	zassert_true(early_expiry.uptime - start < LATE, NULL);
+	zassert_true(late_expiry.uptime - start >= LATE, NULL);
+	zassert_true(late_expiry.uptime - start <= LATE + SLACK + TICK_MS,
+		     NULL);
+	zassert_not_equal(early_expiry.announces, late_expiry.announces, NULL);
+}
+
+/**
+ * @brief Test that delayed work with slack is batched with a timer
+ *
+ * @ingroup kernel_timer_slack_tests
+ *
+ * @see k_delayed_work_submit_slack()
+ */
+void test_delayed_work_slack(void)
+{
+	struct k_delayed_work work;
+	s64_t start;
+
+	k_delayed_work_init(&work, work_fn);
+
+	start = k_uptime_get();
+	zassert_equal(k_delayed_work_submit_slack(&work, EARLY, SLACK), 0,
+		      NULL);
+	k_timer_start(&late_timer, LATE, 0);
+	wait_both();
+
+	/**TESTPOINT: the work is submitted within its slack */
+	zassert_true(work_expiry.uptime - start >= EARLY, NULL);
+	zassert_true(work_expiry.uptime - start <= EARLY + SLACK + TICK_MS,
+		     NULL);
+
+	if (!IS_ENABLED(CONFIG_TICKLESS_KERNEL)) {
+		ztest_test_skip();
+	}
+
+	/**TESTPOINT: along with the timer expiring within that slack */
+	zassert_true(work_expiry.uptime >= late_expiry.uptime, NULL);
+}
+
+void test_main(void)
+{
+	ztest_test_suite(timer_slack,
+			 ztest_unit_test(test_timer_slack_batch),
+			 ztest_unit_test(test_timer_no_slack),
+			 ztest_unit_test(test_delayed_work_slack));
+	ztest_run_test_suite(timer_slack);
+}
@@ -503,6 +503,9 @@ void test_delayed_work_cancel_isr(void)
 	}
 }
 
+extern void test_workq_pool_concurrency(void);
+extern void test_workq_pool_non_reentrant(void);
+extern void test_workq_pool_delayed(void);
 
 void test_main(void)
 {
@@ -535,6 +538,9 @@ void test_main(void)
 			 ztest_unit_test(test_delayed_work_cancel_from_queue_thread),
 			 ztest_unit_test(test_delayed_work_cancel_from_queue_isr),
 			 ztest_unit_test(test_delayed_work_cancel_thread),
-			 ztest_unit_test(test_delayed_work_cancel_isr));
+			 ztest_unit_test(test_delayed_work_cancel_isr),
+			 ztest_unit_test(test_workq_pool_concurrency),
+			 ztest_unit_test(test_workq_pool_non_reentrant),
+			 ztest_unit_test(test_workq_pool_delayed));
 	ztest_run_test_suite(workqueue_api);
 }
@@ -0,0 +1,175 @@
+/*
+ * Copyright (c) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <ztest.h>
+
+#define NUM_WORKERS	3
+#define NUM_QUICK	4
+#define TIMEOUT		100
+#define STACK_SIZE	(1024 + CONFIG_TEST_EXTRA_STACKSIZE)
+
+static K_THREAD_STACK_ARRAY_DEFINE(pool_stacks, NUM_WORKERS, STACK_SIZE);
+static struct k_thread pool_threads[NUM_WORKERS];
+static struct k_work_q pool_workq;
+
+static struct k_work gate_work[NUM_WORKERS];
+static struct k_work quick_work[NUM_QUICK];
+static struct k_work slow_work;
+static struct k_delayed_work pool_delayed_work;
+
+static K_SEM_DEFINE(gate_sema, 0, NUM_WORKERS);
+static K_SEM_DEFINE(done_sema, 0, NUM_WORKERS + NUM_QUICK);
+static atomic_t blocked;
+static atomic_t running;
+static atomic_t max_running;
+static atomic_t runs;
+
+static void gate_handler(struct k_work *work)
+{
+	atomic_inc(&blocked);
+	k_sem_take(&gate_sema, K_FOREVER);
+	atomic_dec(&blocked);
+	k_sem_give(&done_sema);
+}
+
+static void quick_handler(struct k_work *work)
+{
+	k_sem_give(&done_sema);
+}
+
+static void slow_handler(struct k_work *work)
+{
+	atomic_val_t now = atomic_inc(&running) + 1;
+
+	if (now > atomic_get(&max_running)) {
+		atomic_set(&max_running, now);
+	}
+	k_sleep(TIMEOUT / 2);
+	atomic_inc(&runs);
+	atomic_dec(&running);
+	k_sem_give(&done_sema);
+}
+
+static void wait_blocked(int count)
+{
+	for (int i = 0; i < TIMEOUT && atomic_get(&blocked) != count; i++) {
+		k_sleep(1);
+	}
+	zassert_equal(atomic_get(&blocked), count, NULL);
+}
+
+/**
+ * @brief Test that the workers of a pool process work items concurrently
+ *
+ * @ingroup kernel_workqueue_tests
+ *
+ * @see k_work_q_pool_start(), k_work_q_stats_get()
+ */
+void test_workq_pool_concurrency(void)
+{
+	struct k_work_q_stats stats;
+
+	k_work_q_pool_start(&pool_workq, pool_threads, pool_stacks[0],
+			    NUM_WORKERS, STACK_SIZE, K_PRIO_PREEMPT(0),
+			    K_WORK_Q_POOL_PIN);
+
+	/**TESTPOINT: every worker takes one blocking work item */
+	for (int i = 0; i < NUM_WORKERS; i++) {
+		k_work_init(&gate_work[i], gate_handler);
+		k_work_submit_to_queue(&pool_workq, &gate_work[i]);
+	}
+	wait_blocked(NUM_WORKERS);
+
+	/**TESTPOINT: further work items wait in the queue */
+	for (int i = 0; i < NUM_QUICK; i++) {
+		k_work_init(&quick_work[i], quick_handler);
+		k_work_submit_to_queue(&pool_workq, &quick_work[i]);
+	}
+	k_work_q_stats_get(&pool_workq, &stats);
+	zassert_equal(stats.depth, NUM_QUICK, NULL);
+	zassert_equal(stats.max_depth, NUM_QUICK, NULL);
+	zassert_equal(stats.processed, 0, NULL);
+
+	/**TESTPOINT: all work items complete once the workers are freed */
+	for (int i = 0; i < NUM_WORKERS; i++) {
+		k_sem_give(&gate_sema);
+	}
+	for (int i = 0; i < NUM_WORKERS + NUM_QUICK; i++) {
+		zassert_equal(k_sem_take(&done_sema, TIMEOUT), 0, NULL);
+	}
+
+	/* The statistics are updated after the handlers return */
+	k_sleep(1);
+	k_work_q_stats_get(&pool_workq, &stats);
+	zassert_equal(stats.depth, 0, NULL);
+	zassert_equal(stats.processed, NUM_WORKERS + NUM_QUICK, NULL);
+	zassert_true(stats.runtime_max > 0, NULL);
+	zassert_true(stats.runtime_total >= stats.runtime_max, NULL);
+	zassert_true(stats.latency_max > 0, NULL);
+	zassert_true(stats.latency_total >= stats.latency_max, NULL);
+
+	/**TESTPOINT: reset keeps the current depth only */
+	k_work_q_stats_reset(&pool_workq);
+	k_work_q_stats_get(&pool_workq, &stats);
+	zassert_equal(stats.max_depth, 0, NULL);
+	zassert_equal(stats.processed, 0, NULL);
+	zassert_equal(stats.runtime_total, 0, NULL);
+}
+
+/**
+ * @brief Test that a work item never runs in two workers at once
+ *
+ * @ingroup kernel_workqueue_tests
+ *
+ * @see k_work_q_pool_start(), k_work_submit_to_queue()
+ */
+void test_workq_pool_non_reentrant(void)
+{
+	atomic_set(&running, 0);
+	atomic_set(&max_running, 0);
+	atomic_set(&runs, 0);
+	k_work_init(&slow_work, slow_handler);
+
+	/**TESTPOINT: resubmitting a running item runs it again, later */
+	k_work_submit_to_queue(&pool_workq, &slow_work);
+	k_sleep(TIMEOUT / 4);
+	zassert_false(k_work_pending(&slow_work), NULL);
+	k_work_submit_to_queue(&pool_workq, &slow_work);
+	k_sleep(1);
+	k_work_submit_to_queue(&pool_workq, &slow_work);
+
+	zassert_equal(k_sem_take(&done_sema, TIMEOUT), 0, NULL);
+	zassert_equal(k_sem_take(&done_sema, TIMEOUT), 0, NULL);
+	zassert_not_equal(k_sem_take(&done_sema, TIMEOUT), 0, NULL);
+	zassert_equal(atomic_get(&runs), 2, NULL);
+	zassert_equal(atomic_get(&max_running), 1, NULL);
+	zassert_false(k_work_pending(&slow_work), NULL);
+}
+
+/**
+ * @brief Test delayed work on a workqueue pool
+ *
+ * @ingroup kernel_workqueue_tests
+ *
+ * @see k_delayed_work_submit_to_queue(), k_delayed_work_cancel()
+ */
+void test_workq_pool_delayed(void)
+{
+	k_delayed_work_init(&pool_delayed_work, quick_handler);
+
+	/**TESTPOINT: canceled delayed work does not run */
+	zassert_equal(k_delayed_work_submit_to_queue(&pool_workq,
+						     &pool_delayed_work,
+						     TIMEOUT), 0, NULL);
+	zassert_equal(k_delayed_work_cancel(&pool_delayed_work), 0, NULL);
+	zassert_not_equal(k_sem_take(&done_sema, 2 * TIMEOUT), 0, NULL);
+
+	/**TESTPOINT: delayed work runs once its delay expires */
+	zassert_equal(k_delayed_work_submit_to_queue(&pool_workq,
+						     &pool_delayed_work,
+						     TIMEOUT), 0, NULL);
+	zassert_equal(k_sem_take(&done_sema, 2 * TIMEOUT), 0, NULL);
+}
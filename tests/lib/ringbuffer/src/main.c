@@ -395,6 +395,11 @@ void test_byte_put_free(void)
 	}
 }
 
+extern void test_ringbuffer_mp_claim_order(void);
+extern void test_ringbuffer_mp_item_stress(void);
+extern void test_ringbuffer_mp_byte_stress(void);
+extern void test_ringbuffer_mp_busy_producers(void);
+
 /*test case main entry*/
 void test_main(void)
 {
@@ -410,7 +415,11 @@ void test_main(void)
 			 ztest_unit_test(test_ring_buffer_main),
 			 ztest_unit_test(test_ringbuffer_raw),
 			 ztest_unit_test(test_ringbuffer_alloc_put),
-			 ztest_unit_test(test_byte_put_free)
+			 ztest_unit_test(test_byte_put_free),
+			 ztest_unit_test(test_ringbuffer_mp_claim_order),
+			 ztest_unit_test(test_ringbuffer_mp_item_stress),
+			 ztest_unit_test(test_ringbuffer_mp_byte_stress),
+			 ztest_unit_test(test_ringbuffer_mp_busy_producers)
 			 );
 	ztest_run_test_suite(test_ringbuffer_api);
 }
@@ -0,0 +1,328 @@
+/*
+ * Copyright (c) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <ztest.h>
+#include <ring_buffer.h>
+
+#define PRODUCERS	3
+#define ITEMS		2000
+#define STACK_SIZE	(640 + CONFIG_TEST_EXTRA_STACKSIZE)
+#define PRODUCER_PRIO	K_PRIO_PREEMPT(5)
+#define ISR_ID		PRODUCERS
+
+RING_BUF_MP_ITEM_DECLARE_POW2(mp_items, 6);
+RING_BUF_MP_DECLARE_POW2(mp_bytes, 7);
+
+static K_THREAD_STACK_ARRAY_DEFINE(stacks, PRODUCERS, STACK_SIZE);
+static struct k_thread threads[PRODUCERS];
+
+/* Byte mode records are a power of 2 so that claims never wrap */
+struct record {
+	u32_t id;
+	u32_t seq;
+};
+
+static u32_t isr_seq;
+
+static void item_producer(void *p1, void *p2, void *p3)
+{
+	u32_t id = POINTER_TO_UINT(p1);
+
+	for (u32_t seq = 0; seq < ITEMS; seq++) {
+		u32_t data[2] = { seq, ~seq };
+
+		while (ring_buf_mp_item_put(&mp_items, id, seq, data,
+					    ARRAY_SIZE(data)) != 0) {
+			k_yield();
+		}
+	}
+}
+
+static void item_isr_producer(struct k_timer *timer)
+{
+	u32_t data = isr_seq;
+
+	/* ISRs cannot wait for space: a dropped item is simply retried
+	 * with the same sequence number next time
+	 */
+	if (ring_buf_mp_item_put(&mp_items, ISR_ID, isr_seq, &data, 1) == 0) {
+		isr_seq++;
+	}
+}
+
+static void byte_producer(void *p1, void *p2, void *p3)
+{
+	struct record rec = { .id = POINTER_TO_UINT(p1) };
+	u8_t *dst;
+
+	for (rec.seq = 0; rec.seq < ITEMS; rec.seq++) {
+		while (ring_buf_mp_put_claim(&mp_bytes, &dst,
+					     sizeof(rec)) == 0) {
+			k_yield();
+		}
+		memcpy(dst, &rec, sizeof(rec));
+		ring_buf_mp_put_finish(&mp_bytes, dst, sizeof(rec));
+	}
+}
+
+/* Always keeps a claim in flight while the other busy producer
+ * finishes its own
+ */
+static void busy_producer(void *p1, void *p2, void *p3)
+{
+	struct record rec = { .id = POINTER_TO_UINT(p1) };
+	u8_t *dst;
+
+	for (rec.seq = 0; ; rec.seq++) {
+		while (ring_buf_mp_put_claim(&mp_bytes, &dst,
+					     sizeof(rec)) == 0) {
+			k_yield();
+		}
+		k_yield();
+		memcpy(dst, &rec, sizeof(rec));
+		ring_buf_mp_put_finish(&mp_bytes, dst, sizeof(rec));
+	}
+}
+
+static void byte_isr_producer(struct k_timer *timer)
+{
+	struct record rec = { .id = ISR_ID, .seq = isr_seq };
+
+	if (ring_buf_mp_put(&mp_bytes, (u8_t *)&rec, sizeof(rec)) != 0) {
+		isr_seq++;
+	}
+}
+
+static void start_producers(k_thread_entry_t entry, struct k_timer *timer)
+{
+	isr_seq = 0;
+
+	/* Slice the producers so that they preempt each other in the
+	 * middle of their claims, and let a timer ISR join in
+	 */
+	k_sched_time_slice_set(1, PRODUCER_PRIO);
+	for (int i = 0; i < PRODUCERS; i++) {
+		k_thread_create(&threads[i], stacks[i], STACK_SIZE, entry,
+				INT_TO_POINTER(i), NULL, NULL, PRODUCER_PRIO,
+				0, 0);
+	}
+	k_timer_start(timer, 1, 1);
+}
+
+static void stop_producers(struct k_timer *timer)
+{
+	k_timer_stop(timer);
+	k_sched_time_slice_set(0, PRODUCER_PRIO);
+
+	/* They may not have returned yet after their last put */
+	for (int i = 0; i < PRODUCERS; i++) {
+		k_thread_abort(&threads[i]);
+	}
+}
+
+static bool producers_done(u32_t *next)
+{
+	for (int i = 0; i < PRODUCERS; i++) {
+		if (next[i] != ITEMS) {
+			return false;
+		}
+	}
+
+	return true;
+}
+
+/**
+ * @brief Test that data claimed by several producers is published in
+ * order, once all earlier claims are finished
+ *
+ * @see ring_buf_mp_put_claim(), ring_buf_mp_put_finish(),
+ * ring_buf_mp_get()
+ */
+void test_ringbuffer_mp_claim_order(void)
+{
+	u8_t *first, *second, *third, *claims[RING_BUF_MP_CLAIMS], out[4];
+
+	ring_buf_mp_init(&mp_bytes, mp_bytes.size, mp_bytes.buf.buf8);
+
+	/**TESTPOINT: two producers claim space in turn */
+	zassert_equal(ring_buf_mp_put_claim(&mp_bytes, &first, 2), 2, NULL);
+	zassert_equal(ring_buf_mp_put_claim(&mp_bytes, &second, 2), 2, NULL);
+	zassert_equal(second, first + 2, NULL);
+	zassert_equal(ring_buf_mp_space_get(&mp_bytes), mp_bytes.size - 4,
+		      NULL);
+
+	/**TESTPOINT: the second finishes first, nothing is visible */
+	second[0] = 3;
+	second[1] = 4;
+	ring_buf_mp_put_finish(&mp_bytes, second, 2);
+	zassert_true(ring_buf_mp_is_empty(&mp_bytes), NULL);
+	zassert_equal(ring_buf_mp_get(&mp_bytes, out, sizeof(out)), 0, NULL);
+
+	/**TESTPOINT: both are visible once the first finishes, even
+	 * though a third claim is in flight meanwhile
+	 */
+	zassert_equal(ring_buf_mp_put_claim(&mp_bytes, &third, 2), 2, NULL);
+	first[0] = 1;
+	first[1] = 2;
+	ring_buf_mp_put_finish(&mp_bytes, first, 2);
+	zassert_equal(ring_buf_mp_get(&mp_bytes, out, sizeof(out)), 4, NULL);
+	zassert_equal(memcmp(out, "\x01\x02\x03\x04", 4), 0, NULL);
+	zassert_true(ring_buf_mp_is_empty(&mp_bytes), NULL);
+
+	/**TESTPOINT: in order claims are visible as soon as finished */
+	third[0] = 5;
+	third[1] = 6;
+	ring_buf_mp_put_finish(&mp_bytes, third, 2);
+	zassert_equal(ring_buf_mp_get(&mp_bytes, out, sizeof(out)), 2, NULL);
+	zassert_equal(memcmp(out, "\x05\x06", 2), 0, NULL);
+
+	/**TESTPOINT: the number of claims in flight is limited */
+	for (int i = 0; i < RING_BUF_MP_CLAIMS; i++) {
+		zassert_equal(ring_buf_mp_put_claim(&mp_bytes, &claims[i], 1),
+			      1, NULL);
+	}
+	zassert_equal(ring_buf_mp_put_claim(&mp_bytes, &first, 1), 0, NULL);
+	for (int i = RING_BUF_MP_CLAIMS - 1; i >= 0; i--) {
+		ring_buf_mp_put_finish(&mp_bytes, claims[i], 1);
+	}
+	zassert_equal(ring_buf_mp_get_finish(&mp_bytes, RING_BUF_MP_CLAIMS),
+		      0, NULL);
+
+	/**TESTPOINT: the whole buffer can be filled */
+	for (int i = 0; i < mp_bytes.size / sizeof(out); i++) {
+		zassert_equal(ring_buf_mp_put(&mp_bytes, out, sizeof(out)),
+			      sizeof(out), NULL);
+	}
+	zassert_equal(ring_buf_mp_space_get(&mp_bytes), 0, NULL);
+	zassert_equal(ring_buf_mp_put(&mp_bytes, out, 1), 0, NULL);
+	zassert_equal(ring_buf_mp_get_finish(&mp_bytes, mp_bytes.size + 1),
+		      -EINVAL, NULL);
+	zassert_equal(ring_buf_mp_get_finish(&mp_bytes, mp_bytes.size), 0,
+		      NULL);
+}
+
+/**
+ * @brief Stress concurrent item producers against a single consumer
+ *
+ * @details Several preempting threads and a timer ISR put sequenced
+ * items; the consumer checks that every producer's items arrive intact
+ * and in order.
+ *
+ * @see ring_buf_mp_item_put(), ring_buf_mp_item_get()
+ */
+void test_ringbuffer_mp_item_stress(void)
+{
+	struct k_timer timer;
+	u32_t next[PRODUCERS + 1] = { 0 };
+	u32_t data[2];
+	u16_t id;
+	u8_t value, size32;
+
+	ring_buf_mp_init(&mp_items, mp_items.size, mp_items.buf.buf32);
+	k_timer_init(&timer, item_isr_producer, NULL);
+	start_producers(item_producer, &timer);
+
+	while (!producers_done(next)) {
+		size32 = ARRAY_SIZE(data);
+		if (ring_buf_mp_item_get(&mp_items, &id, &value, data,
+					 &size32) != 0) {
+			k_sleep(1);
+			continue;
+		}
+
+		/**TESTPOINT: no item is lost, duplicated or torn */
+		zassert_true(id <= ISR_ID, "bad producer %u", id);
+		zassert_equal(data[0], next[id], "producer %u", id);
+		zassert_equal(value, (u8_t)next[id], NULL);
+		zassert_equal(size32, id == ISR_ID ? 1 : 2, NULL);
+		if (id != ISR_ID) {
+			zassert_equal(data[1], ~next[id], NULL);
+		}
+		next[id]++;
+	}
+
+	stop_producers(&timer);
+	zassert_true(next[ISR_ID] > 0, "ISR producer never ran");
+}
+
+/**
+ * @brief Stress concurrent byte producers against a single consumer
+ *
+ * @see ring_buf_mp_put_claim(), ring_buf_mp_put_finish(),
+ * ring_buf_mp_put(), ring_buf_mp_get()
+ */
+void test_ringbuffer_mp_byte_stress(void)
+{
+	struct k_timer timer;
+	u32_t next[PRODUCERS + 1] = { 0 };
+	struct record rec;
+
+	ring_buf_mp_init(&mp_bytes, mp_bytes.size, mp_bytes.buf.buf8);
+	k_timer_init(&timer, byte_isr_producer, NULL);
+	start_producers(byte_producer, &timer);
+
+	while (!producers_done(next)) {
+		if (ring_buf_mp_get(&mp_bytes, (u8_t *)&rec,
+				    sizeof(rec)) == 0) {
+			k_sleep(1);
+			continue;
+		}
+
+		/**TESTPOINT: records are neither torn nor reordered */
+		zassert_true(rec.id <= ISR_ID, "bad producer %u", rec.id);
+		zassert_equal(rec.seq, next[rec.id], "producer %u", rec.id);
+		next[rec.id]++;
+	}
+
+	stop_producers(&timer);
+	zassert_true(next[ISR_ID] > 0, "ISR producer never ran");
+}
+
+/**
+ * @brief Test that data is published while producers keep claiming
+ *
+ * @details Two producers alternate so that one of them always has a
+ * claim in flight when the other finishes; the consumer must still
+ * receive their data in order.
+ *
+ * @see ring_buf_mp_put_claim(), ring_buf_mp_put_finish(),
+ * ring_buf_mp_get()
+ */
+void test_ringbuffer_mp_busy_producers(void)
+{
+	u32_t next[2] = { 0 };
+	struct record rec;
+	int waited = 0;
+
+	ring_buf_mp_init(&mp_bytes, mp_bytes.size, mp_bytes.buf.buf8);
+	for (int i = 0; i < ARRAY_SIZE(next); i++) {
+		k_thread_create(&threads[i], stacks[i], STACK_SIZE,
+				busy_producer, INT_TO_POINTER(i), NULL, NULL,
+				PRODUCER_PRIO, 0, 0);
+	}
+
+	while (next[0] < ITEMS || next[1] < ITEMS) {
+		if (ring_buf_mp_get(&mp_bytes, (u8_t *)&rec,
+				    sizeof(rec)) == 0) {
+			/**TESTPOINT: busy producers do not starve the
+			 * consumer
+			 */
+			zassert_true(++waited < 1000, "nothing published");
+			k_sleep(1);
+			continue;
+		}
+
+		zassert_true(rec.id < ARRAY_SIZE(next), "bad producer %u",
+			     rec.id);
+		zassert_equal(rec.seq, next[rec.id], "producer %u", rec.id);
+		next[rec.id]++;
+		waited = 0;
+	}
+
+	for (int i = 0; i < ARRAY_SIZE(next); i++) {
+		k_thread_abort(&threads[i]);
+	}
+}
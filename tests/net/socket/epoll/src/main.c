@@ -0,0 +1,291 @@
+/*
+ * Copyright (c) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <logging/log.h>
+LOG_MODULE_REGISTER(net_test, CONFIG_NET_SOCKETS_LOG_LEVEL);
+
+#include <stdio.h>
+#include <ztest_assert.h>
+
+#include <net/socket.h>
+
+#include "../../socket_helpers.h"
+
+#define BUF_AND_SIZE(buf) buf, sizeof(buf) - 1
+#define STRLEN(buf) (sizeof(buf) - 1)
+
+#define TEST_STR_SMALL "test"
+
+#define SERVER_PORT 4242
+#define CLIENT_PORT 9898
+
+/* On QEMU, a wait with a timeout takes +10ms from the requested time. */
+#define FUZZ 10
+
+/* Time for the loopback interface to deliver what was sent */
+#define DELIVERY_TIME K_MSEC(10)
+
+#define WAITERS 2
+#define WAITER_STACK_SIZE 1024
+
+static K_THREAD_STACK_ARRAY_DEFINE(waiter_stacks, WAITERS,
+				   WAITER_STACK_SIZE);
+static struct k_thread waiter_threads[WAITERS];
+static int waiter_res[WAITERS];
+static int waiter_errno[WAITERS];
+K_SEM_DEFINE(waiters_done, 0, WAITERS);
+
+static void send_test_str(int sock)
+{
+	ssize_t len;
+
+	len = send(sock, BUF_AND_SIZE(TEST_STR_SMALL), 0);
+	zassert_equal(len, STRLEN(TEST_STR_SMALL), "invalid send len");
+}
+
+static void recv_test_str(int sock)
+{
+	char buf[10];
+	ssize_t len;
+
+	len = recv(sock, BUF_AND_SIZE(buf), MSG_DONTWAIT);
+	zassert_equal(len, STRLEN(TEST_STR_SMALL), "invalid recv len");
+}
+
+static int wait_ready(int ep, int timeout, int *fd)
+{
+	struct epoll_event events[2];
+	int res;
+
+	memset(events, 0, sizeof(events));
+	res = epoll_wait(ep, events, ARRAY_SIZE(events), timeout);
+	if (res > 0) {
+		zassert_equal(events[0].events, EPOLLIN, "");
+		*fd = events[0].data.fd;
+	}
+
+	return res;
+}
+
+void test_epoll(void)
+{
+	int res;
+	int ep;
+	int c_sock;
+	int s_sock;
+	int fd = -1;
+	struct sockaddr_in c_addr;
+	struct sockaddr_in s_addr;
+	struct epoll_event ev;
+	u32_t tstamp;
+
+	prepare_sock_udp_v4(CONFIG_NET_CONFIG_MY_IPV4_ADDR, CLIENT_PORT,
+			    &c_sock, &c_addr);
+	prepare_sock_udp_v4(CONFIG_NET_CONFIG_MY_IPV4_ADDR, SERVER_PORT,
+			    &s_sock, &s_addr);
+
+	res = bind(s_sock, (struct sockaddr *)&s_addr, sizeof(s_addr));
+	zassert_equal(res, 0, "bind failed");
+
+	res = connect(c_sock, (struct sockaddr *)&s_addr, sizeof(s_addr));
+	zassert_equal(res, 0, "connect failed");
+
+	ep = epoll_create1(0);
+	zassert_true(ep >= 0, "epoll_create1 failed");
+
+	ev.events = EPOLLIN;
+	ev.data.fd = s_sock;
+	res = epoll_ctl(ep, EPOLL_CTL_ADD, s_sock, &ev);
+	zassert_equal(res, 0, "epoll_ctl failed");
+
+	res = epoll_ctl(ep, EPOLL_CTL_ADD, s_sock, &ev);
+	zassert_equal(res, -1, "");
+	zassert_equal(errno, EEXIST, "");
+
+	/* Only sockets can be watched */
+	res = epoll_ctl(ep, EPOLL_CTL_ADD, ep, &ev);
+	zassert_equal(res, -1, "");
+	zassert_equal(errno, EPERM, "");
+
+
+	/* Wait with timeout of 0 and of 30 with nothing ready */
+	tstamp = k_uptime_get_32();
+	res = wait_ready(ep, 0, &fd);
+	zassert_true(k_uptime_get_32() - tstamp <= FUZZ, "");
+	zassert_equal(res, 0, "");
+
+	tstamp = k_uptime_get_32();
+	res = wait_ready(ep, 30, &fd);
+	tstamp = k_uptime_get_32() - tstamp;
+	zassert_true(tstamp >= 30 && tstamp <= 30 + FUZZ, "");
+	zassert_equal(res, 0, "");
+
+
+	/* Level-triggered: reported until the data is read */
+	send_test_str(c_sock);
+
+	tstamp = k_uptime_get_32();
+	res = wait_ready(ep, 30, &fd);
+	zassert_true(k_uptime_get_32() - tstamp <= FUZZ, "");
+	zassert_equal(res, 1, "");
+	zassert_equal(fd, s_sock, "");
+
+	res = wait_ready(ep, 0, &fd);
+	zassert_equal(res, 1, "");
+
+	recv_test_str(s_sock);
+
+	res = wait_ready(ep, 0, &fd);
+	zassert_equal(res, 0, "");
+
+
+	/* Edge-triggered: reported once per arrival */
+	ev.events = EPOLLIN | EPOLLET;
+	res = epoll_ctl(ep, EPOLL_CTL_MOD, s_sock, &ev);
+	zassert_equal(res, 0, "epoll_ctl failed");
+
+	send_test_str(c_sock);
+	send_test_str(c_sock);
+	k_sleep(DELIVERY_TIME);
+
+	res = wait_ready(ep, 0, &fd);
+	zassert_equal(res, 1, "");
+	res = wait_ready(ep, 0, &fd);
+	zassert_equal(res, 0, "");
+
+	recv_test_str(s_sock);
+	res = wait_ready(ep, 0, &fd);
+	zassert_equal(res, 0, "");
+
+	send_test_str(c_sock);
+	res = wait_ready(ep, 30, &fd);
+	zassert_equal(res, 1, "");
+
+	recv_test_str(s_sock);
+	recv_test_str(s_sock);
+
+
+	/* One-shot: disabled once reported, until rearmed */
+	ev.events = EPOLLIN | EPOLLONESHOT;
+	res = epoll_ctl(ep, EPOLL_CTL_MOD, s_sock, &ev);
+	zassert_equal(res, 0, "epoll_ctl failed");
+
+	send_test_str(c_sock);
+	res = wait_ready(ep, 30, &fd);
+	zassert_equal(res, 1, "");
+
+	send_test_str(c_sock);
+	k_sleep(DELIVERY_TIME);
+	res = wait_ready(ep, 0, &fd);
+	zassert_equal(res, 0, "");
+
+	res = epoll_ctl(ep, EPOLL_CTL_MOD, s_sock, &ev);
+	zassert_equal(res, 0, "epoll_ctl failed");
+	res = wait_ready(ep, 0, &fd);
+	zassert_equal(res, 1, "");
+
+	recv_test_str(s_sock);
+	recv_test_str(s_sock);
+
+
+	/* Removed sockets are not reported */
+	res = epoll_ctl(ep, EPOLL_CTL_DEL, s_sock, NULL);
+	zassert_equal(res, 0, "epoll_ctl failed");
+
+	res = epoll_ctl(ep, EPOLL_CTL_DEL, s_sock, NULL);
+	zassert_equal(res, -1, "");
+	zassert_equal(errno, ENOENT, "");
+
+	send_test_str(c_sock);
+	k_sleep(DELIVERY_TIME);
+	res = wait_ready(ep, 0, &fd);
+	zassert_equal(res, 0, "");
+
+
+	/* Closing a socket removes it from the interest list */
+	ev.events = EPOLLIN;
+	res = epoll_ctl(ep, EPOLL_CTL_ADD, s_sock, &ev);
+	zassert_equal(res, 0, "epoll_ctl failed");
+
+	res = close(s_sock);
+	zassert_equal(res, 0, "close failed");
+
+	res = wait_ready(ep, 0, &fd);
+	zassert_equal(res, 0, "");
+
+
+	res = close(c_sock);
+	zassert_equal(res, 0, "close failed");
+	res = close(ep);
+	zassert_equal(res, 0, "close failed");
+}
+
+static void waiter(void *p1, void *p2, void *p3)
+{
+	int idx = POINTER_TO_INT(p1);
+	int ep = POINTER_TO_INT(p2);
+	struct epoll_event ev;
+
+	ARG_UNUSED(p3);
+
+	waiter_res[idx] = epoll_wait(ep, &ev, 1, -1);
+	waiter_errno[idx] = errno;
+
+	k_sem_give(&waiters_done);
+}
+
+void test_epoll_close_wakes_all(void)
+{
+	int prio = k_thread_priority_get(k_current_get());
+	int res;
+	int ep;
+	int ep2;
+	int i;
+
+	ep = epoll_create1(0);
+	zassert_true(ep >= 0, "epoll_create1 failed");
+
+	for (i = 0; i < WAITERS; i++) {
+		k_thread_create(&waiter_threads[i], waiter_stacks[i],
+				WAITER_STACK_SIZE, waiter,
+				INT_TO_POINTER(i), INT_TO_POINTER(ep), NULL,
+				prio - 1, 0, K_NO_WAIT);
+	}
+
+	/* Let both waiters block */
+	k_sleep(K_MSEC(10));
+
+	res = close(ep);
+	zassert_equal(res, 0, "close failed");
+
+	/* Reusing the instance before the waiters run must not hide the
+	 * close from them
+	 */
+	ep2 = epoll_create1(0);
+	zassert_true(ep2 >= 0, "epoll_create1 failed");
+
+	for (i = 0; i < WAITERS; i++) {
+		res = k_sem_take(&waiters_done, K_MSEC(100));
+		zassert_equal(res, 0, "waiter not woken up");
+	}
+
+	for (i = 0; i < WAITERS; i++) {
+		zassert_equal(waiter_res[i], -1, "");
+		zassert_equal(waiter_errno[i], EBADF, "");
+	}
+
+	res = close(ep2);
+	zassert_equal(res, 0, "close failed");
+}
+
+void test_main(void)
+{
+	ztest_test_suite(socket_epoll,
+			 ztest_unit_test(test_epoll),
+			 ztest_unit_test(test_epoll_close_wakes_all));
+
+	ztest_run_test_suite(socket_epoll);
+}
@@ -9,8 +9,11 @@ LOG_MODULE_REGISTER(net_test, CONFIG_NET_SOCKETS_LOG_LEVEL);
 
 #include <ztest_assert.h>
 #include <net/socket.h>
+#include <net/net_pkt.h>
+#include <misc/fdtable.h>
 
 #include "../../socket_helpers.h"
+#include "tcp_internal.h"
 
 #define TEST_STR_SMALL "test"
 
@@ -326,6 +329,96 @@ void test_v6_sendto_recvfrom_null_dest(void)
 	k_sleep(TCP_TEARDOWN_TIMEOUT);
 }
 
+void test_v4_send_recv_zero_copy(void)
+{
+	/* Zero-copy calls are for supervisor threads, so this test does
+	 * not run in user mode.
+	 */
+	int c_sock;
+	int s_sock;
+	int new_sock;
+	struct sockaddr_in c_saddr;
+	struct sockaddr_in s_saddr;
+	struct sockaddr addr;
+	socklen_t addrlen = sizeof(addr);
+	char rx_buf[30] = {0};
+	struct net_context *ctx;
+	struct net_buf *chain;
+	struct net_buf *frag;
+	struct net_pkt *pkt;
+	u32_t recv_wnd;
+	ssize_t len;
+
+	prepare_sock_tcp_v4(CONFIG_NET_CONFIG_MY_IPV4_ADDR, ANY_PORT,
+			    &c_sock, &c_saddr);
+	prepare_sock_tcp_v4(CONFIG_NET_CONFIG_MY_IPV4_ADDR, SERVER_PORT,
+			    &s_sock, &s_saddr);
+
+	test_bind(s_sock, (struct sockaddr *)&s_saddr, sizeof(s_saddr));
+	test_listen(s_sock);
+
+	test_connect(c_sock, (struct sockaddr *)&s_saddr, sizeof(s_saddr));
+
+	frag = net_pkt_get_reserve_tx_data(K_FOREVER);
+	zassert_not_null(frag, "cannot get data buffer");
+	net_buf_add_mem(frag, TEST_STR_SMALL, strlen(TEST_STR_SMALL));
+
+	len = zsock_sendto_zc(c_sock, frag, 0, NULL, 0);
+	zassert_equal(len, strlen(TEST_STR_SMALL), "zero-copy send failed");
+
+	/* A chain larger than one segment is refused and stays with the
+	 * caller.
+	 */
+	ctx = z_get_fd_obj(c_sock, NULL, 0);
+	zassert_not_null(ctx, "no context");
+
+	chain = NULL;
+	while (!chain || net_buf_frags_len(chain) <= ctx->tcp->send_mss) {
+		frag = net_pkt_get_reserve_tx_data(K_SECONDS(1));
+		zassert_not_null(frag, "cannot get data buffer");
+		net_buf_add(frag, net_buf_tailroom(frag));
+
+		if (chain) {
+			net_buf_frag_add(chain, frag);
+		} else {
+			chain = frag;
+		}
+	}
+
+	len = zsock_sendto_zc(c_sock, chain, 0, NULL, 0);
+	zassert_equal(len, -1, "oversized zero-copy send succeeded");
+	zassert_equal(errno, EMSGSIZE, "wrong errno");
+	zassert_equal(chain->ref, 1, "chain kept by the socket");
+	net_buf_unref(chain);
+
+	test_accept(s_sock, &new_sock, &addr, &addrlen);
+
+	len = zsock_recvfrom_zc(new_sock, &pkt, 0, NULL, NULL);
+	zassert_equal(len, strlen(TEST_STR_SMALL), "zero-copy recv failed");
+	zassert_not_null(pkt, "no packet lent");
+
+	zassert_equal(net_pkt_read_new(pkt, rx_buf, len), 0, "read failed");
+	zassert_equal(strncmp(rx_buf, TEST_STR_SMALL, strlen(TEST_STR_SMALL)),
+		      0,
+		      "unexpected data");
+
+	/* The window reopens by the lent amount once the packet is back */
+	ctx = z_get_fd_obj(new_sock, NULL, 0);
+	zassert_not_null(ctx, "no context");
+	recv_wnd = net_tcp_get_recv_wnd(ctx->tcp);
+
+	zsock_recv_zc_release(new_sock, pkt);
+
+	zassert_equal(net_tcp_get_recv_wnd(ctx->tcp), recv_wnd + len,
+		      "receive window not reopened");
+
+	test_close(new_sock);
+	test_close(c_sock);
+	test_close(s_sock);
+
+	k_sleep(TCP_TEARDOWN_TIMEOUT);
+}
+
 void test_main(void)
 {
 	ztest_test_suite(socket_tcp,
@@ -334,7 +427,8 @@ void test_main(void)
 			 ztest_user_unit_test(test_v4_sendto_recvfrom),
 			 ztest_user_unit_test(test_v6_sendto_recvfrom),
 			 ztest_user_unit_test(test_v4_sendto_recvfrom_null_dest),
-			 ztest_user_unit_test(test_v6_sendto_recvfrom_null_dest));
+			 ztest_user_unit_test(test_v6_sendto_recvfrom_null_dest),
+			 ztest_unit_test(test_v4_send_recv_zero_copy));
 
 	ztest_run_test_suite(socket_tcp);
 }
@@ -0,0 +1,165 @@
+/*
+ * Copyright (c) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <logging/log.h>
+LOG_MODULE_REGISTER(net_test, CONFIG_NET_SOCKETS_LOG_LEVEL);
+
+#include <ztest.h>
+#include <net/socket.h>
+#include <net/loopback.h>
+
+#include "../../socket_helpers.h"
+
+/* Bulk transfer over a loopback TCP connection, with every Nth packet
+ * dropped by the loopback driver once the connection is established.
+ * The data must arrive intact, and the throughput is reported.
+ */
+
+#define SERVER_PORT 4242
+#define TRANSFER_SIZE (256 * 1024)
+#define CHUNK_SIZE 1024
+#define TRANSFER_TIMEOUT K_SECONDS(120)
+
+#define TCP_TEARDOWN_TIMEOUT K_SECONDS(1)
+
+#define STACK_SIZE (2048 + CONFIG_TEST_EXTRA_STACKSIZE)
+
+static K_THREAD_STACK_DEFINE(rx_stack, STACK_SIZE);
+static struct k_thread rx_thread;
+static K_SEM_DEFINE(rx_done, 0, 1);
+
+static u32_t rx_bytes;
+static u32_t rx_errors;
+
+static inline u8_t pattern(u32_t offset)
+{
+	return offset % 251;
+}
+
+static void receiver(void *p1, void *p2, void *p3)
+{
+	int sock = (int)p1;
+	u8_t buf[CHUNK_SIZE];
+	ssize_t len;
+
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	while (rx_bytes < TRANSFER_SIZE) {
+		len = recv(sock, buf, sizeof(buf), 0);
+		if (len <= 0) {
+			break;
+		}
+
+		for (int i = 0; i < len; i++) {
+			if (buf[i] != pattern(rx_bytes + i)) {
+				rx_errors++;
+			}
+		}
+
+		rx_bytes += len;
+	}
+
+	k_sem_give(&rx_done);
+}
+
+static void run_transfer(unsigned int drop_interval)
+{
+	struct sockaddr_in srv_addr, c_addr;
+	struct sockaddr addr;
+	socklen_t addrlen = sizeof(addr);
+	int srv_sock, c_sock, new_sock;
+	u8_t buf[CHUNK_SIZE];
+	u32_t sent = 0U, start, elapsed;
+	ssize_t len;
+
+	prepare_sock_tcp_v4(CONFIG_NET_CONFIG_MY_IPV4_ADDR, SERVER_PORT,
+			    &srv_sock, &srv_addr);
+	prepare_sock_tcp_v4(CONFIG_NET_CONFIG_MY_IPV4_ADDR, 0,
+			    &c_sock, &c_addr);
+
+	zassert_equal(bind(srv_sock, (struct sockaddr *)&srv_addr,
+			   sizeof(srv_addr)), 0, "bind failed");
+	zassert_equal(listen(srv_sock, 1), 0, "listen failed");
+	zassert_equal(connect(c_sock, (struct sockaddr *)&srv_addr,
+			      sizeof(srv_addr)), 0, "connect failed");
+
+	new_sock = accept(srv_sock, &addr, &addrlen);
+	zassert_true(new_sock >= 0, "accept failed");
+
+	/* SYNs are not retransmitted, only drop once connected */
+	loopback_set_packet_drop_interval(drop_interval);
+
+	rx_bytes = 0U;
+	rx_errors = 0U;
+
+	k_thread_create(&rx_thread, rx_stack, STACK_SIZE, receiver,
+			(void *)new_sock, NULL, NULL,
+			k_thread_priority_get(k_current_get()), 0, K_NO_WAIT);
+
+	start = k_uptime_get_32();
+
+	while (sent < TRANSFER_SIZE) {
+		size_t chunk = MIN(sizeof(buf), TRANSFER_SIZE - sent);
+
+		for (int i = 0; i < chunk; i++) {
+			buf[i] = pattern(sent + i);
+		}
+
+		for (size_t off = 0; off < chunk; off += len) {
+			len = send(c_sock, buf + off, chunk - off, 0);
+			zassert_true(len > 0, "send failed (%d)", errno);
+		}
+
+		sent += chunk;
+	}
+
+	zassert_equal(k_sem_take(&rx_done, TRANSFER_TIMEOUT), 0,
+		      "transfer timed out, %u bytes received", rx_bytes);
+	elapsed = MAX(k_uptime_get_32() - start, 1U);
+
+	loopback_set_packet_drop_interval(0);
+
+	zassert_equal(rx_bytes, TRANSFER_SIZE, "short transfer");
+	zassert_equal(rx_errors, 0, "%u corrupted bytes", rx_errors);
+
+	TC_PRINT("drop interval %u: %u bytes in %u ms, %u KiB/s\n",
+		 drop_interval, TRANSFER_SIZE, elapsed,
+		 (u32_t)((u64_t)TRANSFER_SIZE * 1000 / 1024 / elapsed));
+
+	k_thread_abort(&rx_thread);
+
+	zassert_equal(close(new_sock), 0, "close failed");
+	zassert_equal(close(c_sock), 0, "close failed");
+	zassert_equal(close(srv_sock), 0, "close failed");
+
+	k_sleep(TCP_TEARDOWN_TIMEOUT);
+}
+
+void test_v4_throughput_no_loss(void)
+{
+	run_transfer(0);
+}
+
+void test_v4_throughput_light_loss(void)
+{
+	run_transfer(50);
+}
+
+void test_v4_throughput_heavy_loss(void)
+{
+	run_transfer(10);
+}
+
+void test_main(void)
+{
+	ztest_test_suite(tcp_throughput,
+			 ztest_unit_test(test_v4_throughput_no_loss),
+			 ztest_unit_test(test_v4_throughput_light_loss),
+			 ztest_unit_test(test_v4_throughput_heavy_loss));
+
+	ztest_run_test_suite(tcp_throughput);
+}
@@ -11,6 +11,7 @@ LOG_MODULE_REGISTER(net_test, CONFIG_NET_SOCKETS_LOG_LEVEL);
 #include <ztest_assert.h>
 
 #include <net/socket.h>
+#include <net/net_pkt.h>
 
 #include "../../socket_helpers.h"
 
@@ -301,14 +302,215 @@ void test_send_recv_2_sock(void)
 	zassert_equal(rv, 0, "close failed");
 }
 
+void test_v4_sendto_recvfrom_zero_copy(void)
+{
+	int rv;
+	int client_sock;
+	int server_sock;
+	struct sockaddr_in client_addr;
+	struct sockaddr_in server_addr;
+	struct sockaddr addr;
+	socklen_t addrlen = sizeof(addr);
+	struct k_mem_slab *rx_slab, *tx_slab;
+	struct net_buf_pool *rx_data, *tx_data;
+	struct net_buf *head = NULL, *frag;
+	struct net_pkt *pkt;
+	static char rx_buf[400];
+	u32_t rx_free;
+	size_t off;
+	ssize_t len;
+
+	prepare_sock_udp_v4(CONFIG_NET_CONFIG_MY_IPV4_ADDR, ANY_PORT,
+			    &client_sock, &client_addr);
+	prepare_sock_udp_v4(CONFIG_NET_CONFIG_MY_IPV4_ADDR, SERVER_PORT,
+			    &server_sock, &server_addr);
+
+	rv = bind(server_sock,
+		  (struct sockaddr *)&server_addr, sizeof(server_addr));
+	zassert_equal(rv, 0, "bind failed");
+
+	net_pkt_get_info(&rx_slab, &tx_slab, &rx_data, &tx_data);
+	rx_free = k_mem_slab_num_free_get(rx_slab);
+
+	/* Spread the payload over several buffers */
+	for (off = 0; off < STRLEN(TEST_STR2); off += frag->len) {
+		frag = net_pkt_get_reserve_tx_data(K_FOREVER);
+		zassert_not_null(frag, "cannot get data buffer");
+
+		net_buf_add_mem(frag, TEST_STR2 + off,
+				MIN(net_buf_tailroom(frag),
+				    STRLEN(TEST_STR2) - off));
+		if (!head) {
+			head = frag;
+		} else {
+			net_buf_frag_add(head, frag);
+		}
+	}
+
+	len = zsock_sendto_zc(client_sock, head, 0,
+			      (struct sockaddr *)&server_addr,
+			      sizeof(server_addr));
+	zassert_equal(len, STRLEN(TEST_STR2), "zero-copy sendto failed");
+
+	len = zsock_recvfrom_zc(server_sock, &pkt, MSG_PEEK, NULL, NULL);
+	zassert_equal(len, -1, "MSG_PEEK should be refused");
+	zassert_equal(errno, EINVAL, "unexpected errno");
+
+	len = zsock_recvfrom_zc(server_sock, &pkt, 0, &addr, &addrlen);
+	zassert_equal(len, STRLEN(TEST_STR2), "zero-copy recvfrom failed");
+	zassert_not_null(pkt, "no packet lent");
+	zassert_equal(addrlen, sizeof(struct sockaddr_in),
+		      "unexpected addrlen");
+
+	clear_buf(rx_buf);
+	zassert_equal(net_pkt_read_new(pkt, rx_buf, len), 0, "read failed");
+	zassert_mem_equal(rx_buf, BUF_AND_SIZE(TEST_STR2), "wrong data");
+
+	zsock_recv_zc_release(server_sock, pkt);
+	zassert_equal(k_mem_slab_num_free_get(rx_slab), rx_free,
+		      "packet not released");
+
+	rv = close(client_sock);
+	zassert_equal(rv, 0, "close failed");
+	rv = close(server_sock);
+	zassert_equal(rv, 0, "close failed");
+}
+
+void test_v4_sendmsg_recvmsg(void)
+{
+	int rv;
+	int client_sock;
+	int server_sock;
+	struct sockaddr_in client_addr;
+	struct sockaddr_in server_addr;
+	struct sockaddr_in addr;
+	struct iovec iov[2];
+	struct msghdr msg;
+	struct mmsghdr msgvec[3];
+	struct iovec rx_iov[3];
+	static ZTEST_BMEM char rx_buf[3][16];
+	char head[8];
+	ssize_t len;
+	int i;
+
+	prepare_sock_udp_v4(CONFIG_NET_CONFIG_MY_IPV4_ADDR, ANY_PORT,
+			    &client_sock, &client_addr);
+	prepare_sock_udp_v4(CONFIG_NET_CONFIG_MY_IPV4_ADDR, SERVER_PORT,
+			    &server_sock, &server_addr);
+
+	rv = bind(server_sock,
+		  (struct sockaddr *)&server_addr, sizeof(server_addr));
+	zassert_equal(rv, 0, "bind failed");
+
+	/* Gather the datagram from two buffers */
+	iov[0].iov_base = TEST_STR_SMALL;
+	iov[0].iov_len = 2;
+	iov[1].iov_base = TEST_STR_SMALL + 2;
+	iov[1].iov_len = STRLEN(TEST_STR_SMALL) - 2;
+
+	memset(&msg, 0, sizeof(msg));
+	msg.msg_name = &server_addr;
+	msg.msg_namelen = sizeof(server_addr);
+	msg.msg_iov = iov;
+	msg.msg_iovlen = 2;
+
+	len = sendmsg(client_sock, &msg, 0);
+	zassert_equal(len, STRLEN(TEST_STR_SMALL), "sendmsg failed");
+
+	/* Scatter it into two buffers, the second one too short */
+	clear_buf(head);
+	clear_buf(rx_buf[0]);
+	iov[0].iov_base = head;
+	iov[0].iov_len = 1;
+	iov[1].iov_base = rx_buf[0];
+	iov[1].iov_len = 2;
+
+	memset(&msg, 0, sizeof(msg));
+	msg.msg_name = &addr;
+	msg.msg_namelen = sizeof(addr);
+	msg.msg_iov = iov;
+	msg.msg_iovlen = 2;
+
+	len = recvmsg(server_sock, &msg, 0);
+	zassert_equal(len, 3, "recvmsg failed");
+	zassert_true(msg.msg_flags & MSG_TRUNC, "MSG_TRUNC not set");
+	zassert_equal(msg.msg_namelen, sizeof(struct sockaddr_in),
+		      "unexpected namelen");
+	zassert_equal(addr.sin_port, client_addr.sin_port,
+		      "unexpected source port");
+	zassert_mem_equal(head, TEST_STR_SMALL, 1, "wrong data");
+	zassert_mem_equal(rx_buf[0], TEST_STR_SMALL + 1, 2, "wrong data");
+
+	/* Batch three datagrams each way */
+	memset(msgvec, 0, sizeof(msgvec));
+	for (i = 0; i < ARRAY_SIZE(msgvec); i++) {
+		msgvec[i].msg_hdr.msg_name = &server_addr;
+		msgvec[i].msg_hdr.msg_namelen = sizeof(server_addr);
+		msgvec[i].msg_hdr.msg_iov = &iov[0];
+		msgvec[i].msg_hdr.msg_iovlen = 1;
+	}
+
+	iov[0].iov_base = TEST_STR_SMALL;
+	iov[0].iov_len = STRLEN(TEST_STR_SMALL);
+
+	rv = sendmmsg(client_sock, msgvec, ARRAY_SIZE(msgvec), 0);
+	zassert_equal(rv, ARRAY_SIZE(msgvec), "sendmmsg failed");
+	for (i = 0; i < ARRAY_SIZE(msgvec); i++) {
+		zassert_equal(msgvec[i].msg_len, STRLEN(TEST_STR_SMALL),
+			      "unexpected msg_len");
+	}
+
+	/* Each received message needs its own buffer */
+	memset(msgvec, 0, sizeof(msgvec));
+	for (i = 0; i < ARRAY_SIZE(msgvec); i++) {
+		clear_buf(rx_buf[i]);
+		rx_iov[i].iov_base = rx_buf[i];
+		rx_iov[i].iov_len = sizeof(rx_buf[i]);
+		msgvec[i].msg_hdr.msg_iov = &rx_iov[i];
+		msgvec[i].msg_hdr.msg_iovlen = 1;
+	}
+
+	rv = recvmmsg(server_sock, msgvec, ARRAY_SIZE(msgvec),
+		      MSG_WAITFORONE, NULL);
+	zassert_equal(rv, ARRAY_SIZE(msgvec), "recvmmsg failed");
+	for (i = 0; i < ARRAY_SIZE(msgvec); i++) {
+		zassert_equal(msgvec[i].msg_len, STRLEN(TEST_STR_SMALL),
+			      "unexpected msg_len");
+		zassert_mem_equal(rx_buf[i], BUF_AND_SIZE(TEST_STR_SMALL),
+				  "wrong data");
+	}
+
+	/* The queue is drained now */
+	rv = recvmmsg(server_sock, msgvec, ARRAY_SIZE(msgvec),
+		      MSG_DONTWAIT, NULL);
+	zassert_equal(rv, -1, "recvmmsg should fail");
+	zassert_equal(errno, EAGAIN, "unexpected errno");
+
+	rv = close(client_sock);
+	zassert_equal(rv, 0, "close failed");
+	rv = close(server_sock);
+	zassert_equal(rv, 0, "close failed");
+}
+
+/* The same from user mode, through the copies made by the syscalls */
+void test_v4_sendmsg_recvmsg_user(void)
+{
+	test_v4_sendmsg_recvmsg();
+}
+
 void test_main(void)
 {
+	k_thread_system_pool_assign(k_current_get());
+
 	ztest_test_suite(socket_udp,
 			 ztest_unit_test(test_send_recv_2_sock),
 			 ztest_unit_test(test_v4_sendto_recvfrom),
 			 ztest_unit_test(test_v6_sendto_recvfrom),
 			 ztest_unit_test(test_v4_bind_sendto),
-			 ztest_unit_test(test_v6_bind_sendto));
+			 ztest_unit_test(test_v6_bind_sendto),
+			 ztest_unit_test(test_v4_sendto_recvfrom_zero_copy),
+			 ztest_unit_test(test_v4_sendmsg_recvmsg),
+			 ztest_user_unit_test(test_v4_sendmsg_recvmsg_user));
 
 	ztest_run_test_suite(socket_udp);
 }
@@ -70,6 +70,26 @@ static struct net_if *peer_iface;
 #define MY_TCP_PORT 5545
 #define PEER_TCP_PORT 9876
 
+/* Crafted peer of the SACK and window scale test. Its address is not
+ * configured on any interface, so that our replies are not looped back.
+ */
+#define SACK_TCP_PORT 5546
+#define SACK_PEER_PORT 9877
+#define SACK_PEER_ISN 1000
+#define SACK_PEER_MSS 100
+#define SACK_PEER_WSCALE 3
+#define SACK_PEER_WND 1000
+#define SACK_SEG_LEN SACK_PEER_MSS
+#define SACK_SEG_COUNT 4
+
+static struct in_addr sack_peer_v4_inaddr = { { { 192, 0, 2, 251 } } };
+static struct net_context *sack_conn;
+static bool sack_test;
+
+/* Sequence numbers of the SYN-ACK and data segments sent to the peer */
+K_MSGQ_DEFINE(sack_sent, sizeof(u32_t), 8, 4);
+K_SEM_DEFINE(sack_accepted, 0, 1);
+
 #define WAIT_TIME 250
 #define WAIT_TIME_LONG MSEC_PER_SEC
 
@@ -236,12 +256,38 @@ static void v6_send_syn_ack(struct net_pkt *req)
 
 static int send_status = -EINVAL;
 
+static void sack_peer_recv(struct net_pkt *pkt)
+{
+	struct net_tcp_hdr hdr, *tcp_hdr;
+	u32_t seq;
+	size_t len;
+
+	tcp_hdr = net_tcp_get_hdr(pkt, &hdr);
+	if (!tcp_hdr || tcp_hdr->dst_port != htons(SACK_PEER_PORT)) {
+		return;
+	}
+
+	len = net_pkt_get_len(pkt) - net_pkt_ip_hdr_len(pkt) -
+		NET_TCP_HDR_LEN(tcp_hdr);
+
+	/* Pure ACKs are of no interest */
+	if (!(tcp_hdr->flags & NET_TCP_SYN) && len == 0) {
+		return;
+	}
+
+	seq = sys_get_be32(tcp_hdr->seq);
+	k_msgq_put(&sack_sent, &seq, K_NO_WAIT);
+}
+
 static int tester_send(struct device *dev, struct net_pkt *pkt)
 {
 	if (!pkt->frags) {
 		DBG("No data to send!\n");
 		return -ENODATA;
 	}
+	if (sack_test && net_pkt_family(pkt) == AF_INET) {
+		sack_peer_recv(pkt);
+	}
 	if (syn_v6_sent && net_pkt_family(pkt) == AF_INET6) {
 		DBG("v6 SYN was sent successfully\n");
 		syn_v6_sent = false;
@@ -1704,6 +1750,277 @@ static bool test_init_tcp_accept(void)
 	return true;
 }
 
+static void accept_sack_cb(struct net_context *new_context,
+			   struct sockaddr *addr,
+			   socklen_t addrlen,
+			   int error,
+			   void *user_data)
+{
+	sack_conn = new_context;
+	k_sem_give(&sack_accepted);
+}
+
+static bool sack_peer_send(u8_t flags, u32_t seq, u32_t ack, u16_t wnd,
+			   const u8_t *opts, size_t optlen)
+{
+	struct net_ipv4_hdr ipv4 = {};
+	struct net_tcp_hdr tcp_hdr = { 0 };
+	struct net_pkt *pkt;
+	struct net_buf *frag;
+	int ret;
+
+	pkt = net_pkt_get_reserve_tx(K_FOREVER);
+
+	frag = net_pkt_get_frag(pkt, K_FOREVER);
+
+	net_pkt_frag_add(pkt, frag);
+
+	net_pkt_set_iface(pkt, my_iface);
+
+	ipv4.vhl = 0x45;
+	ipv4.ttl = 64;
+	ipv4.proto = IPPROTO_TCP;
+
+	net_ipaddr_copy(&ipv4.src, &sack_peer_v4_inaddr);
+	net_ipaddr_copy(&ipv4.dst, &my_v4_inaddr);
+
+	net_pkt_set_ip_hdr_len(pkt, sizeof(struct net_ipv4_hdr));
+
+	tcp_hdr.src_port = htons(SACK_PEER_PORT);
+	tcp_hdr.dst_port = htons(SACK_TCP_PORT);
+	sys_put_be32(seq, tcp_hdr.seq);
+	sys_put_be32(ack, tcp_hdr.ack);
+	tcp_hdr.offset = ((sizeof(tcp_hdr) + optlen) / 4) << 4;
+	tcp_hdr.flags = flags;
+	sys_put_be16(wnd, tcp_hdr.wnd);
+
+	net_pkt_append_all(pkt, sizeof(ipv4), (u8_t *)&ipv4, K_FOREVER);
+	net_pkt_append_all(pkt, sizeof(tcp_hdr), (u8_t *)&tcp_hdr, K_FOREVER);
+	if (optlen) {
+		net_pkt_append_all(pkt, optlen, opts, K_FOREVER);
+	}
+
+	net_pkt_cursor_init(pkt);
+	net_ipv4_finalize(pkt, IPPROTO_TCP);
+
+	ret = net_recv_data(my_iface, pkt);
+	if (ret < 0) {
+		DBG("Cannot recv pkt %p, ret %d\n", pkt, ret);
+		net_pkt_unref(pkt);
+		return false;
+	}
+
+	return true;
+}
+
+/* SACK option of a peer that received the second and the fourth of the
+ * segments starting at seq, but not the first and the third.
+ */
+static size_t sack_peer_blocks(u8_t *opts, u32_t seq)
+{
+	opts[0] = NET_TCP_NOP_OPT;
+	opts[1] = NET_TCP_NOP_OPT;
+	opts[2] = NET_TCP_SACK_OPT;
+	opts[3] = 2 + 2 * NET_TCP_SACK_BLOCK_SIZE;
+
+	sys_put_be32(seq + SACK_SEG_LEN, &opts[4]);
+	sys_put_be32(seq + 2 * SACK_SEG_LEN, &opts[8]);
+	sys_put_be32(seq + 3 * SACK_SEG_LEN, &opts[12]);
+	sys_put_be32(seq + 4 * SACK_SEG_LEN, &opts[16]);
+
+	return 4 + 2 * NET_TCP_SACK_BLOCK_SIZE;
+}
+
+static bool sack_peer_expect(u32_t expected)
+{
+	u32_t seq;
+
+	if (k_msgq_get(&sack_sent, &seq, WAIT_TIME)) {
+		TC_ERROR("Timeout while waiting segment %u\n", expected);
+		return false;
+	}
+
+	if (seq != expected) {
+		TC_ERROR("Segment %u sent, expected %u\n", seq, expected);
+		return false;
+	}
+
+	return true;
+}
+
+static bool test_v4_sack_wscale(void)
+{
+	static const u8_t syn_opts[] = {
+		NET_TCP_MSS_OPT, NET_TCP_MSS_SIZE, 0, SACK_PEER_MSS,
+		NET_TCP_NOP_OPT, NET_TCP_WINDOW_SCALE_OPT,
+		NET_TCP_WINDOW_SCALE_SIZE, SACK_PEER_WSCALE,
+		NET_TCP_NOP_OPT, NET_TCP_NOP_OPT,
+		NET_TCP_SACK_PERM_OPT, NET_TCP_SACK_PERM_SIZE,
+	};
+	u8_t data[SACK_SEG_LEN] = { 0 };
+	u8_t opts[4 + 2 * NET_TCP_SACK_BLOCK_SIZE];
+	struct sockaddr_in addr = my_v4_addr;
+	struct net_context *ctx;
+	struct net_tcp *tcp;
+	size_t optlen;
+	u32_t iss, seq;
+	int i, ret;
+
+	ret = net_context_get(AF_INET, SOCK_STREAM, IPPROTO_TCP, &ctx);
+	if (ret != 0) {
+		TC_ERROR("Context get SACK test failed.\n");
+		return false;
+	}
+
+	addr.sin_port = htons(SACK_TCP_PORT);
+
+	ret = net_context_bind(ctx, (struct sockaddr *)&addr, sizeof(addr));
+	if (ret) {
+		TC_ERROR("Context bind SACK test failed (%d)\n", ret);
+		return false;
+	}
+
+	ret = net_context_listen(ctx, 0);
+	if (ret) {
+		TC_ERROR("Context listen SACK test failed (%d)\n", ret);
+		return false;
+	}
+
+	ret = net_context_accept(ctx, accept_sack_cb, K_NO_WAIT, NULL);
+	if (ret) {
+		TC_ERROR("Context accept SACK test failed (%d)\n", ret);
+		return false;
+	}
+
+	sack_test = true;
+
+	if (!sack_peer_send(NET_TCP_SYN, SACK_PEER_ISN, 0, SACK_PEER_WND,
+			    syn_opts, sizeof(syn_opts))) {
+		return false;
+	}
+
+	if (k_msgq_get(&sack_sent, &iss, WAIT_TIME)) {
+		TC_ERROR("Timeout while waiting SYN-ACK\n");
+		return false;
+	}
+
+	if (!sack_peer_send(NET_TCP_ACK, SACK_PEER_ISN + 1, iss + 1,
+			    SACK_PEER_WND, NULL, 0)) {
+		return false;
+	}
+
+	if (k_sem_take(&sack_accepted, WAIT_TIME)) {
+		TC_ERROR("Timeout while waiting accept\n");
+		return false;
+	}
+
+	/* The window of the SYN is never scaled, the one of the ACK is */
+	tcp = sack_conn->tcp;
+	if (!(tcp->flags & NET_TCP_SACK_PERMITTED) ||
+	    tcp->send_wscale != SACK_PEER_WSCALE ||
+	    tcp->send_wnd != SACK_PEER_WND << SACK_PEER_WSCALE) {
+		TC_ERROR("Peer options not applied (flags 0x%x wscale %u "
+			 "wnd %u)\n", tcp->flags, tcp->send_wscale,
+			 tcp->send_wnd);
+		return false;
+	}
+
+	/* The initial window lets all the segments out at once */
+	seq = iss + 1;
+
+	for (i = 0; i < SACK_SEG_COUNT; i++) {
+		ret = net_context_send_new(sack_conn, data, sizeof(data),
+					   NULL, K_NO_WAIT, NULL, NULL);
+		if (ret < 0) {
+			TC_ERROR("Send SACK test failed (%d)\n", ret);
+			return false;
+		}
+	}
+
+	for (i = 0; i < SACK_SEG_COUNT; i++) {
+		if (!sack_peer_expect(seq + i * SACK_SEG_LEN)) {
+			return false;
+		}
+	}
+
+	/* A window update is not a duplicate ACK */
+	optlen = sack_peer_blocks(opts, seq);
+
+	if (!sack_peer_send(NET_TCP_ACK, SACK_PEER_ISN + 1, seq,
+			    SACK_PEER_WND / 2, opts, optlen)) {
+		return false;
+	}
+
+	k_sleep(WAIT_TIME);
+
+	if (tcp->dup_acks != 0U ||
+	    tcp->send_wnd != (SACK_PEER_WND / 2) << SACK_PEER_WSCALE) {
+		TC_ERROR("Window update taken as duplicate (dup %u wnd %u)\n",
+			 tcp->dup_acks, tcp->send_wnd);
+		return false;
+	}
+
+	/* The third duplicate ACK retransmits the first segment */
+	for (i = 0; i < 3; i++) {
+		if (!sack_peer_send(NET_TCP_ACK, SACK_PEER_ISN + 1, seq,
+				    SACK_PEER_WND / 2, opts, optlen)) {
+			return false;
+		}
+	}
+
+	if (!sack_peer_expect(seq)) {
+		return false;
+	}
+
+	if (tcp->sack_count != 2U) {
+		TC_ERROR("Scoreboard has %u blocks, expected 2\n",
+			 tcp->sack_count);
+		return false;
+	}
+
+	/* The next one fills the third segment, skipping the SACKed one */
+	if (!sack_peer_send(NET_TCP_ACK, SACK_PEER_ISN + 1, seq,
+			    SACK_PEER_WND / 2, opts, optlen)) {
+		return false;
+	}
+
+	if (!sack_peer_expect(seq + 2 * SACK_SEG_LEN)) {
+		return false;
+	}
+
+	/* Everything is acknowledged with a new, scaled, window */
+	if (!sack_peer_send(NET_TCP_ACK, SACK_PEER_ISN + 1,
+			    seq + SACK_SEG_COUNT * SACK_SEG_LEN,
+			    SACK_PEER_WND / 4, NULL, 0)) {
+		return false;
+	}
+
+	k_sleep(WAIT_TIME);
+
+	if (tcp->send_una != seq + SACK_SEG_COUNT * SACK_SEG_LEN ||
+	    tcp->send_wnd != (SACK_PEER_WND / 4) << SACK_PEER_WSCALE ||
+	    tcp->sack_count != 0U) {
+		TC_ERROR("Final ACK not applied (una %u wnd %u sack %u)\n",
+			 tcp->send_una, tcp->send_wnd, tcp->sack_count);
+		return false;
+	}
+
+	sack_test = false;
+
+	/* The reset of the peer releases the accepted context */
+	if (!sack_peer_send(NET_TCP_RST, SACK_PEER_ISN + 1, 0, 0, NULL, 0)) {
+		return false;
+	}
+
+	ret = net_context_put(ctx);
+	if (ret != 0) {
+		TC_ERROR("Context free SACK test failed.\n");
+		return false;
+	}
+
+	return true;
+}
+
 #if 0
 static bool test_init_tcp_connect(void)
 {
@@ -1874,6 +2191,7 @@ static const struct {
 	{ "test TCP seq validity", test_tcp_seq_validity },
 	{ "test TCP reply context init", test_init_tcp_reply_context },
 	{ "test TCP accept init", test_init_tcp_accept },
+	{ "test IPv4 TCP SACK and window scale", test_v4_sack_wscale },
 #if 0
 	/* TBD: more tests are needed */
 	{ "test TCP connect init", test_init_tcp_connect },
@@ -0,0 +1,66 @@
+/*
+ * Copyright (c) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <ztest.h>
+#include <tracing_cpu_stats.h>
+
+#define STACK_SIZE (512 + CONFIG_TEST_EXTRA_STACKSIZE)
+#define BUSY_US 10000
+
+static K_THREAD_STACK_DEFINE(busy_stack, STACK_SIZE);
+static struct k_thread busy_thread;
+
+static void busy_fn(void *p1, void *p2, void *p3)
+{
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	k_busy_wait(BUSY_US);
+}
+
+/**
+ * @brief Test per-thread CPU usage accounting
+ *
+ * @see cpu_stats_thread_get()
+ */
+static void test_thread_runtime(void)
+{
+	struct k_thread_runtime_stats stats;
+	u32_t waits = 0U;
+	u64_t ns;
+
+	k_thread_create(&busy_thread, busy_stack, STACK_SIZE, busy_fn,
+			NULL, NULL, NULL, K_PRIO_PREEMPT(10), 0, K_NO_WAIT);
+	k_sleep(2 * BUSY_US / 1000);
+
+	cpu_stats_thread_get(&busy_thread, &stats);
+
+	/**TESTPOINT: the busy loop is charged to the thread */
+	ns = SYS_CLOCK_HW_CYCLES_TO_NS64(stats.cycles);
+	zassert_true(ns >= BUSY_US * 1000ULL / 2, "runtime %u us too short",
+		     (u32_t)(ns / 1000));
+
+	/**TESTPOINT: each switch in ends one wait for the CPU */
+	zassert_true(stats.switches > 0, "thread never switched in");
+	for (int i = 0; i < K_THREAD_LATENCY_BUCKETS; i++) {
+		waits += stats.latency[i];
+	}
+	zassert_equal(waits, stats.switches, "latency histogram mismatch");
+
+	/**TESTPOINT: statistics can be cleared */
+	cpu_stats_thread_reset(&busy_thread);
+	cpu_stats_thread_get(&busy_thread, &stats);
+	zassert_equal(stats.cycles, 0, "runtime not reset");
+	zassert_equal(stats.switches, 0, "switches not reset");
+}
+
+void test_main(void)
+{
+	ztest_test_suite(cpu_stats,
+			 ztest_unit_test(test_thread_runtime));
+	ztest_run_test_suite(cpu_stats);
+}
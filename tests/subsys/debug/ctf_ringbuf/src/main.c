@@ -0,0 +1,151 @@
+/*
+ * Copyright (c) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <ztest.h>
+#include <kernel_structs.h>
+#include <ctf_middle.h>
+#include <ctf_bottom.h>
+
+#define RING_SIZE CONFIG_TRACING_CTF_RINGBUF_SIZE
+#define DUMP_SIZE CONFIG_TRACING_CTF_RINGBUF_DUMP_SIZE
+
+/* Events are stored with a 32-bit timestamp in front of them */
+#define EVENT_SIZE 8
+#define SLOT_SIZE (sizeof(u32_t) + EVENT_SIZE)
+#define DROP_SLOT_SIZE (sizeof(u32_t) + sizeof(u8_t) + sizeof(u32_t))
+
+/* The first event carries the events_dropped event left pending by the
+ * priming pass, the others only need their own slot.
+ */
+#define FITS (1 + (RING_SIZE - DROP_SLOT_SIZE - SLOT_SIZE) / SLOT_SIZE)
+#define EXTRA 5
+
+static struct {
+	u8_t data[DUMP_SIZE];
+	size_t len;
+} out;
+
+static void dump_cb(const void *data, size_t len, void *user_data)
+{
+	ARG_UNUSED(user_data);
+
+	if (out.len + len <= sizeof(out.data)) {
+		memcpy(&out.data[out.len], data, len);
+	}
+	out.len += len;
+}
+
+static void emit(u8_t seq)
+{
+	u8_t event[EVENT_SIZE];
+
+	for (int i = 0; i < EVENT_SIZE; i++) {
+		event[i] = seq + i;
+	}
+
+	ctf_bottom_emit(event, sizeof(event));
+}
+
+/* Lock interrupts with the rings drained, so that the kernel adds no
+ * events of its own until unlocked.
+ */
+static unsigned int lock_drained(void)
+{
+	unsigned int key;
+
+	while (true) {
+		key = irq_lock();
+		if (ctf_bottom_flush() == 0) {
+			return key;
+		}
+
+		/* The drain thread is at it, let it finish */
+		irq_unlock(key);
+		k_sleep(1);
+	}
+}
+
+/**
+ * @brief Test that a full ring drops and reports events
+ *
+ * @details Overfills the ring of the current CPU and checks the drop
+ * count, then that the dump holds the events_dropped event followed by
+ * the events that fit, in order.
+ *
+ * @see ctf_bottom_emit(), ctf_bottom_dropped(), ctf_bottom_dump()
+ */
+static void test_ringbuf_overflow(void)
+{
+	u32_t dropped, before, expected;
+	unsigned int key;
+	int cpu, total;
+	u8_t *pos;
+	u32_t count;
+	int i, j;
+
+	key = lock_drained();
+	cpu = _current_cpu->id;
+
+	/* Prime the ring with a single drop, whatever happened before */
+	before = ctf_bottom_dropped(cpu);
+	for (i = 0; i <= RING_SIZE / SLOT_SIZE; i++) {
+		emit(0);
+		if (ctf_bottom_dropped(cpu) != before) {
+			break;
+		}
+	}
+	dropped = ctf_bottom_dropped(cpu) - before;
+	(void)ctf_bottom_flush();
+
+	before = ctf_bottom_dropped(cpu);
+	for (i = 0; i < FITS + EXTRA; i++) {
+		emit(i);
+	}
+	count = ctf_bottom_dropped(cpu) - before;
+
+	out.len = 0;
+	total = ctf_bottom_dump(cpu, dump_cb, NULL);
+
+	irq_unlock(key);
+
+	zassert_equal(dropped, 1, "ring never filled up");
+
+	/**TESTPOINT: events beyond the ring size are counted */
+	zassert_equal(count, EXTRA, "%u events dropped", count);
+
+	zassert_equal(total, out.len, "dump returned %d", total);
+	zassert_true(out.len <= sizeof(out.data), "dump too large");
+
+	/**TESTPOINT: the last drain holds the pending drop, then the events
+	 * that fit
+	 */
+	expected = DROP_SLOT_SIZE + FITS * SLOT_SIZE;
+	zassert_true(out.len >= expected, "dump too short: %u",
+		     (u32_t)out.len);
+
+	pos = &out.data[out.len - expected] + sizeof(u32_t);
+	zassert_equal(*pos, CTF_EVENT_EVENTS_DROPPED, "no events_dropped");
+	pos += sizeof(u8_t);
+	memcpy(&count, pos, sizeof(count));
+	zassert_equal(count, 1, "events_dropped reports %u", count);
+	pos += sizeof(count);
+
+	for (i = 0; i < FITS; i++) {
+		pos += sizeof(u32_t);
+		for (j = 0; j < EVENT_SIZE; j++) {
+			zassert_equal(pos[j], (u8_t)(i + j),
+				      "event %d corrupted", i);
+		}
+		pos += EVENT_SIZE;
+	}
+}
+
+void test_main(void)
+{
+	ztest_test_suite(ctf_ringbuf,
+			 ztest_unit_test(test_ringbuf_overflow));
+	ztest_run_test_suite(ctf_ringbuf);
+}
@@ -307,7 +307,11 @@ void main(void)
 		&z_newlib_partition,
 #endif
 		/* Both minimal and newlib libc expose this for malloc arena */
-		&z_malloc_partition
+		&z_malloc_partition,
+#ifdef CONFIG_TIME_PAGE
+		/* Lets user mode tests read the uptime without a syscall */
+		&z_time_page_partition,
+#endif
 	};
 
 	/* Ztests just have one memory domain with one partition.